@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include <optional>
 
@@ -57,6 +59,107 @@ public:
 	using MemoryAddress = I2C::MemoryAddress;
 	using Register		= I2C::Register;
 
+	static constexpr float TEMPERATURE_RESOLUTION = 0.0078125f; // Degrees Celsius per LSB of the Temperature Register.
+
+	using Duration	= std::chrono::microseconds;
+	using Timestamp = std::chrono::microseconds; // Time since an application defined epoch.
+	using SensorId	= uint16_t;					 // Application defined identifier of a TMP116 in a fleet.
+
+	/**
+	 * @brief Latency stamps of a sample at each hop along its path from conversion to consumer.
+	 *
+	 * @details Stamps are held as offsets from the timestamp of the sample in whole microseconds, saturating at about
+	 * 35 minutes either side, so that tracing costs one clock read and one store per hop.
+	 * @see TMP116_LatencyTracer.hpp for histograms of the time spent between hops.
+	 */
+	struct Trace {
+		enum class Hop : uint8_t {
+			CONVERSION, // Estimated completion of the conversion, being the release of the job which read it.
+			READ,		// Completion of the bus read.
+			ENQUEUE,	// Queueing for the consumer or the first stage of a pipeline.
+			STAGE_0,	// Exit from each of the first STAGES pipeline stages. Later stages are not stamped.
+			STAGE_1,
+			STAGE_2,
+			STAGE_3,
+			RECEIPT, // Receipt by the consumer.
+		};
+
+		static constexpr size_t	 HOPS	= 8u;
+		static constexpr size_t	 STAGES = 4u;
+		static constexpr int32_t NONE	= INT32_MIN; // Offset of a hop which was not stamped.
+
+		std::array<int32_t, HOPS> offsets{NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE};
+	};
+
+	/**
+	 * @brief A temperature sample read from a TMP116.
+	 */
+	struct Sample {
+		SensorId  sensorId;	 // Identifier of the TMP116 the sample was read from.
+		Timestamp timestamp; // Time the sample was read.
+		Register  raw;		 // Temperature Register value.
+		Trace	  trace{};	 // Latency stamps, all unstamped unless set along the path of the sample.
+
+		/**
+		 * @brief Stamp the time the sample passed a hop, overwriting any previous stamp of the hop.
+		 *
+		 * @param hop The hop.
+		 * @param time The time, on the same clock as the timestamp.
+		 */
+		void stamp(Trace::Hop hop, Timestamp time);
+
+		/**
+		 * @brief Get the time the sample passed a hop.
+		 *
+		 * @param hop The hop.
+		 * @return std::optional<Timestamp> The time if the hop was stamped.
+		 */
+		std::optional<Timestamp> getStamp(Trace::Hop hop) const;
+
+		/**
+		 * @brief Get the temperature of the sample.
+		 *
+		 * @return float The temperature in degrees Celsius.
+		 */
+		float getTemperature() const;
+	};
+
+	class BusModel;					// @see TMP116_BusModel.hpp
+	class BusMonitor;				// @see TMP116_BusModel.hpp
+	class Scheduler;				// @see TMP116_Scheduler.hpp
+	class JitterRecorder;			// @see TMP116_JitterRecorder.hpp
+	class Worker;					// @see TMP116_Worker.hpp
+	class ThreadPool;				// @see TMP116_ThreadPool.hpp
+	class Pipeline;					// @see TMP116_Pipeline.hpp
+	class Rollup;					// @see TMP116_Rollup.hpp
+	class ZoneIndex;				// @see TMP116_ZoneIndex.hpp
+	class ChangePublisher;			// @see TMP116_ChangePublisher.hpp
+	class QuantileSketch;			// @see TMP116_QuantileSketch.hpp
+	class SlidingQuantileSketch;	// @see TMP116_QuantileSketch.hpp
+	class Formatter;				// @see TMP116_Formatter.hpp
+	class StreamServer;				// @see TMP116_StreamServer.hpp
+	class ColumnarExporter;			// @see TMP116_ColumnarExporter.hpp
+	class Watchdog;					// @see TMP116_Watchdog.hpp
+	class Segment;					// @see TMP116_Segment.hpp
+	class SegmentWriter;			// @see TMP116_Segment.hpp
+	class SegmentReader;			// @see TMP116_Segment.hpp
+	class Backfill;					// @see TMP116_Backfill.hpp
+	class Compactor;				// @see TMP116_Compactor.hpp
+	class GroupCommitWriter;		// @see TMP116_GroupCommit.hpp
+	class LatencyTracer;			// @see TMP116_LatencyTracer.hpp
+	class HealthMonitor;			// @see TMP116_HealthMonitor.hpp
+	class FilterBank;				// @see TMP116_FilterBank.hpp
+	class Resampler;				// @see TMP116_Resampler.hpp
+	class ThermalMap;				// @see TMP116_ThermalMap.hpp
+	class Fusion;					// @see TMP116_Fusion.hpp
+	class Predictor;				// @see TMP116_Predictor.hpp
+	class Estimator;				// @see TMP116_Estimator.hpp
+
+	template <typename T>
+	class Ring; // @see TMP116_Ring.hpp
+	template <typename T>
+	class Queue; // @see TMP116_Queue.hpp
+
 private:
 	I2C			 &i2c;
 	DeviceAddress deviceAddress;
@@ -77,6 +180,14 @@ public:
 	 */
 	float getTemperature() const;
 
+	/**
+	 * @brief Get the Temperature Register value from the TMP116.
+	 *
+	 * @return std::optional<Register> The raw temperature register value if successful.
+	 * @note The register is a two's complement value with a resolution of 0.0078125 degrees Celsius per LSB.
+	 */
+	std::optional<Register> getTemperatureRegister() const;
+
 	/**
 	 * @brief Get the Device ID of the TMP116.
 	 *
@@ -167,6 +278,22 @@ public:
 		 * 		 This results in non-reversible conversions with some register values when using this Config class.
 		 */
 		operator Register() const;
+
+		/**
+		 * @brief Get the period between successive temperature conversions.
+		 *
+		 * @return Duration The conversion period, being the larger of the conversion cycle time and the active
+		 * 		   conversion time required by the number of averages.
+		 * @note One-shot and shutdown modes report the conversion period as though in continuous mode.
+		 */
+		Duration getConversionPeriod() const;
+
+		/**
+		 * @brief Get the number of conversions averaged into each result.
+		 *
+		 * @return uint32_t 1, 8, 32 or 64. Averaging N conversions reduces the noise of results by about sqrt(N).
+		 */
+		uint32_t getAverageCount() const;
 	};
 
 	/**
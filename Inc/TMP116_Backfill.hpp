@@ -0,0 +1,153 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Backfill.hpp
+ * @brief			: TMP116 Parallel Reprocessing of Sample Log Segments
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+#include "TMP116_Rollup.hpp"
+#include "TMP116_Segment.hpp"
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Reprocesses archived sample log segments in parallel, filtering, rolling up and evaluating alerts again.
+ *
+ * @details The samples of the segments are divided into shards of a range of sensors over a window of time, and each
+ * shard is processed as one task on a work-stealing ThreadPool. A shard gathers its samples from every segment with a
+ * query pushed down to the blocks, orders them by sensor and time, and then filters, aggregates and classifies them
+ * against the limits. Shards are planned from the data alone and their results are merged in plan order, stitching the
+ * alert state of each sensor across time windows, so the result does not depend on the number of threads.
+ * @note Requires POSIX. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::Backfill {
+public:
+	/**
+	 * @brief Called with each sample before aggregation, possibly from several threads at once. Returns false to drop
+	 * the sample.
+	 *
+	 * @note A filter must not depend on samples seen before, as the samples of a sensor are split between shards.
+	 */
+	using Filter = std::function<bool(Sample &sample)>;
+
+	enum class Level : uint8_t {
+		NORMAL = 0u, // Between the limits.
+		LOW	   = 1u, // At or below the low limit.
+		HIGH   = 2u, // At or above the high limit.
+	};
+
+	/**
+	 * @brief A change of the alert level of a sensor.
+	 */
+	struct Alert {
+		SensorId  sensorId;
+		Timestamp timestamp; // Time of the sample changing the level.
+		Register  raw;		 // Temperature Register value of the sample changing the level.
+		Level	  level;	 // Level entered.
+	};
+
+	/**
+	 * @brief Aggregate of the samples of a sensor within one rollup interval.
+	 */
+	struct Aggregate {
+		SensorId	   sensorId;
+		Rollup::Bucket bucket;
+	};
+
+	struct Options {
+		SensorId sensorsPerShard = 64u;					// Sensor identifiers in the range of each shard.
+		Duration shardDuration	 = std::chrono::hours{24};	// Length of the time window of each shard.
+		Duration rollupInterval	 = std::chrono::minutes{1}; // Length of each aggregate.
+		int16_t	 lowLimit		 = std::numeric_limits<int16_t>::min(); // Raw low limit, as the Low Limit Register.
+		int16_t	 highLimit		 = std::numeric_limits<int16_t>::max(); // Raw high limit, as the High Limit Register.
+		Filter	 filter			 = nullptr;								 // Optional filter.
+	};
+
+	/**
+	 * @brief A range of sensors over a window of time, processed as one task.
+	 */
+	struct Shard {
+		SensorId  first; // First sensor identifier.
+		SensorId  last;	 // Last sensor identifier, inclusive.
+		Timestamp from;	 // Start of the window.
+		Timestamp to;	 // End of the window, inclusive.
+	};
+
+	struct Result {
+		std::vector<Aggregate> aggregates; // Ordered by sensor identifier and then time.
+		std::vector<Alert>	   alerts;	   // Ordered by sensor identifier and then time.
+		uint64_t			   samples = 0u; // Samples read.
+		uint64_t			   dropped = 0u; // Samples dropped by the filter.
+		size_t				   shards  = 0u; // Shards processed.
+		uint64_t			   steals  = 0u; // Shards stolen between threads of the pool.
+		Duration			   elapsed{0};	 // Wall time of the run.
+	};
+
+	/**
+	 * @brief Construct a new Backfill object
+	 *
+	 * @param paths The paths of the segment files. Samples of equal sensor and time are ordered by the order of paths.
+	 * @param options The shards, rollup and limits.
+	 */
+	Backfill(std::vector<std::string> paths, Options options);
+
+	Backfill(const Backfill &)			  = delete;
+	Backfill &operator=(const Backfill &) = delete;
+
+	~Backfill();
+
+	/**
+	 * @brief Open the segment files and find the range of sensors and time they hold from their block statistics.
+	 *
+	 * @return bool True if all segment files were opened.
+	 */
+	bool open();
+
+	/**
+	 * @brief Plan the shards covering the segments, aligned to multiples of the shard range and duration.
+	 *
+	 * @return std::vector<Shard> The shards, ordered by sensor range and then time.
+	 */
+	std::vector<Shard> plan() const;
+
+	/**
+	 * @brief Reprocess all samples of the segments.
+	 *
+	 * @param pool The pool processing the shards, one task per shard. May be called from a task of the pool.
+	 * @return Result The aggregates and alerts, identical for any number of threads.
+	 */
+	Result run(ThreadPool &pool) const;
+
+	/**
+	 * @brief Get the alert level of a raw temperature.
+	 *
+	 * @param raw The Temperature Register value.
+	 * @return Level The level against the limits of the options.
+	 */
+	Level classify(Register raw) const;
+
+	inline const Options &getOptions() const { return options; }
+	inline size_t		  getSegments() const { return readers.size(); }
+
+private:
+	struct Partial;
+
+	std::vector<std::string>					paths;
+	Options										options;
+	std::vector<std::unique_ptr<SegmentReader>> readers;
+	bool										empty = true;
+	SensorId									firstSensor{};
+	SensorId									lastSensor{};
+	Timestamp									from{};
+	Timestamp									to{};
+
+	void process(const Shard &shard, Partial &partial) const;
+};
@@ -0,0 +1,202 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_BusModel.hpp
+ * @brief			: TMP116 I2C Bus Utilisation Model and Admission Control
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <vector>
+
+/**
+ * @brief Model of the I2C bus occupancy generated by a fleet of TMP116 devices sharing a bus.
+ *
+ * @details The model counts the SCL clock cycles of each transaction shape issued by the TMP116 driver and combines
+ * these with the poll period of each device to estimate the fraction of bus time consumed. Poll policies are admitted
+ * against a budget fraction of the bus, and policies which would exceed it are degraded or rejected.
+ * @note Clock stretching, arbitration and bus free time between transactions are not modelled.
+ */
+class TMP116::BusModel {
+public:
+	/**
+	 * @brief TMP116 driver operations which generate I2C traffic.
+	 */
+	enum class Operation : uint8_t {
+		GET_TEMPERATURE,	// getTemperature(): One register read.
+		GET_DEVICE_ID,		// getDeviceId(): One register read.
+		DATA_READY,			// dataReady(): One register read.
+		SET_CONFIG,			// setConfig(Config): One register write.
+		SET_CONFIG_PARTIAL, // setConfig(...) with some parameters: One register read and one register write.
+		SET_LIMIT,			// setHighLimit() or setLowLimit(): One register write.
+	};
+
+	/**
+	 * @brief Polling policy of a single TMP116 on the bus.
+	 */
+	struct PollPolicy {
+		Config					config{};			   // Configuration of the TMP116, which sets the conversion period.
+		std::optional<Duration> period = std::nullopt; // Minimum poll period. Polling faster than conversion is ignored.
+		bool					pollDataReady = false; // True if dataReady() is called before each getTemperature().
+
+		/**
+		 * @brief Get the effective poll period of the policy.
+		 *
+		 * @return Duration The larger of the requested poll period and the conversion period of the configuration.
+		 */
+		Duration getPeriod() const;
+	};
+
+	/**
+	 * @brief Construct a new BusModel object
+	 *
+	 * @param clockFrequency The SCL clock frequency of the bus in Hz. Zero is taken as 1 Hz.
+	 * @param budget The fraction of bus time (0.0 to 1.0) which admitted policies may occupy.
+	 */
+	explicit BusModel(uint32_t clockFrequency = 100'000u, float budget = 0.5f);
+
+	/**
+	 * @brief Get the number of SCL clock cycles for a driver operation.
+	 *
+	 * @param operation The driver operation.
+	 * @return uint32_t The number of clock cycles, including START, repeated START and STOP conditions.
+	 */
+	static constexpr uint32_t getClockCycles(Operation operation) {
+		// Read:  S + Address(W) + Pointer + Sr + Address(R) + MSB + LSB + P, with 9 cycles per byte (incl. ACK).
+		// Write: S + Address(W) + Pointer + MSB + LSB + P.
+		constexpr uint32_t readCycles  = 1u + 9u + 9u + 1u + 9u + 9u + 9u + 1u;
+		constexpr uint32_t writeCycles = 1u + 9u + 9u + 9u + 9u + 1u;
+
+		switch (operation) {
+		case Operation::GET_TEMPERATURE:
+		case Operation::GET_DEVICE_ID:
+		case Operation::DATA_READY: return readCycles;
+		case Operation::SET_CONFIG:
+		case Operation::SET_LIMIT: return writeCycles;
+		case Operation::SET_CONFIG_PARTIAL: return readCycles + writeCycles;
+		default: return 0u;
+		}
+	}
+
+	/**
+	 * @brief Get the bus time occupied by a driver operation.
+	 *
+	 * @param operation The driver operation.
+	 * @return Duration The bus time of the operation at the bus clock frequency, rounded up.
+	 */
+	Duration getTransactionTime(Operation operation) const;
+
+	/**
+	 * @brief Get the bus time occupied by a single poll under a policy.
+	 *
+	 * @param policy The poll policy.
+	 * @return Duration The bus time of one poll, rounded up.
+	 */
+	Duration getPollTime(const PollPolicy &policy) const;
+
+	/**
+	 * @brief Get the expected bus occupancy of a policy.
+	 *
+	 * @param policy The poll policy.
+	 * @return float The fraction of bus time consumed by the policy.
+	 */
+	float getOccupancy(const PollPolicy &policy) const;
+
+	/**
+	 * @brief Get the expected bus occupancy of all admitted policies.
+	 *
+	 * @return float The fraction of bus time consumed by the admitted policies.
+	 */
+	float getOccupancy() const;
+
+	/**
+	 * @brief Fit a poll policy within the remaining bus budget, without admitting it.
+	 *
+	 * @param policy The requested poll policy.
+	 * @return std::optional<PollPolicy> The policy as it would be admitted. @see admit() for details.
+	 */
+	std::optional<PollPolicy> fit(PollPolicy policy) const;
+
+	/**
+	 * @brief Admit a poll policy to the bus.
+	 *
+	 * @param policy The requested poll policy.
+	 * @return std::optional<PollPolicy> The admitted policy if successful. This may be degraded to a slower conversion
+	 * 		   cycle time than requested if the requested policy would exceed the bus budget. std::nullopt if even the
+	 * 		   slowest conversion cycle time would exceed the budget.
+	 */
+	std::optional<PollPolicy> admit(PollPolicy policy);
+
+	/**
+	 * @brief Remove all admitted policies from the model.
+	 */
+	void clear();
+
+	inline uint32_t					  getClockFrequency() const { return clockFrequency; }
+	inline float					  getBudget() const { return budget; }
+	inline const std::vector<PollPolicy> &getPolicies() const { return policies; }
+
+private:
+	uint32_t				clockFrequency;
+	float					budget;
+	std::vector<PollPolicy> policies;
+
+	uint32_t getPollCycles(const PollPolicy &policy) const;
+};
+
+/**
+ * @brief I2C decorator which measures the bus traffic of the TMP116 drivers using it.
+ *
+ * @details The monitor is placed between the TMP116 drivers and the concrete I2C interface, forwarding all
+ * transactions while counting them. The measured occupancy may then be compared live against the BusModel estimate.
+ */
+class TMP116::BusMonitor : public TMP116::I2C {
+public:
+	/**
+	 * @brief Construct a new BusMonitor object
+	 *
+	 * @param i2c The concrete I2C interface to forward transactions to.
+	 * @param model The bus model, providing the clock frequency and expected occupancy.
+	 */
+	BusMonitor(I2C &i2c, const BusModel &model);
+
+	std::optional<Register> read(DeviceAddress deviceAddress, MemoryAddress memoryAddress) override;
+	std::optional<Register> write(DeviceAddress deviceAddress, MemoryAddress memoryAddress, Register data) override;
+
+	/**
+	 * @brief Get the measured bus occupancy since the last reset.
+	 *
+	 * @param elapsed The time elapsed since the last reset.
+	 * @return float The fraction of bus time consumed by the transactions issued, including failed transactions.
+	 */
+	float getOccupancy(Duration elapsed) const;
+
+	/**
+	 * @brief Get the difference between the measured and expected bus occupancy.
+	 *
+	 * @param elapsed The time elapsed since the last reset.
+	 * @return float The measured occupancy less the occupancy expected by the model. Positive if the bus is busier
+	 * 		   than modelled.
+	 */
+	float getOccupancyError(Duration elapsed) const;
+
+	/**
+	 * @brief Reset the transaction counters.
+	 */
+	void reset();
+
+	inline uint32_t getReads() const { return reads; }
+	inline uint32_t getWrites() const { return writes; }
+	inline uint32_t getFailures() const { return failures; }
+
+private:
+	I2C			   &i2c;
+	const BusModel &model;
+
+	uint32_t reads	  = 0u;
+	uint32_t writes	  = 0u;
+	uint32_t failures = 0u;
+};
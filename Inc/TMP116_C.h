@@ -0,0 +1,212 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_C.h
+ * @brief			: TMP116 Batch C API for Foreign Language Bindings
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Stable C interface to a fleet of TMP116 devices, for bindings from other languages.
+ *
+ * @details Every call operates on a batch of sensors or samples held in arrays owned by the caller, so that a binding
+ * crosses the language boundary once per batch rather than once per sensor. Handles are opaque, structures are plain C,
+ * and no C++ exception crosses the interface. Sensors are identified by the index returned when they are added. Calls
+ * given a NULL handle, or a NULL array required for a count above zero, do nothing and return 0 (-1 for a sensor).
+ * @note Calls on the same fleet must not run concurrently. A sample ring may be drained concurrently with its producer.
+ * @note Also built as the shared library TMP116_C (CMake option TMP116_C_SHARED), exporting only these functions, to be
+ * loaded by bindings or linked by C programs.
+ */
+
+// Exported from the shared library, whose other symbols are hidden.
+#if defined(__GNUC__)
+#define TMP116_C_API __attribute__((visibility("default")))
+#else
+#define TMP116_C_API
+#endif
+
+// Version of the binary interface, incremented on any incompatible change to the functions or structures below.
+#define TMP116_C_ABI_VERSION 1u
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get the version of the binary interface of the library loaded.
+ *
+ * @return uint32_t The TMP116_C_ABI_VERSION the library was built with. Bindings should refuse a version other than
+ * the one they were written against.
+ */
+TMP116_C_API uint32_t TMP116_getAbiVersion(void);
+
+typedef uint16_t TMP116_SensorId;
+
+/**
+ * @brief A raw sample, as a plain C structure of TMP116::Sample without its trace.
+ */
+typedef struct TMP116_Sample {
+	int64_t			timestamp; // Microseconds since an application defined epoch.
+	TMP116_SensorId sensorId;
+	uint16_t		raw;	  // Temperature Register value, two's complement at 0.0078125 degrees Celsius per LSB.
+	uint32_t		reserved; // Zero. Pads the structure to 16 bytes, so that its layout is explicit for bindings.
+} TMP116_Sample;
+
+/**
+ * @brief I2C bus implemented by the caller. @see TMP116::I2C.
+ */
+typedef struct TMP116_Bus {
+	void *context; // Passed to each callback.
+
+	// Read a register of the device at a 7-bit address. Returns 0 and sets data if successful, otherwise non-zero.
+	int (*read)(void *context, uint8_t deviceAddress, uint8_t memoryAddress, uint16_t *data);
+
+	// Write a register of the device at a 7-bit address. Returns 0 if successful, otherwise non-zero.
+	int (*write)(void *context, uint8_t deviceAddress, uint8_t memoryAddress, uint16_t data);
+} TMP116_Bus;
+
+typedef struct TMP116_Fleet		 TMP116_Fleet;
+typedef struct TMP116_SampleRing TMP116_SampleRing; // A TMP116::Ring<TMP116::Sample>, such as of a TMP116::Worker.
+
+/**
+ * @brief Create an empty fleet.
+ *
+ * @return TMP116_Fleet* The fleet, or NULL if out of memory. Destroy with TMP116_Fleet_destroy().
+ */
+TMP116_C_API TMP116_Fleet *TMP116_Fleet_create(void);
+
+TMP116_C_API void TMP116_Fleet_destroy(TMP116_Fleet *fleet);
+
+/**
+ * @brief Add a sensor to a fleet.
+ *
+ * @param fleet The fleet.
+ * @param bus The bus of the sensor, copied. Its context must outlive the fleet.
+ * @param deviceAddress The 7-bit address of the sensor, 0x48 to 0x4B.
+ * @return int32_t The identifier of the sensor, or -1 if the bus or address is invalid or out of memory.
+ */
+TMP116_C_API int32_t TMP116_Fleet_addSensor(TMP116_Fleet *fleet, const TMP116_Bus *bus, uint8_t deviceAddress);
+
+TMP116_C_API size_t TMP116_Fleet_getSensors(const TMP116_Fleet *fleet);
+
+/**
+ * @brief Read the temperatures of a batch of sensors.
+ *
+ * @param fleet The fleet.
+ * @param sensors The identifiers of the sensors to read.
+ * @param count The number of sensors.
+ * @param temperatures The temperature of each sensor in degrees Celsius, or NaN where the read failed.
+ * @return size_t The number of sensors read successfully.
+ */
+TMP116_C_API size_t TMP116_Fleet_readTemperatures(
+	TMP116_Fleet *fleet, const TMP116_SensorId *sensors, size_t count, float *temperatures
+);
+
+/**
+ * @brief Sample a batch of sensors, such as to feed other tools with raw values.
+ *
+ * @param fleet The fleet.
+ * @param sensors The identifiers of the sensors to read.
+ * @param count The number of sensors.
+ * @param timestamp The timestamp given to every sample.
+ * @param samples The samples read, in order of the sensors, skipping those which failed. Holds at least count.
+ * @return size_t The number of samples written.
+ */
+TMP116_C_API size_t TMP116_Fleet_sample(
+	TMP116_Fleet *fleet, const TMP116_SensorId *sensors, size_t count, int64_t timestamp, TMP116_Sample *samples
+);
+
+/**
+ * @brief Read the Config Registers of a batch of sensors.
+ *
+ * @param fleet The fleet.
+ * @param sensors The identifiers of the sensors to read.
+ * @param count The number of sensors.
+ * @param configs The Config Register value of each sensor, or 0 where the read failed.
+ * @param succeeded Optional. Set to 1 for each sensor read successfully, otherwise 0.
+ * @return size_t The number of sensors read successfully.
+ */
+TMP116_C_API size_t TMP116_Fleet_readConfigs(
+	TMP116_Fleet *fleet, const TMP116_SensorId *sensors, size_t count, uint16_t *configs, uint8_t *succeeded
+);
+
+/**
+ * @brief Write the configuration of a batch of sensors. @see TMP116::setConfig().
+ *
+ * @param fleet The fleet.
+ * @param sensors The identifiers of the sensors to write.
+ * @param count The number of sensors.
+ * @param configs The Config Register value for each sensor. Read-only flags are ignored.
+ * @param succeeded Optional. Set to 1 for each sensor written successfully, otherwise 0.
+ * @return size_t The number of sensors written successfully.
+ */
+TMP116_C_API size_t TMP116_Fleet_applyConfigs(
+	TMP116_Fleet *fleet, const TMP116_SensorId *sensors, size_t count, const uint16_t *configs, uint8_t *succeeded
+);
+
+/**
+ * @brief Write the low and high limits of a batch of sensors. @see TMP116::setLowLimit() and TMP116::setHighLimit().
+ *
+ * @param fleet The fleet.
+ * @param sensors The identifiers of the sensors to write.
+ * @param count The number of sensors.
+ * @param low The low limit of each sensor in degrees Celsius.
+ * @param high The high limit of each sensor in degrees Celsius.
+ * @param succeeded Optional. Set to 1 for each sensor with both limits written successfully, otherwise 0.
+ * @return size_t The number of sensors with both limits written successfully.
+ */
+TMP116_C_API size_t TMP116_Fleet_setLimits(
+	TMP116_Fleet		  *fleet,
+	const TMP116_SensorId *sensors,
+	size_t				   count,
+	const float			  *low,
+	const float			  *high,
+	uint8_t				  *succeeded
+);
+
+/**
+ * @brief Drain the samples of a ring. Consumer only.
+ *
+ * @param ring The ring.
+ * @param samples The samples drained, oldest first.
+ * @param capacity The most samples to drain.
+ * @return size_t The number of samples drained.
+ */
+TMP116_C_API size_t TMP116_SampleRing_drain(TMP116_SampleRing *ring, TMP116_Sample *samples, size_t capacity);
+
+/**
+ * @brief Drain the samples of several rings, such as those of the workers of every bus, in one call.
+ *
+ * @param rings The rings, drained in turn. Consumer only.
+ * @param count The number of rings.
+ * @param samples The samples drained, ring by ring and oldest first within each.
+ * @param capacity The most samples to drain in total.
+ * @return size_t The number of samples drained.
+ */
+TMP116_C_API size_t TMP116_SampleRing_drainAll(
+	TMP116_SampleRing *const *rings, size_t count, TMP116_Sample *samples, size_t capacity
+);
+
+TMP116_C_API size_t TMP116_SampleRing_size(const TMP116_SampleRing *ring);
+
+#ifdef __cplusplus
+}
+
+#include "TMP116.hpp"
+#include "TMP116_Ring.hpp"
+
+/**
+ * @brief Get the handle of a ring, for C++ hosts passing the rings of their workers to foreign callers.
+ *
+ * @param ring The ring. Must outlive the handle.
+ * @return TMP116_SampleRing* The handle.
+ */
+inline TMP116_SampleRing *TMP116_SampleRing_handle(TMP116::Ring<TMP116::Sample> &ring) {
+	return reinterpret_cast<TMP116_SampleRing *>(&ring);
+}
+#endif
@@ -0,0 +1,98 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ChangePublisher.hpp
+ * @brief			: TMP116 Change-Only Sample Publisher with Deadband Suppression
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <vector>
+
+/**
+ * @brief Suppresses samples which have not changed significantly since the last sample published for their sensor.
+ *
+ * @details A sample is published when its raw temperature register value differs from the last published value of its
+ * sensor by more than the deadband of the sensor, or when the heartbeat interval has expired since the last published
+ * sample, so that consumers can distinguish a stable sensor from a silent one. The first sample of each sensor is
+ * always published. offer() is compatible with TMP116::Pipeline::Function for use as a pipeline stage.
+ * @note Sensor identifiers must be less than the number of sensors given at construction.
+ */
+class TMP116::ChangePublisher {
+public:
+	/**
+	 * @brief Publication counters.
+	 */
+	struct Statistics {
+		uint64_t received	= 0u; // Samples offered.
+		uint64_t published	= 0u; // Samples published, including heartbeats.
+		uint64_t heartbeats = 0u; // Samples published only due to the heartbeat interval expiring.
+		uint64_t suppressed = 0u; // Samples suppressed.
+
+		/**
+		 * @brief Get the fraction of samples suppressed.
+		 *
+		 * @return float The suppressed fraction of samples received, or 0.0 if none received.
+		 */
+		inline float getSuppression() const {
+			return received ? static_cast<float>(suppressed) / static_cast<float>(received) : 0.0f;
+		}
+	};
+
+	/**
+	 * @brief Construct a new ChangePublisher object
+	 *
+	 * @param sensors The number of sensors.
+	 * @param deadband The initial deadband of all sensors in LSBs of the Temperature Register (0.0078125 C).
+	 * @param heartbeat The longest interval between samples published for a sensor.
+	 */
+	ChangePublisher(size_t sensors, uint16_t deadband, Duration heartbeat);
+
+	/**
+	 * @brief Set the deadband of a sensor.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param deadband The deadband in LSBs of the Temperature Register. 0 publishes every change.
+	 * @return bool True if set, false if the sensor identifier is out of range.
+	 */
+	bool setDeadband(SensorId sensorId, uint16_t deadband);
+
+	/**
+	 * @brief Offer a sample for publication.
+	 *
+	 * @param sample The sample.
+	 * @return std::optional<Sample> The sample if it is to be published, otherwise std::nullopt.
+	 */
+	std::optional<Sample> offer(const Sample &sample);
+
+	/**
+	 * @brief Get the publication counters of a sensor.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return std::optional<Statistics> The counters, or std::nullopt if the sensor identifier is out of range.
+	 */
+	std::optional<Statistics> getStatistics(SensorId sensorId) const;
+
+	/**
+	 * @brief Get the publication counters of all sensors.
+	 *
+	 * @return Statistics The total counters.
+	 */
+	inline const Statistics &getStatistics() const { return total; }
+
+private:
+	struct Channel {
+		uint16_t   deadband;
+		bool	   published = false;			  // True once a sample has been published.
+		int16_t	   raw		 = 0;				  // Raw value of the last sample published.
+		Timestamp  timestamp = Timestamp::zero(); // Time of the last sample published.
+		Statistics statistics{};
+	};
+
+	Duration			 heartbeat;
+	std::vector<Channel> channels;
+	Statistics			 total{};
+};
@@ -0,0 +1,162 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ColumnarExporter.hpp
+ * @brief			: TMP116 Columnar Sample Batch Export in the Apache Arrow Memory Format
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Apache Arrow C Data Interface, as defined by the Arrow specification. Guarded so that it may coexist with the
+// definitions of Arrow itself and other producers.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE			  2
+#define ARROW_FLAG_MAP_KEYS_SORTED	  4
+
+struct ArrowSchema {
+	const char			*format;
+	const char			*name;
+	const char			*metadata;
+	int64_t				 flags;
+	int64_t				 n_children;
+	struct ArrowSchema **children;
+	struct ArrowSchema	*dictionary;
+	void (*release)(struct ArrowSchema *);
+	void *private_data;
+};
+
+struct ArrowArray {
+	int64_t			   length;
+	int64_t			   null_count;
+	int64_t			   offset;
+	int64_t			   n_buffers;
+	int64_t			   n_children;
+	const void		 **buffers;
+	struct ArrowArray **children;
+	struct ArrowArray  *dictionary;
+	void (*release)(struct ArrowArray *);
+	void *private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+/**
+ * @brief Accumulates samples into columnar batches laid out in the Apache Arrow memory format.
+ *
+ * @details A batch is a struct array of three columns:
+ * - "timestamp": timestamp[us] (int64), never null.
+ * - "sensor_id": dictionary of uint16 sensor identifiers with int32 indices, never null.
+ * - "raw": int16 Temperature Register values, null where a read failed.
+ *
+ * Column buffers are 64-byte aligned and padded to multiples of 64 bytes, and validity bitmaps are LSB first, as Arrow
+ * requires. Full batches are handed over through the Arrow C Data Interface without copying, after which the exporter
+ * continues into freshly allocated buffers. Consumers such as pyarrow import them with RecordBatch._import_from_c(),
+ * and may write them as Arrow IPC unchanged.
+ */
+class TMP116::ColumnarExporter {
+public:
+	static constexpr size_t ALIGNMENT = 64u; // Alignment and padding of all buffers.
+
+	/**
+	 * @brief Construct a new ColumnarExporter object
+	 *
+	 * @param batchSize The number of samples in each batch. Larger batches amortise the export per batch, smaller
+	 * 					batches reduce the latency to consumers and the memory held.
+	 */
+	explicit ColumnarExporter(size_t batchSize);
+
+	/**
+	 * @brief Append a sample to the batch.
+	 *
+	 * @param sample The sample.
+	 * @return bool True if appended, false if the batch is full.
+	 */
+	bool append(const Sample &sample);
+
+	/**
+	 * @brief Append a failed read to the batch, with a null raw value.
+	 *
+	 * @param sensorId The sensor identifier.
+	 * @param timestamp The time of the failed read.
+	 * @return bool True if appended, false if the batch is full.
+	 */
+	bool appendMissing(SensorId sensorId, Timestamp timestamp);
+
+	/**
+	 * @brief Append samples to the batch until it is full.
+	 *
+	 * @param samples The samples.
+	 * @param count The number of samples.
+	 * @return size_t The number of samples appended.
+	 */
+	size_t append(const Sample *samples, size_t count);
+
+	/**
+	 * @brief Export the schema of the batches.
+	 *
+	 * @param schema The schema to initialise. Owned by the caller, who must call its release callback.
+	 */
+	static void exportSchema(ArrowSchema *schema);
+
+	/**
+	 * @brief Export the batch and start a new one. The buffers of the batch are transferred, not copied.
+	 *
+	 * @param array The array to initialise. Owned by the caller, who must call its release callback.
+	 * @return bool True if exported, false if the batch is empty.
+	 */
+	bool exportBatch(ArrowArray *array);
+
+	/**
+	 * @brief Discard the batch.
+	 */
+	void clear();
+
+	inline size_t size() const { return length; }
+	inline size_t capacity() const { return batchSize; }
+	inline bool	  isFull() const { return length == batchSize; }
+
+	inline const int64_t  *getTimestamps() const { return reinterpret_cast<const int64_t *>(timestamps.get()); }
+	inline const int32_t  *getIndices() const { return reinterpret_cast<const int32_t *>(indices.get()); }
+	inline const int16_t  *getRaw() const { return reinterpret_cast<const int16_t *>(raw.get()); }
+	inline const uint8_t  *getValidity() const { return validity.get(); }
+	inline const SensorId *getDictionary() const { return reinterpret_cast<const SensorId *>(dictionary.get()); }
+	inline size_t		   getDictionarySize() const { return dictionarySize; }
+	inline size_t		   getNullCount() const { return nullCount; }
+
+	/**
+	 * @brief Deleter of buffers allocated with ALIGNMENT.
+	 */
+	struct Deallocate {
+		void operator()(uint8_t *buffer) const;
+	};
+
+	using Buffer = std::unique_ptr<uint8_t[], Deallocate>;
+
+private:
+	const size_t batchSize;
+
+	Buffer timestamps;
+	Buffer indices;
+	Buffer raw;
+	Buffer validity;
+	Buffer dictionary;
+
+	size_t length		  = 0u;
+	size_t nullCount	  = 0u;
+	size_t dictionarySize = 0u;
+
+	std::vector<uint32_t> lookup; // Dictionary index + 1 of each sensor identifier in the batch, or 0 if absent.
+
+	void allocate();
+	void appendRow(SensorId sensorId, Timestamp timestamp);
+};
@@ -0,0 +1,147 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Compactor.hpp
+ * @brief			: TMP116 Background Compaction of Sample Log Segments
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Compacts the sealed sample log segments of a directory in the background, by policy.
+ *
+ * @details Each pass deletes the segments whose samples have all expired, then rewrites a batch of the remaining
+ * segments which are small, hold expired samples, or hold samples old enough to downsample. Samples older than the
+ * downsampling age are replaced by one mean sample per sensor and rollup interval, written to a segment flagged
+ * Segment::DOWNSAMPLED with the count of samples averaged, and newer samples are copied to a raw segment. Samples
+ * arriving late for an interval already downsampled are folded into its mean, weighted by count, when rewritten with
+ * its segment, such as while it is small. Otherwise the interval keeps a second mean. Reads and writes are rate
+ * limited.
+ *
+ * Segments which are not sealed, such as that of an acquisition thread still appending, are never touched, and the
+ * compactor shares no locks with writers. Outputs are written under a temporary name and renamed into place once
+ * durable, before their inputs are unlinked, so SegmentReaders already open keep reading the old files. Outputs left
+ * under a temporary name by an abandoned pass or a crash are removed by the next pass, so a directory must be compacted
+ * by one Compactor at a time.
+ * @note A reader listing the directory between the rename and unlink may see samples of both, and should prefer the
+ * newer segment.
+ * @note Requires POSIX. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::Compactor {
+public:
+	struct Policy {
+		uint64_t smallSegment	 = 4u << 20u;				 // Sealed segments of fewer bytes of blocks are merged.
+		uint64_t maxRewrite		 = 256u << 20u;				 // Most bytes of input rewritten in one pass.
+		Duration downsampleAfter = Duration::max();			 // Age from which samples are downsampled. Never if max.
+		Duration rollupInterval	 = std::chrono::minutes{1};	 // Interval of each downsampled sample.
+		Duration retention		 = Duration::max();			 // Age from which samples are deleted. Never if max.
+		uint64_t bytesPerSecond	 = 16u << 20u;				 // Limit of bytes read and written. Unlimited if 0.
+		size_t	 blockCapacity	 = 4096u;					 // Block capacity of the segments written.
+		Duration period			 = std::chrono::seconds{60}; // Interval between passes of the background thread.
+
+		/**
+		 * @brief The current time, from which ages are measured. Defaults to Worker::now() if empty.
+		 */
+		std::function<Timestamp()> clock{};
+	};
+
+	struct Statistics {
+		uint64_t passes				= 0u; // Passes completed.
+		uint64_t segmentsRewritten	= 0u; // Input segments rewritten and removed.
+		uint64_t segmentsWritten	= 0u; // Output segments written.
+		uint64_t segmentsDeleted	= 0u; // Segments removed with all samples expired.
+		uint64_t samplesExpired		= 0u; // Samples deleted.
+		uint64_t samplesDownsampled = 0u; // Raw samples replaced by downsampled samples.
+		uint64_t bytesRead			= 0u;
+		uint64_t bytesWritten		= 0u;
+	};
+
+	/**
+	 * @brief Construct a new Compactor object
+	 *
+	 * @param directory The directory of the segment files, named with the extension ".seg".
+	 * @param policy The compaction policy.
+	 */
+	Compactor(std::string directory, Policy policy);
+
+	Compactor(const Compactor &)			= delete;
+	Compactor &operator=(const Compactor &) = delete;
+
+	/**
+	 * @brief Destroy the Compactor object, stopping the background thread.
+	 */
+	~Compactor();
+
+	/**
+	 * @brief Start the background thread, compacting once every period.
+	 *
+	 * @return bool True if started. False if already running.
+	 */
+	bool start();
+
+	/**
+	 * @brief Stop the background thread, abandoning any rewrite in progress, and wait for it to exit.
+	 */
+	void stop();
+
+	/**
+	 * @brief Compact once on the calling thread.
+	 *
+	 * @return Statistics The work of the pass.
+	 */
+	Statistics compact();
+
+	/**
+	 * @brief Get the work of all passes.
+	 *
+	 * @return Statistics The totals of all passes.
+	 */
+	Statistics getStatistics() const;
+
+	inline bool isRunning() const { return running.load(std::memory_order_acquire); }
+
+private:
+	struct Entry;
+	struct Output;
+	struct Cursor;
+	class Throttle;
+
+	std::string directory;
+	Policy		policy;
+	uint64_t	sequence = 0u; // Number of outputs named, making their names unique.
+
+	std::mutex				compacting{}; // Held by a pass.
+	mutable std::mutex		mutex{};
+	std::condition_variable wakeup{};
+	std::thread				thread{};
+	std::atomic<bool>		running{false};
+	std::atomic<bool>		stopping{false};
+	Statistics				totals{};
+
+	std::vector<Entry> list() const;
+	bool rewrite(
+		const std::vector<Entry> &inputs,
+		Timestamp				  retain,
+		Timestamp				  downsample,
+		Throttle				 &throttle,
+		Statistics				 &pass
+	);
+	bool		read(Cursor &cursor, Throttle &throttle, Statistics &pass);
+	bool		append(Output &output, const Sample &sample, Throttle &throttle, uint32_t count = 0u);
+	bool		finish(Output &output, Statistics &pass, std::vector<std::string> &outputs);
+	std::string name();
+	bool wait(std::chrono::steady_clock::time_point until);
+	void run();
+};
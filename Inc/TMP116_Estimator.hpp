@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Estimator.hpp
+ * @brief			: TMP116 Kalman Temperature Estimation with Averaging-Aware Noise
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <vector>
+
+/**
+ * @brief Filtered temperature estimates of the sensors of a fleet, with their variance, by a bank of scalar Kalman
+ * filters.
+ *
+ * @details Each sensor is modelled as a temperature drifting as a random walk, measured with white noise. The
+ * measurement variance of a sensor follows the Averages of its configuration, falling by N when averaging N
+ * conversions, plus the variance of rounding to the resolution. The process variance of a sensor is its drift rate over
+ * its sample interval, by default its conversion period, so that slower sampling trusts each estimate less. Samples are
+ * staged per sensor as they arrive, and each tick predicts every sensor over its interval and corrects those with a
+ * staged sample.
+ * @note The state of the fleet is held as arrays per quantity, so that each tick is a single branch-free pass which
+ * compilers vectorise. Ticks should match the sample interval of each sensor, as each tick adds one interval of drift.
+ * @note Sensor identifiers must be less than the number of sensors given at construction.
+ */
+class TMP116::Estimator {
+public:
+	struct Options {
+		float noise	   = 6.0f;	 // Standard deviation of a single conversion in LSBs, before averaging.
+		float drift	   = 1e-4f;	 // Process variance in degrees Celsius squared per second.
+		float variance = 1e4f;	 // Variance of the estimate of a sensor before its first sample.
+	};
+
+	/**
+	 * @brief The estimate of a single sensor.
+	 */
+	struct Estimate {
+		float value;	// Temperature in degrees Celsius.
+		float variance; // Variance of the temperature in degrees Celsius squared.
+		float gain;		// Kalman gain of the last tick, zero without a sample.
+	};
+
+	/**
+	 * @brief Construct a new Estimator object
+	 *
+	 * @param sensors The number of sensors, all initially configured by the default TMP116 configuration.
+	 * @param options The noise model.
+	 */
+	Estimator(size_t sensors, Options options);
+	explicit Estimator(size_t sensors);
+
+	/**
+	 * @brief Set the configuration of a sensor, which sets its measurement and process variances.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param config The configuration of the TMP116.
+	 * @param interval The interval between samples of the sensor, or its conversion period if std::nullopt.
+	 * @return bool True if set, false if the sensor identifier is out of range.
+	 */
+	bool configure(SensorId sensorId, const Config &config, std::optional<Duration> interval = std::nullopt);
+
+	/**
+	 * @brief Stage a sample for the next tick, replacing any sample of its sensor already staged.
+	 *
+	 * @param sample The sample.
+	 * @return bool True if staged, false if the sensor identifier is out of range.
+	 */
+	bool observe(const Sample &sample);
+
+	/**
+	 * @brief Predict every sensor over its interval, and correct those with a sample staged since the last tick.
+	 */
+	void tick();
+
+	/**
+	 * @brief Restart the estimate of a sensor from the initial variance, such as after it is replaced.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return bool True if reset, false if the sensor identifier is out of range.
+	 */
+	bool reset(SensorId sensorId);
+
+	/**
+	 * @brief Get the estimate of a sensor as of the last tick.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return std::optional<Estimate> The estimate, or std::nullopt if the sensor identifier is out of range.
+	 */
+	std::optional<Estimate> getEstimate(SensorId sensorId) const;
+
+	/**
+	 * @brief Get the estimates of all sensors as of the last tick, indexed by sensor identifier.
+	 *
+	 * @return const std::vector<float>& The temperatures in degrees Celsius.
+	 */
+	inline const std::vector<float> &getValues() const { return value; }
+
+	/**
+	 * @brief Get the variances of the estimates of all sensors as of the last tick, indexed by sensor identifier.
+	 *
+	 * @return const std::vector<float>& The variances in degrees Celsius squared.
+	 */
+	inline const std::vector<float> &getVariances() const { return variance; }
+
+	inline size_t size() const { return value.size(); }
+
+private:
+	Options options;
+
+	// Staged samples.
+	std::vector<float> staged; // Temperature in degrees Celsius.
+	std::vector<float> fresh;  // One if staged since the last tick, otherwise zero.
+
+	// Noise model of each sensor.
+	std::vector<float> measurementVariance;
+	std::vector<float> processVariance; // Per tick.
+
+	// State of each sensor.
+	std::vector<float> value;
+	std::vector<float> variance;
+	std::vector<float> gain;
+};
@@ -0,0 +1,107 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_FilterBank.hpp
+ * @brief			: TMP116 FIR and IIR Filter Bank Vectorised Across Sensors
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <vector>
+
+/**
+ * @brief Applies the same FIR filter, or cascade of biquad IIR sections, to many channels of samples at once.
+ *
+ * @details Samples are processed in frames of one sample per channel, such as one tick of the fleet. Filter state is
+ * held in a struct-of-arrays layout, with each delay of each section contiguous across channels, so that each step of
+ * the filter is a loop over channels which compilers vectorise, filling every SIMD lane with a different channel. Raw
+ * Temperature Register values are converted to degrees Celsius in the same pass as the first step of the filter. The
+ * FIR history is a ring of frames, so that each frame writes one row rather than shifting every delay.
+ * @note All state is allocated at construction. Channels without a fresh sample should be given their last sample.
+ */
+class TMP116::FilterBank {
+public:
+	/**
+	 * @brief Coefficients of a biquad section, normalised so that a0 is 1.
+	 *
+	 * @details y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+	 */
+	struct Biquad {
+		float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f;
+		float a1 = 0.0f, a2 = 0.0f;
+
+		/**
+		 * @brief Design a second order Butterworth-style low-pass section by the bilinear transform.
+		 *
+		 * @param cutoff The cutoff frequency in Hz.
+		 * @param sampleRate The sample rate of each channel in Hz, such as the inverse of the conversion period.
+		 * @param q The quality factor. 0.7071 is maximally flat.
+		 * @return Biquad The coefficients, with unity gain at DC.
+		 */
+		static Biquad lowPass(float cutoff, float sampleRate, float q = 0.70710678f);
+	};
+
+	/**
+	 * @brief Construct a new FIR FilterBank object
+	 *
+	 * @param channels The number of channels.
+	 * @param taps The taps of the filter, applied to the newest sample first. Must not be empty.
+	 */
+	FilterBank(size_t channels, std::vector<float> taps);
+
+	/**
+	 * @brief Construct a new IIR FilterBank object
+	 *
+	 * @param channels The number of channels.
+	 * @param sections The biquad sections, applied in order. Must not be empty.
+	 */
+	FilterBank(size_t channels, std::vector<Biquad> sections);
+
+	/**
+	 * @brief Convert and filter a frame of raw samples.
+	 *
+	 * @param raw The Temperature Register value of each channel.
+	 * @param output The filtered temperature of each channel in degrees Celsius. May not overlap raw.
+	 */
+	void process(const Register *raw, float *output);
+
+	/**
+	 * @brief Convert and filter consecutive frames of raw samples.
+	 *
+	 * @param raw The frames, each of one Temperature Register value per channel.
+	 * @param frames The number of frames.
+	 * @param output The filtered frames, each of one temperature per channel in degrees Celsius.
+	 */
+	void process(const Register *raw, size_t frames, float *output);
+
+	/**
+	 * @brief Prime the state of all channels as though each had been steady at a temperature, avoiding the transient
+	 * from zero.
+	 *
+	 * @param raw The Temperature Register value of each channel.
+	 */
+	void prime(const Register *raw);
+
+	/**
+	 * @brief Reset the state of all channels to zero.
+	 */
+	void reset();
+
+	inline size_t getChannels() const { return channels; }
+	inline bool	  isRecursive() const { return !sections.empty(); }
+
+private:
+	size_t channels;
+
+	// FIR: history[row * channels + channel], where row head holds the newest input.
+	std::vector<float> taps;
+	std::vector<float> history;
+	size_t			   head = 0u;
+
+	// IIR: state[(section * 2 + delay) * channels + channel] of the transposed direct form II.
+	std::vector<Biquad> sections;
+	std::vector<float>	state;
+};
@@ -0,0 +1,64 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Formatter.hpp
+ * @brief			: TMP116 Fixed-Point Decimal Formatting of Temperatures
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <cstddef>
+
+/**
+ * @brief Formats raw Temperature Register values as decimal degrees Celsius, without floating point.
+ *
+ * @details The Temperature Register holds a two's complement value with 7 fractional bits (0.0078125 C per LSB), so
+ * every value has an exact decimal representation of at most 7 fractional digits. Values are formatted exactly with 7
+ * decimals, or rounded half away from zero to fewer decimals, using integer arithmetic and a two digit lookup table.
+ */
+class TMP116::Formatter {
+public:
+	static constexpr uint8_t EXACT_DECIMALS = 7u;  // Decimals required to represent every value exactly.
+	static constexpr size_t	 MAX_LENGTH		= 12u; // Longest formatted value, being "-256.0000000".
+
+	/**
+	 * @brief Result of formatting a batch of values.
+	 */
+	struct Result {
+		size_t values; // Number of values formatted.
+		size_t length; // Number of characters written.
+	};
+
+	/**
+	 * @brief Format a single value.
+	 *
+	 * @param raw The Temperature Register value.
+	 * @param buffer The buffer to write to, of at least MAX_LENGTH characters. Not null terminated.
+	 * @param decimals The number of decimals, from 0 to EXACT_DECIMALS. Larger values are limited to EXACT_DECIMALS.
+	 * @return size_t The number of characters written.
+	 */
+	static size_t format(Register raw, char *buffer, uint8_t decimals = EXACT_DECIMALS);
+
+	/**
+	 * @brief Format a batch of values, each followed by a separator.
+	 *
+	 * @param raws The Temperature Register values.
+	 * @param count The number of values.
+	 * @param buffer The buffer to write to. Not null terminated.
+	 * @param size The size of the buffer. Formatting stops at the first value and separator which do not fit.
+	 * @param decimals The number of decimals. @see format().
+	 * @param separator The character written after each value.
+	 * @return Result The number of values formatted and characters written.
+	 */
+	static Result format(
+		const Register *raws,
+		size_t			count,
+		char		   *buffer,
+		size_t			size,
+		uint8_t			decimals  = EXACT_DECIMALS,
+		char			separator = '\n'
+	);
+};
@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Fusion.hpp
+ * @brief			: TMP116 Redundant Sensor Fusion by Median Voting
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <array>
+#include <vector>
+
+/**
+ * @brief Fuses the readings of redundancy sets of up to four sensors into one value per set, by median voting.
+ *
+ * @details Each tick takes the latest reading of every member of every set, sorts the readings of each set with a
+ * sorting network, and takes the median of the members read. With three or four members the median equals the mean
+ * trimmed of the lowest and highest readings, so a single faulty sensor cannot skew the fused value. Members further
+ * than the tolerance from the fused value are flagged as outliers, and a set disagrees when no strict majority of its
+ * members read agree. Sets are held as arrays per member slot, so each step of the tick is a branch-free loop over all
+ * sets which compilers vectorise.
+ * @note Sensor identifiers must be less than the number of sensors given at construction.
+ */
+class TMP116::Fusion {
+public:
+	static constexpr size_t MEMBERS = 4u; // Largest redundancy set.
+
+	using Set = std::vector<SensorId>;
+
+	/**
+	 * @brief The fused value of a redundancy set.
+	 */
+	struct Result {
+		float	value;		  // Median of the members read in degrees Celsius, or NaN if none were read.
+		float	spread;		  // Difference between the highest and lowest readings of the members read.
+		uint8_t read;		  // Members with a reading.
+		uint8_t agreeing;	  // Members read within the tolerance of the value.
+		uint8_t outliers;	  // Bit i set if member i was read beyond the tolerance of the value.
+		bool	disagreement; // True if the members agreeing are not a strict majority of the members read.
+	};
+
+	/**
+	 * @brief Construct a new Fusion object
+	 *
+	 * @param sensors The number of sensors. All sensors are initially without a reading.
+	 * @param sets The members of each redundancy set, of at most MEMBERS sensors each. Larger sets are truncated.
+	 * @param tolerance The largest deviation of an agreeing member from the fused value in degrees Celsius.
+	 */
+	Fusion(size_t sensors, const std::vector<Set> &sets, float tolerance = 0.5f);
+
+	/**
+	 * @brief Update the reading of a sensor.
+	 *
+	 * @param sample The latest sample of the sensor.
+	 * @return bool True if updated, false if the sensor identifier is out of range.
+	 */
+	bool update(const Sample &sample);
+
+	/**
+	 * @brief Clear the reading of a sensor, such as when it is stale.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return bool True if cleared, false if the sensor identifier is out of range.
+	 */
+	bool clear(SensorId sensorId);
+
+	/**
+	 * @brief Fuse the current readings of every set.
+	 */
+	void tick();
+
+	/**
+	 * @brief Get the fused value of a set as of the last tick.
+	 *
+	 * @param set The index of the set.
+	 * @return std::optional<Result> The result, or std::nullopt if the set does not exist.
+	 */
+	std::optional<Result> getResult(size_t set) const;
+
+	/**
+	 * @brief Get the fused values of all sets as of the last tick.
+	 *
+	 * @return const std::vector<float>& The value of each set in degrees Celsius, or NaN.
+	 */
+	inline const std::vector<float> &getValues() const { return fused; }
+
+	inline size_t getSets() const { return fused.size(); }
+	inline size_t getSensors() const { return readings.size() - 1u; }
+
+private:
+	float tolerance;
+
+	std::vector<float> readings; // Latest reading of each sensor, and a final entry always without a reading.
+	std::vector<float> values;	 // Readings, or above all readings without a reading. Scratch of tick().
+	std::vector<float> present;	 // One with a reading, or zero. Scratch of tick().
+
+	// members[slot][set], the sensor in each member slot of each set, or the final reading for empty slots.
+	std::array<std::vector<uint32_t>, MEMBERS> members;
+
+	// Scratch of each tick.
+	std::array<std::vector<float>, MEMBERS> gathered;
+	std::array<std::vector<float>, MEMBERS> sorted;
+	std::vector<float>						counts; // Members read of each set.
+
+	// Results of each set, held as floats so that tick() vectorises across them.
+	std::vector<float> fused;
+	std::vector<float> spreads;
+	std::vector<float> agreeing;
+	std::vector<float> outliers; // Sum of the bits of the outlying members.
+};
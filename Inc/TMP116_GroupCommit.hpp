@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_GroupCommit.hpp
+ * @brief			: TMP116 Group Commit Durable Sample Writer
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+#include "TMP116_JitterRecorder.hpp"
+#include "TMP116_Segment.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Writes the samples of many producers to a segment, making them durable in groups.
+ *
+ * @details Producers append samples to a shared buffer under a short lock, never waiting on I/O. A commit thread takes
+ * the whole buffer once it holds a batch of samples, or once its oldest sample has waited the longest delay, writes it
+ * to the segment and makes it durable with a single fdatasync(), so the cost of a sync is shared by every sample of the
+ * group. Producers needing durability get a future completed by the commit of their samples. The latency from the first
+ * sample of a group being appended to the group being durable is recorded.
+ * @note Larger batches and delays raise throughput at the cost of commit latency.
+ * @note Requires POSIX. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::GroupCommitWriter {
+public:
+	struct Options {
+		size_t	 batchSize	   = 4096u;							// Samples pending which start a commit.
+		Duration maxDelay	   = std::chrono::milliseconds{10}; // Longest a sample waits before a commit starts.
+		size_t	 capacity	   = 65536u;						// Most samples pending. Appends beyond are refused.
+		size_t	 blockCapacity = 4096u;							// Block capacity of the segment.
+	};
+
+	struct Statistics {
+		uint64_t commits  = 0u; // Groups made durable.
+		uint64_t samples  = 0u; // Samples made durable.
+		uint64_t refused  = 0u; // Samples refused with the buffer full.
+		uint64_t failures = 0u; // Groups which could not be written or synced.
+		size_t	 largest  = 0u; // Samples of the largest group.
+	};
+
+	/**
+	 * @brief Construct a new GroupCommitWriter object
+	 *
+	 * @param path The path of the segment file, which is replaced.
+	 * @param options The commit thresholds. The buffer is allocated at construction.
+	 */
+	GroupCommitWriter(std::string path, Options options);
+
+	GroupCommitWriter(const GroupCommitWriter &)			= delete;
+	GroupCommitWriter &operator=(const GroupCommitWriter &) = delete;
+
+	/**
+	 * @brief Destroy the GroupCommitWriter object, committing the samples pending and sealing the segment.
+	 */
+	~GroupCommitWriter();
+
+	/**
+	 * @brief Open the segment and start the commit thread.
+	 *
+	 * @details A writer is started once. After stop(), or once a commit has failed, a new writer with a new path must
+	 * be created to continue, as reopening the segment would truncate the samples already made durable.
+	 * @return bool True if started. False if already running, started before, or the segment could not be opened.
+	 */
+	bool start();
+
+	/**
+	 * @brief Commit the samples pending, seal the segment and stop the commit thread.
+	 */
+	void stop();
+
+	/**
+	 * @brief Append samples, to be made durable by a later commit.
+	 *
+	 * @param samples The samples.
+	 * @param count The number of samples.
+	 * @return bool True if appended. False if not running, or if the buffer cannot hold all samples, in which case
+	 * 		   none are appended.
+	 */
+	bool append(const Sample *samples, size_t count);
+	inline bool append(const Sample &sample) { return append(&sample, 1u); }
+
+	/**
+	 * @brief Append samples, getting a future of their durability.
+	 *
+	 * @param samples The samples.
+	 * @param count The number of samples.
+	 * @return std::future<bool> Completed with true once the samples are durable, or false if they were refused or
+	 * 		   their commit failed.
+	 */
+	std::future<bool> appendDurable(const Sample *samples, size_t count);
+
+	/**
+	 * @brief Commit the samples appended so far without waiting for the thresholds, and wait until durable.
+	 *
+	 * @return bool True if all samples appended so far are durable. False once any commit has failed, after which the
+	 * 		   segment is abandoned and no further samples are made durable. The writer must then be recreated.
+	 */
+	bool flush();
+
+	/**
+	 * @brief Get the latency of commits.
+	 *
+	 * @return JitterRecorder The time from the first sample of each group being appended to the group being durable.
+	 */
+	JitterRecorder getCommitLatency() const;
+
+	Statistics getStatistics() const;
+
+	inline bool				  isRunning() const { return running.load(std::memory_order_acquire); }
+	inline const std::string &getPath() const { return writer.getPath(); }
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	Options		  options;
+	SegmentWriter writer;
+
+	mutable std::mutex				mutex{};
+	std::condition_variable			pendingReady{}; // Signals the commit thread.
+	std::condition_variable			committed{};	// Signals flush().
+	std::vector<Sample>				pending{};
+	std::vector<std::promise<bool>> promises{};		// Of the samples pending.
+	Clock::time_point				oldest{};		// Time the first sample pending was appended.
+	uint64_t						appended  = 0u; // Samples appended.
+	uint64_t						durable	  = 0u; // Samples appended and committed, durable or failed.
+	uint64_t						requested = 0u; // Samples appended which flush() requires committed.
+	bool							failed	  = false; // A commit failed, so no later samples are made durable.
+	bool							stopping  = false;
+	bool							started	  = false; // Started before, so never restarted.
+	Statistics						statistics{};
+	JitterRecorder					latency{};
+
+	std::thread		  thread{};
+	std::atomic<bool> running{false};
+
+	bool enqueue(const Sample *samples, size_t count, std::promise<bool> *promise);
+	void run();
+};
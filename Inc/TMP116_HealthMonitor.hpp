@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_HealthMonitor.hpp
+ * @brief			: TMP116 Stuck and Noisy Sensor Detection
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <vector>
+
+/**
+ * @brief Online health classification of the sensors of a fleet from their raw sample stream.
+ *
+ * @details Samples are staged per sensor as they arrive, and each tick updates every sensor at once. A sensor is stuck
+ * once it repeats an identical raw value for a run longer than expected of its noise floor, and noisy once too many of
+ * its steps between samples are implausibly large against its noise floor. The noise floor follows the Averages of the
+ * configuration of each sensor, falling by sqrt(N) when averaging N conversions. Device ID verifications are kept over
+ * the last VERIFICATIONS attempts. The health score of a sensor is the product of the three, from 1.0 when healthy to
+ * 0.0 when stuck, noisy or failing verification.
+ * @note The state of the fleet is held as arrays per quantity, so that each tick is a branch-free pass over each array
+ * which compilers vectorise. Only the last sample staged for a sensor is seen by each tick, so ticks should be at least
+ * as frequent as the fastest conversion period.
+ * @note Sensor identifiers must be less than the number of sensors given at construction.
+ */
+class TMP116::HealthMonitor {
+public:
+	static constexpr uint32_t VERIFICATIONS = 8u; // Device ID verifications remembered per sensor.
+
+	enum class Status : uint8_t {
+		UNKNOWN,	// No samples compared yet.
+		HEALTHY,	// Neither stuck, noisy nor failing verification.
+		STUCK,		// Repeating an identical raw value.
+		NOISY,		// Stepping by implausible amounts.
+		UNVERIFIED, // The last Device ID verification failed.
+	};
+
+	struct Options {
+		float	 noise		= 6.0f;		 // Noise of a single conversion in LSBs, before averaging.
+		uint32_t stuckRun	= 256u;		 // Identical values repeated without averaging before stuck. Scaled by sqrt(N).
+		float	 stepFactor = 32.0f;	 // Multiple of the noise floor (at least 1 LSB) beyond which a step is implausible.
+		float	 noisyRate	= 0.05f;	 // Fraction of implausible steps at which a sensor is noisy.
+		float	 smoothing	= 0.015625f; // Weight of each step in the moving fraction of implausible steps.
+	};
+
+	/**
+	 * @brief The health of a single sensor.
+	 */
+	struct Health {
+		Status	 status;
+		float	 score;		 // From 1.0 when healthy to 0.0.
+		uint32_t run;		 // Consecutive samples identical to the first of the run, excluding it.
+		float	 stepRate;	 // Moving fraction of steps which were implausible.
+		uint32_t failures;	 // Failed Device ID verifications of the last VERIFICATIONS.
+		float	 noiseFloor; // Noise of results of the configured Averages in LSBs.
+	};
+
+	/**
+	 * @brief Construct a new HealthMonitor object
+	 *
+	 * @param sensors The number of sensors, all initially configured by the default TMP116 configuration.
+	 * @param options The detection thresholds.
+	 */
+	HealthMonitor(size_t sensors, Options options);
+	explicit HealthMonitor(size_t sensors);
+
+	/**
+	 * @brief Set the configuration of a sensor, which sets its noise floor.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param config The configuration of the TMP116.
+	 * @return bool True if set, false if the sensor identifier is out of range.
+	 */
+	bool configure(SensorId sensorId, const Config &config);
+
+	/**
+	 * @brief Stage a sample for the next tick, replacing any sample of its sensor already staged.
+	 *
+	 * @param sample The sample.
+	 * @return bool True if staged, false if the sensor identifier is out of range.
+	 */
+	bool observe(const Sample &sample);
+
+	/**
+	 * @brief Record a Device ID verification of a sensor.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param deviceId The result of TMP116::getDeviceId(), passing if its 12-bit device identifier is 0x116.
+	 * @return bool True if recorded, false if the sensor identifier is out of range.
+	 */
+	bool verify(SensorId sensorId, std::optional<Register> deviceId);
+
+	/**
+	 * @brief Update the health of all sensors from the samples staged since the last tick.
+	 */
+	void tick();
+
+	/**
+	 * @brief Get the health of a sensor as of the last tick.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return std::optional<Health> The health, or std::nullopt if the sensor identifier is out of range.
+	 */
+	std::optional<Health> getHealth(SensorId sensorId) const;
+
+	/**
+	 * @brief Get the health scores of all sensors as of the last tick, indexed by sensor identifier.
+	 *
+	 * @return const std::vector<float>& The scores.
+	 */
+	inline const std::vector<float> &getScores() const { return score; }
+
+	inline size_t size() const { return score.size(); }
+
+private:
+	Options options;
+
+	// Staged samples.
+	std::vector<int32_t> staged;
+	std::vector<int32_t> fresh;
+
+	// State of each sensor.
+	std::vector<int32_t>  last;
+	std::vector<int32_t>  seen;
+	std::vector<uint32_t> run;
+	std::vector<float>	  stepRate;
+	std::vector<uint8_t>  verifications; // Bit i set if the i-th last verification failed.
+	std::vector<uint8_t>  verified;		 // Verifications recorded, up to VERIFICATIONS.
+
+	// Thresholds and results of each sensor.
+	std::vector<float>	 noiseFloor;
+	std::vector<int32_t> stepLimit;
+	std::vector<float>	 runLimit;
+	std::vector<float>	 verifiedScore;
+	std::vector<float>	 score;
+};
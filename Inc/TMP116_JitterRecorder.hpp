@@ -0,0 +1,65 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_JitterRecorder.hpp
+ * @brief			: TMP116 Read Timing Jitter Recorder
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <array>
+
+/**
+ * @brief Records the lateness of actual read times against planned read times.
+ *
+ * @details Lateness is accumulated into a fixed logarithmic histogram, where bucket 0 holds reads less than 1us late
+ * (including early reads) and bucket i holds reads between 2^(i-1)us and 2^i us late. Recording never allocates.
+ */
+class TMP116::JitterRecorder {
+public:
+	static constexpr size_t BUCKETS = 32u;
+
+	/**
+	 * @brief Record a read.
+	 *
+	 * @param planned The time the read was planned for.
+	 * @param actual The time the read occurred.
+	 */
+	void record(Timestamp planned, Timestamp actual);
+
+	/**
+	 * @brief Get the upper bound of the lateness below which a fraction of reads occurred.
+	 *
+	 * @param fraction The fraction of reads, from 0.0 to 1.0.
+	 * @return Duration The upper bound of the histogram bucket containing the fraction, or zero if empty.
+	 */
+	Duration getPercentile(float fraction) const;
+
+	/**
+	 * @brief Get the mean lateness of all reads.
+	 *
+	 * @return Duration The mean lateness, or zero if empty. Negative if reads are early on average.
+	 */
+	Duration getMean() const;
+
+	/**
+	 * @brief Reset all recorded reads.
+	 */
+	void reset();
+
+	inline uint32_t getCount() const { return count; }
+	inline Duration getMin() const { return min; }
+	inline Duration getMax() const { return max; }
+	inline uint32_t getBucket(size_t bucket) const { return bucket < BUCKETS ? buckets[bucket] : 0u; }
+
+private:
+	std::array<uint32_t, BUCKETS> buckets{};
+
+	uint32_t count = 0u;
+	Duration sum   = Duration::zero();
+	Duration min   = Duration::max();
+	Duration max   = Duration::min();
+};
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_LatencyTracer.hpp
+ * @brief			: TMP116 Per-Hop Sample Latency Histograms
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+#include "TMP116_JitterRecorder.hpp"
+
+#include <string>
+
+/**
+ * @brief Accumulates the latency stamps of received samples into one histogram per hop, showing where samples wait.
+ *
+ * @details The histogram of a hop holds the time from the previous stamped point of each sample to the hop, where the
+ * timestamp of the sample (the start of its bus read) is a point between Trace::Hop::CONVERSION and Trace::Hop::READ.
+ * The histogram of Trace::Hop::CONVERSION holds the time from the conversion to the start of the read instead. Hops
+ * not stamped are skipped, so the time spent in them is attributed to the next stamped hop. The age of each sample is
+ * the time from its conversion, or its timestamp if not stamped, to its last stamp. Recording never allocates.
+ * @note Not thread safe. Each consumer thread should own a tracer.
+ */
+class TMP116::LatencyTracer {
+public:
+	using Hop = Trace::Hop;
+
+	/**
+	 * @brief Stamp the receipt of a sample by the consumer, and record its stamps.
+	 *
+	 * @param sample The sample received.
+	 * @param now The current time, on the same clock as the timestamp of the sample.
+	 */
+	void receive(Sample &sample, Timestamp now);
+
+	/**
+	 * @brief Record the stamps of a sample.
+	 *
+	 * @param sample The sample.
+	 */
+	void record(const Sample &sample);
+
+	/**
+	 * @brief Get the histogram of the time samples spent before reaching a hop.
+	 *
+	 * @param hop The hop.
+	 * @return const JitterRecorder& The histogram.
+	 */
+	inline const JitterRecorder &getHop(Hop hop) const { return hops[static_cast<size_t>(hop)]; }
+
+	/**
+	 * @brief Get the histogram of the age of samples at their last stamp, such as at receipt.
+	 *
+	 * @return const JitterRecorder& The histogram.
+	 */
+	inline const JitterRecorder &getAge() const { return age; }
+
+	/**
+	 * @brief Format a report of the count, mean, median, 99th percentile and maximum of each hop stamped and the age.
+	 *
+	 * @return std::string One line per hop, in microseconds.
+	 */
+	std::string report() const;
+
+	/**
+	 * @brief Reset all recorded samples.
+	 */
+	void reset();
+
+	/**
+	 * @brief Get the name of a hop.
+	 *
+	 * @param hop The hop.
+	 * @return const char* The name, such as "read" or "stage 0".
+	 */
+	static const char *getName(Hop hop);
+
+	inline uint32_t getCount() const { return age.getCount(); }
+
+private:
+	std::array<JitterRecorder, Trace::HOPS> hops{};
+	JitterRecorder							age{};
+};
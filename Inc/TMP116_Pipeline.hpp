@@ -0,0 +1,162 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Pipeline.hpp
+ * @brief			: TMP116 Staged Sample Processing Pipeline
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+#include "TMP116_Queue.hpp"
+#include "TMP116_ThreadPool.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Staged processing pipeline for samples, such as conversion, filtering, alerting, storage and export.
+ *
+ * @details Stages are connected by bounded lock-free queues and executed on a thread pool. Each stage is drained by at
+ * most one task at a time, so samples are processed in order within each stage. When a queue is full, the backpressure
+ * policy of the receiving stage decides whether the oldest sample is dropped, the sending stage waits, or incoming
+ * samples are down-sampled. Samples are pushed into the pipeline without ever blocking, so that a slow stage cannot
+ * delay bus reads on the acquisition thread. Samples are stamped with Trace::Hop::ENQUEUE when pushed, and with the exit
+ * of each of the first Trace::STAGES stages.
+ * @note Requires threads. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::Pipeline {
+public:
+	/**
+	 * @brief Policy applied when a sample is sent to a stage whose queue is full.
+	 */
+	enum class Backpressure : uint8_t {
+		DROP_OLDEST, // The oldest queued sample is dropped.
+		BLOCK,		 // The sending stage waits for space. Samples pushed into the pipeline are dropped instead.
+		SAMPLE_DOWN, // Once the queue is half full, only one in every sampleDown samples is accepted.
+	};
+
+	/**
+	 * @brief Function of a stage.
+	 *
+	 * @return std::optional<Sample> The sample passed to the next stage, or std::nullopt if consumed or filtered out.
+	 */
+	using Function = std::function<std::optional<Sample>(const Sample &sample)>;
+
+	struct StageOptions {
+		size_t		 capacity	  = 1024u;					   // Minimum number of samples queued for the stage.
+		Backpressure backpressure = Backpressure::DROP_OLDEST; // Policy when the queue is full.
+		uint32_t	 sampleDown	  = 4u;						   // Down-sampling ratio of Backpressure::SAMPLE_DOWN.
+		size_t		 batch		  = 64u;					   // Samples processed per task before yielding the thread.
+	};
+
+	/**
+	 * @brief Throughput and latency counters of a stage.
+	 */
+	struct Statistics {
+		uint64_t processed	 = 0u;				 // Samples processed by the stage function.
+		uint64_t emitted	 = 0u;				 // Samples queued for the next stage, excluding those it dropped.
+		uint64_t dropped	 = 0u;				 // Samples dropped by the backpressure policy of the stage.
+		Duration meanLatency = Duration::zero(); // Mean time from queueing for the stage to the function completing.
+		Duration maxLatency	 = Duration::zero(); // Largest time from queueing for the stage to the function completing.
+	};
+
+	/**
+	 * @brief Construct a new Pipeline object
+	 *
+	 * @param pool The thread pool executing the stages. Must outlive the pipeline.
+	 */
+	explicit Pipeline(ThreadPool &pool);
+
+	Pipeline(const Pipeline &)			  = delete;
+	Pipeline &operator=(const Pipeline &) = delete;
+
+	/**
+	 * @brief Destroy the Pipeline object, after all queued samples have been processed.
+	 */
+	~Pipeline();
+
+	/**
+	 * @brief Append a stage to the pipeline.
+	 *
+	 * @param function The function of the stage.
+	 * @param options The queue and backpressure options of the stage.
+	 * @return size_t The index of the stage.
+	 * @note All stages must be added before the first sample is pushed.
+	 */
+	size_t addStage(Function function, StageOptions options);
+	size_t addStage(Function function);
+
+	/**
+	 * @brief Push a sample into the first stage of the pipeline. Never blocks.
+	 *
+	 * @param sample The sample.
+	 * @return bool True if queued, false if dropped.
+	 */
+	bool push(const Sample &sample);
+
+	/**
+	 * @brief Wait until all queued samples have been processed by all stages.
+	 */
+	void flush();
+
+	/**
+	 * @brief Get the counters of a stage.
+	 *
+	 * @param stage The index of the stage.
+	 * @return std::optional<Statistics> The counters if the stage exists.
+	 */
+	std::optional<Statistics> getStatistics(size_t stage) const;
+
+	inline size_t size() const { return stages.size(); }
+
+private:
+	/**
+	 * @brief Result of offering a sample to a stage.
+	 */
+	enum class Offer : uint8_t {
+		QUEUED,	 // Queued for the stage.
+		DROPPED, // Dropped and counted by the backpressure policy of the stage.
+		FULL,	 // Refused by the full queue of a Backpressure::BLOCK stage, to be offered again.
+	};
+
+	struct Item {
+		Sample	  sample;
+		Timestamp queued;
+	};
+
+	struct Stage {
+		Function			function;
+		StageOptions		options;
+		Queue<Item>			queue;
+		std::optional<Item> stalled{}; // Output waiting for space in the next stage. Owned by the draining task.
+
+		std::atomic<bool>	  scheduled{false};
+		std::atomic<bool>	  blocked{false}; // Scheduled without a task, until the next stage frees space.
+		std::atomic<uint32_t> sampleDownCount{0u};
+		std::atomic<uint64_t> processed{0u};
+		std::atomic<uint64_t> emitted{0u};
+		std::atomic<uint64_t> dropped{0u};
+		std::atomic<uint64_t> latencySum{0u};
+		std::atomic<uint64_t> latencyMax{0u};
+
+		Stage(Function function, StageOptions options)
+			: function{std::move(function)}, options{options}, queue{options.capacity} {}
+	};
+
+	ThreadPool						   &pool;
+	std::vector<std::unique_ptr<Stage>> stages;
+	std::atomic<size_t>					tasks{0u}; // Tasks submitted to the pool and not yet returned.
+
+	Offer offer(size_t stage, const Item &item);
+	void schedule(size_t stage);
+	void submit(size_t stage);
+	void drain(size_t stage);
+	bool process(size_t stage);
+	bool isBusy() const;
+
+	static Timestamp now();
+};
@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Predictor.hpp
+ * @brief			: TMP116 Predictive Limit Alerts by Short Horizon Extrapolation
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Raises alerts before sensors cross their limits, by extrapolating a fit over their recent samples.
+ *
+ * @details Each sensor keeps a rolling window of its latest samples and the least-squares sums of a linear or
+ * quadratic fit over them. Each sample adds its terms to the sums and removes those of the sample it displaces, so the
+ * fit is updated in O(1) per sample regardless of the window. Times are taken from an origin within the window, which
+ * is moved to the oldest sample once per window by recomputing the sums, bounding both the magnitude of the terms and
+ * the rounding accumulated by their removal. The fit is solved by its normal equations, and extrapolated from the
+ * latest sample to the time at which it first meets the high or low limit of the sensor. An alert is raised when that
+ * time falls within the horizon, once until it next falls beyond it.
+ * @note Unlike the limits of the TMP116 itself, as set by TMP116::setHighLimit(), alerts precede the crossing.
+ * @note Sensor identifiers must be less than the number of sensors given at construction.
+ */
+class TMP116::Predictor {
+public:
+	enum class Fit : uint8_t {
+		LINEAR,	   // Constant rate of change.
+		QUADRATIC, // Constant acceleration, anticipating runaway sooner but noisier.
+	};
+
+	enum class Limit : uint8_t { HIGH, LOW };
+
+	struct Options {
+		size_t	 window	 = 16u; // Samples fitted. At least the terms of the fit.
+		Fit		 fit	 = Fit::LINEAR;
+		Duration horizon = std::chrono::seconds{60}; // Alert when a limit is projected to be met sooner than this.
+	};
+
+	/**
+	 * @brief The fit of a sensor, extrapolated from its latest sample.
+	 */
+	struct Forecast {
+		Timestamp				timestamp;	// Time of the latest sample.
+		float					value;		// Fitted temperature at that time in degrees Celsius.
+		float					slope;		// Rate of change in degrees Celsius per second.
+		float					curvature;	// Rate of change of the slope in degrees Celsius per second squared.
+		std::optional<Duration> timeToHigh; // Time until the fit meets the high limit, if ever.
+		std::optional<Duration> timeToLow;	// Time until the fit meets the low limit, if ever.
+	};
+
+	/**
+	 * @brief A limit projected to be met within the horizon.
+	 */
+	struct Alert {
+		SensorId  sensorId;
+		Timestamp timestamp; // Time of the sample raising the alert.
+		Limit	  limit;
+		Duration  timeToLimit; // Zero if the fit has already met the limit.
+		float	  value;	   // Fitted temperature in degrees Celsius.
+		float	  slope;	   // Rate of change in degrees Celsius per second.
+	};
+
+	/**
+	 * @brief Construct a new Predictor object
+	 *
+	 * @param sensors The number of sensors. All sensors are initially without limits.
+	 * @param options The window, fit and horizon.
+	 */
+	Predictor(size_t sensors, Options options);
+	explicit Predictor(size_t sensors);
+
+	/**
+	 * @brief Set the limits of a sensor, such as those of its TMP116.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param low The low limit in degrees Celsius, or -infinity for none.
+	 * @param high The high limit in degrees Celsius, or infinity for none.
+	 * @return bool True if set, false if the sensor identifier is out of range or the limits are not ordered.
+	 */
+	bool setLimits(SensorId sensorId, float low, float high);
+
+	/**
+	 * @brief Offer a sample, refitting its sensor and checking its limits.
+	 *
+	 * @param sample The sample, later than the last sample of its sensor.
+	 * @return std::optional<Alert> An alert if a limit is newly projected to be met within the horizon, otherwise
+	 * 		   std::nullopt, including for samples out of order or out of range.
+	 */
+	std::optional<Alert> offer(const Sample &sample);
+
+	/**
+	 * @brief Get the forecast of a sensor as of its latest sample.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return std::optional<Forecast> The forecast, or std::nullopt if out of range or too few samples are fitted.
+	 */
+	std::optional<Forecast> getForecast(SensorId sensorId) const;
+
+	/**
+	 * @brief Check whether a sensor has an alert raised, not yet cleared by its forecast leaving the horizon.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param limit The limit.
+	 * @return bool True if alerting, false if not or out of range.
+	 */
+	bool isAlerting(SensorId sensorId, Limit limit) const;
+
+	/**
+	 * @brief Discard the samples of a sensor, such as after a gap in its samples. Its limits are kept.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return bool True if reset, false if the sensor identifier is out of range.
+	 */
+	bool reset(SensorId sensorId);
+
+	inline size_t getSensors() const { return channels.size(); }
+
+private:
+	/**
+	 * @brief Least-squares sums of time t in seconds from the origin, and temperature y in degrees Celsius.
+	 */
+	struct Sums {
+		double n = 0.0, t = 0.0, t2 = 0.0, t3 = 0.0, t4 = 0.0, y = 0.0, ty = 0.0, t2y = 0.0;
+
+		void add(double t, double y, double sign);
+	};
+
+	struct Channel {
+		Sums	  sums{};
+		Timestamp origin{0};
+		size_t	  count = 0u; // Samples in the window.
+		size_t	  next	= 0u; // Slot of the next sample in the window.
+		float	  low	= -std::numeric_limits<float>::infinity();
+		float	  high	= std::numeric_limits<float>::infinity();
+		bool	  alerting[2] = {false, false}; // By Limit.
+	};
+
+	Options				   options;
+	std::vector<Channel>   channels;
+	std::vector<Timestamp> times; // times[sensor * window + slot], the window of each sensor.
+	std::vector<float>	   values;
+
+	void rebase(SensorId sensorId);
+};
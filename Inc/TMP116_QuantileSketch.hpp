@@ -0,0 +1,117 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_QuantileSketch.hpp
+ * @brief			: TMP116 Mergeable Quantile Sketches of Temperature Register Values
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Compact mergeable quantile sketch over the 16-bit Temperature Register domain.
+ *
+ * @details Raw register values are counted exactly in buckets of 2^shift LSBs, stored sparsely as sorted (bucket,
+ * count) pairs. As temperatures of a sensor cluster within a few degrees, few buckets are held. Quantiles are exact to
+ * the bucket width. Should the number of buckets exceed a limit, the sketch is compressed by doubling the bucket width
+ * and merging adjacent buckets. Sketches of any bucket width may be merged, across sensors or time windows, by first
+ * coarsening the finer sketch.
+ */
+class TMP116::QuantileSketch {
+public:
+	/**
+	 * @brief Construct a new QuantileSketch object
+	 *
+	 * @param shift The initial bucket width as a power of two of LSBs. 0 counts each register value exactly.
+	 * @param maxBuckets The number of buckets above which the sketch is compressed.
+	 */
+	explicit QuantileSketch(uint8_t shift = 0u, size_t maxBuckets = 256u);
+
+	/**
+	 * @brief Add a raw temperature register value to the sketch.
+	 *
+	 * @param raw The Temperature Register value.
+	 * @param count The number of occurrences of the value.
+	 */
+	void add(Register raw, uint32_t count = 1u);
+
+	/**
+	 * @brief Merge another sketch into this sketch.
+	 *
+	 * @param other The sketch to merge. The coarser bucket width of the two sketches is retained.
+	 */
+	void merge(const QuantileSketch &other);
+
+	/**
+	 * @brief Get a quantile of the values added.
+	 *
+	 * @param fraction The quantile, from 0.0 to 1.0. For example, 0.99 for p99.
+	 * @return std::optional<Register> The smallest register value of the bucket containing the quantile, or
+	 * 		   std::nullopt if the sketch is empty.
+	 */
+	std::optional<Register> getQuantile(float fraction) const;
+
+	/**
+	 * @brief Remove all values from the sketch, retaining the bucket width.
+	 */
+	void clear();
+
+	inline uint64_t getCount() const { return count; }
+	inline uint8_t	getShift() const { return shift; }
+	inline size_t	getBuckets() const { return buckets.size(); }
+
+private:
+	uint8_t									  shift;
+	size_t									  maxBuckets;
+	uint64_t								  count = 0u;
+	std::vector<std::pair<int32_t, uint64_t>> buckets; // Sorted (register value >> shift, count) pairs.
+
+	void coarsen(uint8_t shift);
+};
+
+/**
+ * @brief Quantile sketch of the samples of a sensor over a sliding window of time.
+ *
+ * @details The window is divided into a ring of sub-windows, each holding a QuantileSketch. Samples are added to the
+ * sub-window containing their timestamp, and sub-windows are recycled as time advances. Quantiles over the window are
+ * taken by merging the current sub-windows.
+ */
+class TMP116::SlidingQuantileSketch {
+public:
+	/**
+	 * @brief Construct a new SlidingQuantileSketch object
+	 *
+	 * @param interval The length of each sub-window.
+	 * @param windows The number of sub-windows, so the window length is interval * windows.
+	 * @param shift The initial bucket width of each sub-window. @see QuantileSketch.
+	 * @param maxBuckets The number of buckets of each sub-window above which it is compressed.
+	 */
+	SlidingQuantileSketch(Duration interval, size_t windows, uint8_t shift = 0u, size_t maxBuckets = 256u);
+
+	/**
+	 * @brief Add a sample to the sketch.
+	 *
+	 * @param sample The sample. Samples older than the window are ignored.
+	 */
+	void add(const Sample &sample);
+
+	/**
+	 * @brief Get the sketch of all samples within the window.
+	 *
+	 * @param now The current time, being the end of the window.
+	 * @return QuantileSketch The merged sketch, which may be further merged with those of other sensors.
+	 */
+	QuantileSketch getWindow(Timestamp now) const;
+
+private:
+	Duration					interval;
+	std::vector<QuantileSketch> sketches;
+	std::vector<Timestamp>		starts;
+
+	size_t slot(Timestamp start) const;
+};
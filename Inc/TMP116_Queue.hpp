@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Queue.hpp
+ * @brief			: TMP116 Lock-Free Multiple Producer Multiple Consumer Bounded Queue
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Bounded lock-free queue with multiple producers and multiple consumers.
+ *
+ * @details Each cell carries a sequence number which producers and consumers claim with a compare and swap on the
+ * enqueue and dequeue positions respectively (D. Vyukov's bounded MPMC queue). Storage is allocated once at
+ * construction. Unlike TMP116::Ring, any thread may push or pop.
+ * @tparam T The element type. Must be default constructible and copy assignable.
+ */
+template <typename T>
+class TMP116::Queue {
+public:
+	/**
+	 * @brief Construct a new Queue object
+	 *
+	 * @param capacity The minimum number of elements held. Rounded up to a power of two, being at least 2.
+	 */
+	explicit Queue(size_t capacity) : size_{roundCapacity(capacity)}, mask{size_ - 1u}, cells{new Cell[size_]} {
+		for (size_t i = 0u; i < this->size_; i++) this->cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	Queue(const Queue &)			= delete;
+	Queue &operator=(const Queue &) = delete;
+
+	/**
+	 * @brief Push an element into the queue.
+	 *
+	 * @param element The element to push.
+	 * @return bool True if pushed, false if the queue is full.
+	 */
+	bool push(const T &element) {
+		size_t position = this->enqueue.load(std::memory_order_relaxed);
+		for (;;) {
+			Cell		  &cell		= this->cells[position & this->mask];
+			const size_t   sequence = cell.sequence.load(std::memory_order_acquire);
+			const intptr_t delta	= static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+			if (delta == 0) {
+				if (this->enqueue.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed)) {
+					cell.element = element;
+					cell.sequence.store(position + 1u, std::memory_order_release);
+					return true;
+				}
+			} else if (delta < 0) return false;
+			else position = this->enqueue.load(std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Pop an element from the queue.
+	 *
+	 * @return std::optional<T> The oldest element, or std::nullopt if the queue is empty.
+	 */
+	std::optional<T> pop() {
+		size_t position = this->dequeue.load(std::memory_order_relaxed);
+		for (;;) {
+			Cell		  &cell		= this->cells[position & this->mask];
+			const size_t   sequence = cell.sequence.load(std::memory_order_acquire);
+			const intptr_t delta	= static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1u);
+
+			if (delta == 0) {
+				if (this->dequeue.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed)) {
+					T element = cell.element;
+					cell.sequence.store(position + this->mask + 1u, std::memory_order_release);
+					return element;
+				}
+			} else if (delta < 0) return std::nullopt;
+			else position = this->dequeue.load(std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Get the number of elements in the queue.
+	 *
+	 * @return size_t The number of elements. Only approximate while the queue is in use by other threads.
+	 */
+	inline size_t size() const {
+		const size_t enqueued = this->enqueue.load(std::memory_order_acquire);
+		const size_t dequeued = this->dequeue.load(std::memory_order_acquire);
+		return enqueued > dequeued ? enqueued - dequeued : 0u;
+	}
+
+	inline size_t capacity() const { return this->size_; }
+
+private:
+	struct Cell {
+		std::atomic<size_t> sequence{0u};
+		T					element{};
+	};
+
+	const size_t			size_;
+	const size_t			mask;
+	std::unique_ptr<Cell[]> cells;
+
+	alignas(64) std::atomic<size_t> enqueue{0u};
+	alignas(64) std::atomic<size_t> dequeue{0u};
+
+	static size_t roundCapacity(size_t capacity) {
+		size_t rounded = 2u;
+		while (rounded < capacity) rounded <<= 1u;
+		return rounded;
+	}
+};
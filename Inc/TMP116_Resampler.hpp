@@ -0,0 +1,122 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Resampler.hpp
+ * @brief			: TMP116 Common Time Grid Resampling Across Sensors
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <vector>
+
+/**
+ * @brief Aligns the samples of many sensors, taken at ragged times, onto a common time grid.
+ *
+ * @details The grid has one row every interval from an origin, and one column per sensor. Each sample fills the cells
+ * of its sensor between its previous sample and itself, by linear interpolation or by holding the previous value, so
+ * that each sample is touched once. Rows are completed in order, either when every sensor has a sample at or after the
+ * row, or when the lookahead has passed since the row without samples from some sensors, whose cells then hold their
+ * last value. Pending rows are held in a ring of rows covering the lookahead, bounding memory and latency. Samples more
+ * than the maximum lead after the newest pending row, such as with corrupt timestamps, are dropped, so that one sample
+ * completes a bounded number of rows. advance() moves the grid past longer outages.
+ * @note Cells are NaN where a sensor has no sample within the maximum gap of the row, such as before its first sample.
+ * @note Sensor identifiers must be less than the number of sensors given at construction.
+ */
+class TMP116::Resampler {
+public:
+	enum class Interpolation : uint8_t {
+		LINEAR, // Linear between the samples either side of the row.
+		HOLD,	// The last sample at or before the row.
+	};
+
+	struct Options {
+		Duration	  interval		= std::chrono::seconds{1};	// Spacing of rows.
+		Timestamp	  origin		= Timestamp::zero();		// Time of row 0. Rows may precede it.
+		Duration	  lookahead		= std::chrono::seconds{2};	// Longest wait for the samples of a row.
+		Duration	  maxGap		= std::chrono::seconds{10}; // Longest gap between samples bridged.
+		Duration	  maxAhead		= std::chrono::hours{1};	// Longest a sample may follow the newest pending row.
+		Interpolation interpolation = Interpolation::LINEAR;
+	};
+
+	/**
+	 * @brief Completed rows, as a dense row-major matrix of time by sensor.
+	 */
+	struct Matrix {
+		size_t				   sensors = 0u;
+		std::vector<Timestamp> times{};	 // Time of each row.
+		std::vector<float>	   values{}; // Temperature of each sensor at each row, in degrees Celsius, or NaN.
+
+		inline size_t		getRows() const { return times.size(); }
+		inline float		at(size_t row, size_t sensor) const { return values[row * sensors + sensor]; }
+		inline const float *getRow(size_t row) const { return values.data() + row * sensors; }
+	};
+
+	/**
+	 * @brief Construct a new Resampler object
+	 *
+	 * @param sensors The number of sensors.
+	 * @param options The grid and interpolation options.
+	 */
+	Resampler(size_t sensors, Options options);
+	explicit Resampler(size_t sensors);
+
+	/**
+	 * @brief Offer a sample, filling the cells of its sensor up to its time and completing any rows then full.
+	 *
+	 * @param sample The sample. The first sample of all sensors sets the first row, being the first at or after it.
+	 * @return bool True if accepted, false if the sensor identifier is out of range, or the sample is not later than
+	 * 		   the last sample of its sensor or is more than the maximum lead after the newest pending row.
+	 */
+	bool offer(const Sample &sample);
+
+	/**
+	 * @brief Complete the rows whose lookahead has passed.
+	 *
+	 * @param now The current time, on the same clock as the timestamps of samples.
+	 * @return size_t The number of rows completed.
+	 */
+	size_t advance(Timestamp now);
+
+	/**
+	 * @brief Complete all rows filled by any sensor, such as at the end of a stream.
+	 *
+	 * @return size_t The number of rows completed.
+	 */
+	size_t flush();
+
+	/**
+	 * @brief Take the rows completed since the last drain.
+	 *
+	 * @return Matrix The rows, in order of time.
+	 */
+	Matrix drain();
+
+	inline size_t	getSensors() const { return channels.size(); }
+	inline uint64_t getDropped() const { return dropped; }
+
+private:
+	struct Channel {
+		bool	  seen = false;
+		Timestamp time{0};	   // Time of the last sample.
+		float	  value = 0.0f; // Temperature of the last sample.
+		int64_t	  next	= 0;	   // First row not yet filled.
+	};
+
+	Options				 options;
+	std::vector<Channel> channels;
+	size_t				 capacity;		  // Rows pending in the ring.
+	std::vector<float>	 rows;			  // Ring of pending rows, by row index modulo capacity.
+	std::vector<size_t>	 filled;		  // Cells filled of each pending row.
+	bool				 started = false; // True once the first row is set.
+	int64_t				 first	 = 0;	  // Index of the oldest pending row.
+	uint64_t			 dropped = 0u;
+	Matrix				 ready;
+
+	Timestamp getTime(int64_t row) const;
+	size_t	  getSlot(int64_t row) const;
+	float	  hold(const Channel &channel, Timestamp time) const;
+	void	  complete();
+};
@@ -0,0 +1,106 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Ring.hpp
+ * @brief			: TMP116 Lock-Free Single Producer Single Consumer Ring Buffer
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Bounded lock-free ring buffer with a single producer and a single consumer.
+ *
+ * @details Storage is allocated once at construction, so neither push() nor pop() allocate. The producer and consumer
+ * indices are kept on separate cache lines to avoid false sharing between the two threads.
+ * @tparam T The element type. Must be default constructible and copy assignable.
+ */
+template <typename T>
+class TMP116::Ring {
+public:
+	/**
+	 * @brief Construct a new Ring object
+	 *
+	 * @param capacity The minimum number of elements held. Rounded up to a power of two.
+	 */
+	explicit Ring(size_t capacity) : buffer(roundCapacity(capacity)), mask{buffer.size() - 1u} {}
+
+	Ring(const Ring &)			  = delete;
+	Ring &operator=(const Ring &) = delete;
+
+	/**
+	 * @brief Push an element into the ring. Producer only.
+	 *
+	 * @param element The element to push.
+	 * @return bool True if pushed, false if the ring is full.
+	 */
+	bool push(const T &element) {
+		const size_t head = this->head.load(std::memory_order_relaxed);
+		if (head - this->tail.load(std::memory_order_acquire) == this->buffer.size()) return false;
+
+		this->buffer[head & this->mask] = element;
+		this->head.store(head + 1u, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief Pop an element from the ring. Consumer only.
+	 *
+	 * @return std::optional<T> The oldest element, or std::nullopt if the ring is empty.
+	 */
+	std::optional<T> pop() {
+		const size_t tail = this->tail.load(std::memory_order_relaxed);
+		if (tail == this->head.load(std::memory_order_acquire)) return std::nullopt;
+
+		T element = this->buffer[tail & this->mask];
+		this->tail.store(tail + 1u, std::memory_order_release);
+		return element;
+	}
+
+	/**
+	 * @brief Pop up to count elements from the ring into an array. Consumer only.
+	 *
+	 * @param elements The array to write to.
+	 * @param count The maximum number of elements to pop.
+	 * @return size_t The number of elements popped.
+	 */
+	size_t pop(T *elements, size_t count) {
+		const size_t tail	   = this->tail.load(std::memory_order_relaxed);
+		const size_t available = this->head.load(std::memory_order_acquire) - tail;
+		if (count > available) count = available;
+
+		for (size_t i = 0u; i < count; i++) elements[i] = this->buffer[(tail + i) & this->mask];
+		this->tail.store(tail + count, std::memory_order_release);
+		return count;
+	}
+
+	/**
+	 * @brief Get the number of elements in the ring.
+	 *
+	 * @return size_t The number of elements. Only approximate while the ring is in use by other threads.
+	 */
+	inline size_t size() const {
+		return this->head.load(std::memory_order_acquire) - this->tail.load(std::memory_order_acquire);
+	}
+
+	inline size_t capacity() const { return this->buffer.size(); }
+
+private:
+	std::vector<T> buffer;
+	size_t		   mask;
+
+	alignas(64) std::atomic<size_t> head{0u}; // Written by the producer.
+	alignas(64) std::atomic<size_t> tail{0u}; // Written by the consumer.
+
+	static size_t roundCapacity(size_t capacity) {
+		size_t rounded = 1u;
+		while (rounded < capacity) rounded <<= 1u;
+		return rounded;
+	}
+};
@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Rollup.hpp
+ * @brief			: TMP116 Multi-Resolution Sample Rollups
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <vector>
+
+/**
+ * @brief Incrementally maintained aggregates of the sample stream at several time resolutions per sensor.
+ *
+ * @details Each resolution holds a fixed ring of buckets per sensor, each aggregating the min, max, sum, count and last
+ * raw temperature register values of the samples within its interval. Ingesting a sample updates one bucket per
+ * resolution, and querying a bucket is a single ring lookup, so both are O(1). Buckets are recycled as time advances,
+ * retaining the most recent intervals of each resolution.
+ * @note Sensor identifiers must be less than the number of sensors given at construction.
+ */
+class TMP116::Rollup {
+public:
+	/**
+	 * @brief Aggregate of the samples within one interval.
+	 */
+	struct Bucket {
+		Timestamp start = Timestamp::min(); // Start of the interval. Timestamp::min() if never used.
+		int16_t	  min	= 0;				// Smallest raw temperature register value.
+		int16_t	  max	= 0;				// Largest raw temperature register value.
+		int16_t	  last	= 0;				// Raw temperature register value of the latest sample.
+		uint32_t  count = 0u;				// Number of samples.
+		int64_t	  sum	= 0;				// Sum of raw temperature register values.
+
+		/**
+		 * @brief Get the mean temperature of the interval.
+		 *
+		 * @return float The mean temperature in degrees Celsius, or 0.0 if empty.
+		 */
+		float getMean() const;
+	};
+
+	/**
+	 * @brief A resolution at which samples are aggregated.
+	 */
+	struct Resolution {
+		Duration interval; // Length of each bucket.
+		size_t	 buckets;  // Number of buckets retained.
+	};
+
+	/**
+	 * @brief Construct a new Rollup object
+	 *
+	 * @param sensors The number of sensors. All storage is allocated at construction.
+	 * @param resolutions The resolutions maintained, for example 1s, 1min and 1h.
+	 */
+	Rollup(size_t sensors, std::vector<Resolution> resolutions);
+
+	/**
+	 * @brief Aggregate a sample into the buckets of every resolution.
+	 *
+	 * @param sample The sample.
+	 * @return bool True if aggregated. False if the sensor identifier is out of range, or the sample is older than all
+	 * 		   retained buckets of all resolutions.
+	 */
+	bool ingest(const Sample &sample);
+
+	/**
+	 * @brief Get the bucket containing a time.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param resolution The index of the resolution.
+	 * @param time The time within the bucket.
+	 * @return std::optional<Bucket> The bucket if it is retained and contains samples.
+	 */
+	std::optional<Bucket> getBucket(SensorId sensorId, size_t resolution, Timestamp time) const;
+
+	/**
+	 * @brief Get the buckets covering a time range.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param resolution The index of the resolution.
+	 * @param from The start of the time range.
+	 * @param to The end of the time range, inclusive.
+	 * @param buckets The array to write the buckets to, in time order. Empty and expired intervals are skipped.
+	 * @param count The size of the array.
+	 * @return size_t The number of buckets written.
+	 */
+	size_t getBuckets(SensorId sensorId, size_t resolution, Timestamp from, Timestamp to, Bucket *buckets, size_t count)
+		const;
+
+	inline size_t getSensors() const { return sensors; }
+	inline size_t getResolutions() const { return resolutions.size(); }
+
+private:
+	size_t					sensors;
+	std::vector<Resolution> resolutions;
+	std::vector<size_t>		offsets; // Offset of the buckets of each resolution within the buckets of a sensor.
+	size_t					stride;	 // Number of buckets per sensor.
+	std::vector<Bucket>		buckets;
+	std::vector<Timestamp>	latest; // Start of the latest bucket of each sensor and resolution.
+
+	const Bucket *locate(SensorId sensorId, size_t resolution, Timestamp start) const;
+	size_t		  slot(size_t resolution, Timestamp start) const;
+	Timestamp	  align(size_t resolution, Timestamp time) const;
+};
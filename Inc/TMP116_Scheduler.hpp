@@ -0,0 +1,119 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Scheduler.hpp
+ * @brief			: TMP116 Earliest Deadline First Poll Scheduler
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+#include "TMP116_BusModel.hpp"
+
+#include <vector>
+
+/**
+ * @brief Earliest Deadline First (EDF) poll scheduler for the TMP116 devices sharing a single I2C bus.
+ *
+ * @details Each sensor releases a job whenever a new conversion is expected to be available, being once per poll
+ * period of its policy. Each job must be read before its freshness deadline, relative to its release. On each call to
+ * poll(), the released job with the earliest absolute deadline is read. Jobs not read by their deadline are counted as
+ * misses, and the slack of jobs read in time is recorded, allowing buses to be sized against real guarantees.
+ * @note A single bus holds at most four TMP116 devices (one per address), so jobs are selected by a linear search.
+ */
+class TMP116::Scheduler {
+public:
+	/**
+	 * @brief Deadline statistics of a single sensor.
+	 */
+	struct Statistics {
+		uint32_t reads	  = 0u;				  // Jobs read successfully.
+		uint32_t failures = 0u;				  // Failed I2C transactions.
+		uint32_t misses	  = 0u;				  // Jobs not read before their deadline.
+		Duration minSlack = Duration::max();  // Smallest time remaining to the deadline of a job when read.
+		Duration sumSlack = Duration::zero(); // Sum of the slack of all jobs read, for the mean slack.
+
+		/**
+		 * @brief Get the mean slack of the jobs read.
+		 *
+		 * @return Duration The mean slack, or zero if no jobs have been read.
+		 */
+		inline Duration getMeanSlack() const { return reads ? sumSlack / reads : Duration::zero(); }
+	};
+
+	/**
+	 * @brief Construct a new Scheduler object
+	 *
+	 * @param model The bus model used to admit the poll policies of sensors added to the scheduler.
+	 */
+	explicit Scheduler(BusModel &model);
+
+	/**
+	 * @brief Add a sensor to the scheduler.
+	 *
+	 * @param sensorId The identifier used in samples read from the sensor.
+	 * @param sensor The TMP116 to poll. Must outlive the scheduler.
+	 * @param policy The requested poll policy, which is admitted by the bus model and written to the sensor.
+	 * @param deadline The freshness deadline of each job, relative to its release. Defaults to the poll period.
+	 * @param start The time of the first release.
+	 * @return std::optional<BusModel::PollPolicy> The admitted, possibly degraded, policy if successful. std::nullopt if
+	 * 		   the policy was rejected by the bus model or the configuration could not be written.
+	 */
+	std::optional<BusModel::PollPolicy> addSensor(
+		SensorId				sensorId,
+		TMP116				   &sensor,
+		BusModel::PollPolicy	policy,
+		std::optional<Duration> deadline = std::nullopt,
+		Timestamp				start	 = Timestamp::zero()
+	);
+
+	/**
+	 * @brief Read the released job with the earliest deadline.
+	 *
+	 * @param now The current time.
+	 * @return std::optional<Sample> The sample read if a job was released and read successfully, stamped with the
+	 * 		   release of its job as Trace::Hop::CONVERSION.
+	 */
+	std::optional<Sample> poll(Timestamp now);
+
+	/**
+	 * @brief Get the time of the next job release.
+	 *
+	 * @return std::optional<Timestamp> The earliest release time of all pending jobs, or std::nullopt if empty.
+	 * @note Callers may sleep until this time before calling poll().
+	 */
+	std::optional<Timestamp> getNextRelease() const;
+
+	/**
+	 * @brief Get the deadline statistics of a sensor.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return std::optional<Statistics> The statistics if the sensor is scheduled.
+	 */
+	std::optional<Statistics> getStatistics(SensorId sensorId) const;
+
+	/**
+	 * @brief Get the release time of the job read by the last successful poll().
+	 *
+	 * @return Timestamp The planned read time of the last sample, for comparison against its actual read time.
+	 */
+	inline Timestamp getLastRelease() const { return lastRelease; }
+
+	inline size_t size() const { return entries.size(); }
+
+private:
+	struct Entry {
+		SensorId   sensorId;
+		TMP116	  *sensor;
+		Duration   period;
+		Duration   deadline;
+		bool	   pollDataReady;
+		Timestamp  release;
+		Statistics statistics;
+	};
+
+	BusModel		  &model;
+	std::vector<Entry> entries;
+	Timestamp		   lastRelease = Timestamp::zero();
+};
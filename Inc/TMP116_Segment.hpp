@@ -0,0 +1,296 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Segment.hpp
+ * @brief			: TMP116 Sample Log Segment Files, Writer and Indexed Reader
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Format of sample log segment files, and queries over them.
+ *
+ * @details A segment file is a Header, followed by blocks of Records, each prefixed by a Block holding the count,
+ * checksum and the min and max timestamp, sensor identifier and raw value of its records. A sealed segment ends with an
+ * index of all blocks and a Trailer locating it, so a reader loads the statistics of every block with a single read. A
+ * segment which was not sealed, such as after a crash, is recovered by walking the block headers up to the first
+ * incomplete or corrupt block.
+ * @note Files are in host byte order.
+ * @note Requires POSIX. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::Segment {
+public:
+	static constexpr uint32_t MAGIC		  = 0x47455354u; // "TSEG" in little endian.
+	static constexpr uint32_t BLOCK_MAGIC = 0x4B4C4254u; // "TBLK" in little endian.
+	static constexpr uint16_t VERSION	  = 1u;
+
+	static constexpr uint16_t DOWNSAMPLED = 0x0001u; // Flag of segments holding one mean sample per interval.
+
+	struct Header {
+		uint32_t magic;			// MAGIC.
+		uint16_t version;		// VERSION.
+		uint16_t flags;			// Flags of the segment, such as DOWNSAMPLED.
+		uint32_t blockCapacity; // Most records in a block.
+		uint32_t reserved2;
+	};
+
+	struct Block {
+		uint32_t magic;			// BLOCK_MAGIC.
+		uint32_t count;			// Number of records following.
+		int64_t	 minTimestamp;	// Earliest timestamp of the records, in microseconds.
+		int64_t	 maxTimestamp;	// Latest timestamp of the records, in microseconds.
+		int16_t	 minRaw;		// Smallest Temperature Register value of the records.
+		int16_t	 maxRaw;		// Largest Temperature Register value of the records.
+		uint16_t firstSensor;	// Smallest sensor identifier of the records.
+		uint16_t lastSensor;	// Largest sensor identifier of the records.
+		uint32_t checksum;		// FNV-1a hash of the records.
+		uint32_t reserved;
+	};
+
+	struct Record {
+		int64_t	 timestamp; // Microseconds.
+		uint16_t sensorId;
+		uint16_t raw;		// Temperature Register value.
+		uint32_t count;		// Raw samples averaged, in DOWNSAMPLED segments. 0 if not downsampled or not recorded.
+	};
+
+	struct IndexEntry {
+		Block	 block;	 // Copy of the block header.
+		uint64_t offset; // File offset of the block header.
+	};
+
+	struct Trailer {
+		uint64_t indexOffset; // File offset of the first IndexEntry.
+		uint32_t blocks;	  // Number of IndexEntries.
+		uint32_t magic;		  // MAGIC.
+	};
+
+	/**
+	 * @brief Predicate over samples, pushed down to skip blocks whose statistics cannot match.
+	 */
+	struct Query {
+		SensorId  first	 = 0u;									 // First sensor identifier matched.
+		SensorId  last	 = std::numeric_limits<SensorId>::max(); // Last sensor identifier matched, inclusive.
+		Timestamp from	 = Timestamp::min();					 // Earliest timestamp matched.
+		Timestamp to	 = Timestamp::max();					 // Latest timestamp matched, inclusive.
+		int16_t	  minRaw = std::numeric_limits<int16_t>::min();	 // Smallest raw value matched.
+		int16_t	  maxRaw = std::numeric_limits<int16_t>::max();	 // Largest raw value matched.
+
+		bool matches(const Sample &sample) const;
+		bool mayMatch(const Block &block) const;
+	};
+
+	/**
+	 * @brief Compute the checksum of records.
+	 *
+	 * @param records The records.
+	 * @param count The number of records.
+	 * @return uint32_t The FNV-1a hash of the records.
+	 */
+	static uint32_t checksum(const Record *records, size_t count);
+};
+
+/**
+ * @brief Writes samples to a segment file in blocks.
+ *
+ * @note Requires POSIX. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::SegmentWriter {
+public:
+	/**
+	 * @brief Construct a new SegmentWriter object
+	 *
+	 * @param path The path of the segment file, which is replaced.
+	 * @param blockCapacity The most records in a block. Larger blocks index more compactly, smaller blocks are skipped
+	 * 						by queries more selectively.
+	 * @param flags The flags of the segment, such as Segment::DOWNSAMPLED.
+	 */
+	SegmentWriter(std::string path, size_t blockCapacity = 4096u, uint16_t flags = 0u);
+
+	SegmentWriter(const SegmentWriter &)			= delete;
+	SegmentWriter &operator=(const SegmentWriter &) = delete;
+
+	/**
+	 * @brief Destroy the SegmentWriter object, sealing the segment if still open.
+	 */
+	~SegmentWriter();
+
+	/**
+	 * @brief Create the segment file and write its header.
+	 *
+	 * @return bool True if successful.
+	 */
+	bool open();
+
+	/**
+	 * @brief Append a sample, writing a block once full.
+	 *
+	 * @param sample The sample.
+	 * @param count The raw samples averaged into the sample, in a Segment::DOWNSAMPLED segment.
+	 * @return bool True if successful.
+	 */
+	bool append(const Sample &sample, uint32_t count = 0u);
+
+	/**
+	 * @brief Write the pending samples as a block, which may be smaller than the block capacity.
+	 *
+	 * @return bool True if successful.
+	 */
+	bool flush();
+
+	/**
+	 * @brief Flush and make the blocks written durable with fdatasync().
+	 *
+	 * @return bool True if successful.
+	 */
+	bool sync();
+
+	/**
+	 * @brief Flush, write the index and trailer, sync and close the file.
+	 *
+	 * @details The file is closed even if unsuccessful. A failed writer writes no trailer, so that readers recover the
+	 * blocks written whole rather than trust an index of a torn block.
+	 * @return bool True if successful.
+	 */
+	bool seal();
+
+	inline const std::string &getPath() const { return path; }
+	inline bool				  isOpen() const { return file >= 0; }
+	inline uint64_t			  getSamples() const { return samples; }
+	inline uint64_t			  getSize() const { return offset; } // Bytes written.
+	inline bool				  hasFailed() const { return failed; } // A write failed, refusing all until reopened.
+
+private:
+	std::string						 path;
+	size_t							 blockCapacity;
+	uint16_t						 flags;
+	int								 file	 = -1;
+	uint64_t						 offset	 = 0u;
+	uint64_t						 samples = 0u;
+	bool							 failed	 = false;
+	std::vector<Segment::Record>	 pending;
+	std::vector<Segment::IndexEntry> index;
+
+	bool write(const void *data, size_t size);
+};
+
+/**
+ * @brief Reads the samples of a segment file matching a query, skipping the blocks which cannot match.
+ *
+ * @details The running maximum of the latest timestamps of the blocks never decreases, so the first block which may
+ * hold a time range is found by binary search over it, even where samples from several sources arrive slightly out of
+ * order. Each remaining block is read only if its statistics may match the query. Reads use pread(), so one reader may
+ * be scanned by several threads at once.
+ * @note Requires POSIX. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::SegmentReader {
+public:
+	/**
+	 * @brief Called with each sample matched. Returns false to stop the scan.
+	 */
+	using Visitor = std::function<bool(const Sample &sample)>;
+
+	struct Statistics {
+		uint64_t blocksRead	   = 0u; // Blocks read from the file.
+		uint64_t blocksSkipped = 0u; // Blocks excluded by their statistics.
+		uint64_t samplesRead   = 0u; // Samples in the blocks read.
+		uint64_t matched	   = 0u; // Samples matching the query.
+		uint64_t errors		   = 0u; // Blocks skipped as they could not be read or failed their checksum.
+	};
+
+	explicit SegmentReader(std::string path);
+
+	SegmentReader(const SegmentReader &)			= delete;
+	SegmentReader &operator=(const SegmentReader &) = delete;
+
+	~SegmentReader();
+
+	/**
+	 * @brief Open the segment file and load its index, or recover it by walking the blocks if not sealed.
+	 *
+	 * @return bool True if successful.
+	 */
+	bool open();
+
+	void close();
+
+	/**
+	 * @brief Scan the samples matching a query, in file order.
+	 *
+	 * @param query The query.
+	 * @param visitor Called with each sample matched.
+	 * @return Statistics The blocks and samples read and matched, and the blocks skipped as unreadable or corrupt.
+	 */
+	Statistics scan(const Segment::Query &query, const Visitor &visitor) const;
+
+	/**
+	 * @brief Get the samples matching a query, in file order.
+	 *
+	 * @param query The query.
+	 * @return std::vector<Sample> The samples matched. Unreadable or corrupt blocks are skipped, as counted by scan().
+	 */
+	std::vector<Sample> query(const Segment::Query &query) const;
+
+	/**
+	 * @brief Get the samples of several segments matching a query, scanning the segments in parallel.
+	 *
+	 * @param paths The paths of the segment files. Segments which cannot be opened are skipped.
+	 * @param query The query.
+	 * @param pool The pool scanning the segments, one task per segment. May be called from a task of the pool.
+	 * @return std::vector<Sample> The samples matched, in the order of the segments given and then in file order.
+	 */
+	static std::vector<Sample> query(const std::vector<std::string> &paths, const Segment::Query &query, ThreadPool &pool);
+
+	inline const std::string &getPath() const { return path; }
+	inline bool				  isSealed() const { return sealed; }
+	inline size_t			  getBlocks() const { return index.size(); }
+	inline uint64_t			  getSamples() const { return samples; }
+	inline uint32_t			  getBlockCapacity() const { return blockCapacity; }
+	inline uint16_t			  getFlags() const { return flags; }
+
+	/**
+	 * @brief Get the header of a block, without reading its records.
+	 *
+	 * @param block The block index.
+	 * @return const Segment::Block& The block header.
+	 */
+	inline const Segment::Block &getBlock(size_t block) const { return index[block].block; }
+
+	/**
+	 * @brief Read the samples of a block.
+	 *
+	 * @param block The block index.
+	 * @return std::vector<Sample> The samples, or empty if the block could not be read or failed its checksum.
+	 */
+	std::vector<Sample> readBlock(size_t block) const;
+
+	/**
+	 * @brief Read the records of a block, such as for the counts of a Segment::DOWNSAMPLED segment.
+	 *
+	 * @param block The block index.
+	 * @param records The records read.
+	 * @return bool True if the block was read and matched its checksum.
+	 */
+	bool readRecords(size_t block, std::vector<Segment::Record> &records) const;
+
+private:
+	std::string						 path;
+	int								 file		   = -1;
+	bool							 sealed		   = false;
+	uint32_t						 blockCapacity = 0u;
+	uint16_t						 flags		   = 0u;
+	uint64_t						 samples	   = 0u;
+	std::vector<Segment::IndexEntry> index;
+	std::vector<int64_t>			 runningMax; // Running maximum of the latest timestamps of the blocks.
+
+	bool loadIndex(uint64_t size);
+	bool recoverIndex(uint64_t size);
+};
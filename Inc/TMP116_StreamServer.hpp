@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_StreamServer.hpp
+ * @brief			: TMP116 Local Sample Streaming Server over Unix Domain Sockets
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <string>
+#include <vector>
+
+#include <sys/uio.h>
+
+/**
+ * @brief Streams batches of samples to local subscribers over a Unix domain socket.
+ *
+ * @details Subscribers connect to a SOCK_SEQPACKET socket, so that each frame is delivered whole or not at all, and may
+ * send a Subscription to filter the sensors and rate they receive. Each batch of samples published is encoded once
+ * into compact records, and sent to each subscriber with sendmsg() as a header followed by the runs of records
+ * matching its filter, gathered without copying. Sends never block. A subscriber unable to keep up has its rate halved
+ * for each frame it misses, and is disconnected once its rate falls below a limit, so acquisition is never stalled.
+ * @note Frames are in host byte order, being intended for consumers on the same host.
+ * @note Requires POSIX. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::StreamServer {
+public:
+	static constexpr uint32_t MAGIC = 0x36313154u; // "T116" in little endian.
+
+	/**
+	 * @brief Header of each frame, followed by count Records.
+	 */
+	struct FrameHeader {
+		uint32_t magic;		// MAGIC.
+		uint16_t version;	// Version of the frame format, being 1.
+		uint16_t count;		// Number of records following the header.
+		int64_t	 timestamp; // Base timestamp of the records, in microseconds.
+	};
+
+	/**
+	 * @brief A sample within a frame.
+	 */
+	struct Record {
+		uint32_t offset;   // Timestamp of the sample, in microseconds after the base timestamp of the frame.
+		uint16_t sensorId; // Identifier of the sensor.
+		uint16_t raw;	   // Temperature Register value.
+	};
+
+	/**
+	 * @brief Filter optionally sent by a subscriber after connecting. Subscribers receive all samples otherwise.
+	 */
+	struct Subscription {
+		uint32_t magic;		 // MAGIC.
+		uint16_t first;		 // First sensor identifier received.
+		uint16_t last;		 // Last sensor identifier received, inclusive.
+		uint16_t decimation; // One in every decimation matching samples is received. 0 and 1 receive all samples.
+		uint16_t reserved;
+	};
+
+	struct Options {
+		uint16_t maxDecimation = 64u;	// Congested subscribers reduced below this rate are disconnected.
+		size_t	 maxRuns	   = 64u;	// Most runs of records gathered into a single frame, being at least 1.
+		size_t	 maxRecords	   = 4096u; // Most records in a single frame, also limited by the send buffer.
+	};
+
+	struct Statistics {
+		uint64_t frames		  = 0u; // Frames sent.
+		uint64_t records	  = 0u; // Records sent.
+		uint64_t missed		  = 0u; // Frames not sent due to congested subscribers.
+		uint64_t disconnected = 0u; // Subscribers disconnected, whether by congestion or hang up.
+	};
+
+	/**
+	 * @brief Construct a new StreamServer object
+	 *
+	 * @param path The filesystem path of the socket.
+	 * @param options The server options.
+	 */
+	StreamServer(std::string path, Options options);
+	explicit StreamServer(std::string path);
+
+	StreamServer(const StreamServer &)			  = delete;
+	StreamServer &operator=(const StreamServer &) = delete;
+
+	~StreamServer();
+
+	/**
+	 * @brief Create, bind and listen on the socket, replacing a stale socket left at the path.
+	 *
+	 * @return bool True if listening. False if the path is taken, including by another server listening on it.
+	 */
+	bool open();
+
+	/**
+	 * @brief Disconnect all subscribers and remove the socket.
+	 */
+	void close();
+
+	/**
+	 * @brief Accept new subscribers, receive their subscriptions and remove those which have hung up. Never blocks.
+	 */
+	void poll();
+
+	/**
+	 * @brief Send a batch of samples to all subscribers. Never blocks.
+	 *
+	 * @details Samples more than UINT32_MAX microseconds apart are sent in separate frames, each with its own base.
+	 *
+	 * @param samples The samples, such as drained from a TMP116::Ring.
+	 * @param count The number of samples.
+	 */
+	void publish(const Sample *samples, size_t count);
+
+	inline size_t			 getSubscribers() const { return subscribers.size(); }
+	inline const Statistics &getStatistics() const { return statistics; }
+
+private:
+	struct Subscriber {
+		int		 socket;
+		uint16_t first		= 0u;
+		uint16_t last		= UINT16_MAX;
+		uint16_t decimation = 1u; // Requested decimation.
+		uint16_t congestion = 1u; // Additional decimation while congested.
+		uint32_t count		= 0u; // Matching samples seen, for decimation.
+		uint16_t maxRecords = 1u; // Most records in a frame to the subscriber.
+	};
+
+	std::string				path;
+	Options					options;
+	int						listener = -1;
+	std::vector<Subscriber> subscribers;
+	std::vector<Record>		records;
+	std::vector<iovec>		iovecs;
+	Statistics				statistics{};
+
+	void broadcast(const Sample *samples, size_t count, int64_t timestamp);
+	bool send(Subscriber &subscriber, const Sample *samples, size_t count, int64_t timestamp);
+	void disconnect(size_t subscriber);
+};
@@ -0,0 +1,103 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ThermalMap.hpp
+ * @brief			: TMP116 Spatial Thermal Map Interpolation
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <vector>
+
+/**
+ * @brief Continuous heat map over a regular grid of cells, interpolated from the latest readings of placed sensors.
+ *
+ * @details Each cell is the inverse distance weighted (IDW) mean of its nearest sensors. The neighbours and weights of
+ * every cell are found once at construction and held as a sparse matrix of a fixed number of entries per cell, with
+ * each neighbour rank contiguous across cells. Each refresh is then a sparse matrix-vector product of the weights and
+ * the readings, as loops over cells which compilers vectorise. Sensors without a reading are skipped by renormalising
+ * the weights of each cell over the sensors read, so that a missing sensor does not leave a hole in the map.
+ * @note Sensor identifiers must be less than the number of positions given at construction.
+ */
+class TMP116::ThermalMap {
+public:
+	/**
+	 * @brief Position of a sensor, in the same units as the grid.
+	 */
+	struct Position {
+		float x = 0.0f;
+		float y = 0.0f;
+	};
+
+	/**
+	 * @brief Regular grid of cells, in row-major order.
+	 */
+	struct Grid {
+		float  x	   = 0.0f; // Position of the centre of cell (0, 0).
+		float  y	   = 0.0f;
+		float  spacing = 1.0f; // Distance between the centres of adjacent cells.
+		size_t width   = 1u;   // Cells along x.
+		size_t height  = 1u;   // Cells along y.
+	};
+
+	struct Options {
+		size_t neighbours = 4u;	  // Sensors weighted per cell, or all sensors if fewer.
+		float  power	  = 2.0f; // Power of the inverse distance.
+	};
+
+	/**
+	 * @brief Construct a new ThermalMap object, precomputing the weights of every cell.
+	 *
+	 * @param positions The position of each sensor, by sensor identifier. All sensors are initially without a reading.
+	 * @param grid The grid of cells.
+	 * @param options The interpolation options.
+	 */
+	ThermalMap(std::vector<Position> positions, Grid grid, Options options);
+	ThermalMap(std::vector<Position> positions, Grid grid);
+
+	/**
+	 * @brief Update the reading of a sensor.
+	 *
+	 * @param sample The latest sample of the sensor.
+	 * @return bool True if updated, false if the sensor identifier is out of range.
+	 */
+	bool update(const Sample &sample);
+
+	/**
+	 * @brief Update the readings of all sensors, such as a row of TMP116::Resampler.
+	 *
+	 * @param temperatures The temperature of each sensor in degrees Celsius, or NaN if without a reading.
+	 */
+	void update(const float *temperatures);
+
+	/**
+	 * @brief Interpolate every cell from the current readings.
+	 */
+	void refresh();
+
+	/**
+	 * @brief Get the cells as of the last refresh.
+	 *
+	 * @return const std::vector<float>& The temperature of each cell in degrees Celsius, in row-major order, or NaN
+	 * 		   where none of the neighbours of a cell have a reading.
+	 */
+	inline const std::vector<float> &getCells() const { return cells; }
+
+	inline float  at(size_t column, size_t row) const { return cells[row * grid.width + column]; }
+	inline size_t getSensors() const { return readings.size(); }
+	inline size_t getNeighbours() const { return neighbours; }
+
+private:
+	Grid				  grid;
+	size_t				  neighbours;
+	std::vector<float>	  readings;
+	std::vector<float>	  values;  // Readings, or zero without a reading. Scratch of refresh().
+	std::vector<float>	  present; // One with a reading, or zero. Scratch of refresh().
+	std::vector<uint32_t> indices; // indices[rank * cells + cell], the sensor of each neighbour rank of each cell.
+	std::vector<float>	  weights; // weights[rank * cells + cell], its inverse distance weight.
+	std::vector<float>	  cells;
+	std::vector<float>	  norms; // Sum of the weights of the sensors read, per cell. Scratch of refresh().
+};
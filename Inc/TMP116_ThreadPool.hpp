@@ -0,0 +1,121 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ThreadPool.hpp
+ * @brief			: TMP116 Thread Pool
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed size pool of threads executing submitted tasks, balanced by work stealing.
+ *
+ * @details Each thread has its own deque of tasks. Tasks submitted from outside the pool are dealt to the deques in
+ * turn, and tasks submitted by a task go to the deque of its own thread. A thread takes the oldest task of its own deque
+ * first, so that a task resubmitting itself cannot starve those queued before it, and once its deque is empty steals
+ * the oldest task of another thread, so uneven tasks do not leave threads idle while others have a backlog.
+ *
+ * @note Requires threads. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::ThreadPool {
+public:
+	using Task = std::function<void()>;
+
+	/**
+	 * @brief Tasks submitted together, so that they may be waited for apart from other tasks of the pool.
+	 */
+	class Group {
+	public:
+		Group() = default;
+
+		Group(const Group &)			= delete;
+		Group &operator=(const Group &) = delete;
+
+		inline size_t getPending() const { return pending.load(std::memory_order_acquire); } // Tasks not complete.
+
+	private:
+		friend class ThreadPool;
+		std::atomic<size_t> pending{0u};
+	};
+
+	/**
+	 * @brief Construct a new ThreadPool object and start its threads.
+	 *
+	 * @param threads The number of threads. Defaults to the number of hardware threads.
+	 */
+	explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());
+
+	ThreadPool(const ThreadPool &)			  = delete;
+	ThreadPool &operator=(const ThreadPool &) = delete;
+
+	/**
+	 * @brief Destroy the ThreadPool object, completing all submitted tasks before joining the threads.
+	 */
+	~ThreadPool();
+
+	/**
+	 * @brief Submit a task for execution by the pool.
+	 *
+	 * @param task The task to execute.
+	 */
+	void submit(Task task);
+
+	/**
+	 * @brief Submit a task of a group for execution by the pool.
+	 *
+	 * @param task The task to execute.
+	 * @param group The group of the task. Must outlive the task, such as by waiting for the group.
+	 */
+	void submit(Task task, Group &group);
+
+	/**
+	 * @brief Wait until all submitted tasks have completed.
+	 * @note Must not be called from a task of the pool, which would wait for itself.
+	 */
+	void wait();
+
+	/**
+	 * @brief Wait until the tasks of a group have completed, executing queued tasks of the pool meanwhile.
+	 *
+	 * @param group The group.
+	 * @note May be called from a task of the pool, even with a single thread.
+	 */
+	void wait(Group &group);
+
+	inline size_t	size() const { return threads.size(); }
+	inline uint64_t getSteals() const { return steals.load(std::memory_order_relaxed); } // Tasks taken from others.
+
+private:
+	struct Lane {
+		std::mutex		 mutex;
+		std::deque<Task> tasks;
+	};
+
+	std::vector<std::unique_ptr<Lane>> lanes;
+	std::vector<std::thread>		   threads;
+	std::atomic<size_t>				   next{0u}; // Lane dealt the next task submitted from outside the pool.
+	std::atomic<uint64_t>			   steals{0u};
+
+	std::mutex				mutex;
+	std::condition_variable available;
+	std::condition_variable idle;
+	size_t					queued	 = 0u; // Tasks submitted and not yet taken.
+	size_t					active	 = 0u; // Tasks taken and not yet complete.
+	bool					stopping = false;
+
+	bool take(size_t lane, Task &task);
+	void execute(Task &task);
+	void run(size_t lane);
+};
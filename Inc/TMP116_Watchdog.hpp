@@ -0,0 +1,145 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Watchdog.hpp
+ * @brief			: TMP116 Stale Sensor Watchdog on a Hierarchical Timer Wheel
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <array>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Detects sensors which stop producing fresh samples, with one timeout per sensor on a hierarchical timer wheel.
+ *
+ * @details Time advances in ticks of a fixed resolution. The wheel has LEVELS levels of SLOTS slots, each slot of a
+ * level spanning SLOTS times the ticks of the level below, and each slot holds an intrusive list of the timers expiring
+ * within it. Arming, resetting and disarming a timer links or unlinks it from one list in O(1). Advancing visits one
+ * slot per tick, expiring the timers of the lowest level, and when the lowest level wraps moves the timers of the next
+ * slot above down a level, so each timer is moved at most LEVELS - 1 times. All timers are allocated at construction.
+ * @note Sensor identifiers must be less than the number of sensors given at construction.
+ */
+class TMP116::Watchdog {
+public:
+	static constexpr size_t LEVELS = 4u;
+	static constexpr size_t BITS   = 8u;
+	static constexpr size_t SLOTS  = 1u << BITS; // Slots of each level.
+
+	/**
+	 * @brief The expiry of the timeout of a sensor.
+	 */
+	struct Event {
+		SensorId  sensorId;
+		Timestamp reset;	// Time the timer was last armed or reset, such as the last successful read.
+		Timestamp deadline; // Time the timer was due to expire.
+	};
+
+	using Handler = std::function<void(const Event &event)>;
+
+	struct Options {
+		Duration resolution = std::chrono::milliseconds{1}; // Length of a tick. Expiries are late by up to one tick.
+		Duration grace		= std::chrono::milliseconds{5}; // Added to conversion periods, covering read latency.
+	};
+
+	/**
+	 * @brief Construct a new Watchdog object
+	 *
+	 * @param sensors The number of sensors. All timers are initially disarmed.
+	 * @param start The current time, from which ticks are counted.
+	 * @param options The resolution and grace of timeouts.
+	 */
+	Watchdog(size_t sensors, Timestamp start, Options options);
+	Watchdog(size_t sensors, Timestamp start);
+
+	/**
+	 * @brief Arm the timer of a sensor, or re-arm it with a new timeout.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param timeout The time without a reset after which the timer expires.
+	 * @param now The current time.
+	 * @return bool True if armed, false if the sensor identifier is out of range.
+	 */
+	bool arm(SensorId sensorId, Duration timeout, Timestamp now);
+
+	/**
+	 * @brief Arm the timer of a sensor with a timeout of one conversion period of its configuration, plus the grace.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param config The configuration of the TMP116, which sets the conversion period.
+	 * @param now The current time.
+	 * @return bool True if armed, false if the sensor identifier is out of range.
+	 */
+	bool arm(SensorId sensorId, const Config &config, Timestamp now);
+
+	/**
+	 * @brief Restart the timeout of a sensor, such as on each successful read. Re-arms a timer which has expired.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @param now The current time.
+	 * @return bool True if reset, false if the sensor identifier is out of range or the timer was never armed.
+	 */
+	bool reset(SensorId sensorId, Timestamp now);
+
+	/**
+	 * @brief Disarm the timer of a sensor, such as when it is removed from the fleet.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return bool True if disarmed, false if the sensor identifier is out of range.
+	 */
+	bool disarm(SensorId sensorId);
+
+	/**
+	 * @brief Advance time, expiring the timers due.
+	 *
+	 * @param now The current time.
+	 * @param handler Called with each expiry, in order of deadline to within one tick. The timers expired stay disarmed
+	 * 				  until reset.
+	 * @return size_t The number of timers expired.
+	 */
+	size_t advance(Timestamp now, const Handler &handler);
+
+	/**
+	 * @brief Check whether the timer of a sensor has expired without a reset since.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return bool True if stale, false if fresh, disarmed or out of range.
+	 */
+	bool isStale(SensorId sensorId) const;
+
+	inline size_t	getSensors() const { return timers.size(); }
+	inline size_t	getArmed() const { return armed; }
+	inline uint64_t getTick() const { return tick; }
+
+private:
+	static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+	enum class State : uint8_t { DISARMED, ARMED, EXPIRED };
+
+	struct Timer {
+		uint32_t  previous = NONE;
+		uint32_t  next	   = NONE;
+		uint32_t  slot	   = NONE; // Index of the list holding the timer.
+		State	  state	   = State::DISARMED;
+		uint64_t  expiry   = 0u;   // Tick of expiry.
+		Duration  timeout{0};
+		Timestamp reset{0};
+	};
+
+	Options								 options;
+	Timestamp							 start;
+	uint64_t							 tick  = 0u; // Ticks elapsed since start.
+	size_t								 armed = 0u;
+	std::vector<Timer>					 timers;
+	std::array<uint32_t, LEVELS * SLOTS> heads{}; // First timer of each slot of each level.
+
+	uint64_t toTick(Timestamp time) const;
+	void	 link(uint32_t index);
+	void	 unlink(uint32_t index);
+	void	 schedule(uint32_t index, Timestamp now);
+	void	 cascade(size_t level);
+};
@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Worker.hpp
+ * @brief			: TMP116 POSIX Acquisition Worker Thread
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+#include "TMP116_JitterRecorder.hpp"
+#include "TMP116_Ring.hpp"
+#include "TMP116_Scheduler.hpp"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+/**
+ * @brief Acquisition thread servicing the Scheduler of a single I2C bus.
+ *
+ * @details The worker sleeps until the next job release of its scheduler, polls the scheduler, and pushes the sample
+ * read into a preallocated ring buffer for consumers to drain, or into a non-blocking sink. The lateness of each read
+ * against its planned release is recorded for timing determinism analysis, and each sample is stamped with
+ * Trace::Hop::READ on completion of the read, and with Trace::Hop::ENQUEUE when pushed into the ring buffer. The worker
+ * may optionally run as a real-time thread under SCHED_FIFO, pinned to a CPU, with all process memory locked.
+ * @note Timestamps are microseconds of CLOCK_MONOTONIC. The scheduler must not be used by other threads while running.
+ * @note Requires POSIX. Only built when the CMake option TMP116_POSIX is enabled.
+ */
+class TMP116::Worker {
+public:
+	struct Options {
+		size_t			   capacity		 = 1024u;			  // Minimum number of samples held by the ring buffer.
+		Duration		   retryInterval = Duration{1'000};	  // Sleep after a failed or not ready poll.
+		Duration		   maxSleep		 = Duration{100'000}; // Longest sleep, bounding the latency of stop().
+		bool			   realTime		 = false;			  // Run under SCHED_FIFO.
+		int				   priority		 = 50;				  // SCHED_FIFO priority when running in real-time.
+		std::optional<int> cpu			 = std::nullopt;	  // CPU to pin the thread to.
+		bool			   lockMemory	 = true;			  // mlockall() the process when running in real-time.
+
+		/**
+		 * @brief Optional sink receiving each sample instead of the ring buffer, such as TMP116::Pipeline::push().
+		 * @note Called on the acquisition thread, so must not block. Returns false if the sample was dropped.
+		 */
+		std::function<bool(const Sample &sample)> sink{};
+	};
+
+	/**
+	 * @brief Construct a new Worker object
+	 *
+	 * @param scheduler The scheduler of the bus serviced. Must outlive the worker.
+	 * @param options The worker options. All buffers are allocated at construction.
+	 */
+	explicit Worker(Scheduler &scheduler, Options options);
+	explicit Worker(Scheduler &scheduler);
+
+	Worker(const Worker &)			  = delete;
+	Worker &operator=(const Worker &) = delete;
+
+	~Worker();
+
+	/**
+	 * @brief Start the acquisition thread.
+	 *
+	 * @return bool True if the thread was started with all requested options applied. False if already running, or if
+	 * 		   the real-time policy, CPU affinity or memory locking could not be applied, in which case the thread is
+	 * 		   not started.
+	 */
+	bool start();
+
+	/**
+	 * @brief Stop the acquisition thread and wait for it to exit.
+	 * @note Memory locked by start() is unlocked once no other worker holds it locked.
+	 */
+	void stop();
+
+	/**
+	 * @brief Get the current time of the clock used by workers.
+	 *
+	 * @return Timestamp The current CLOCK_MONOTONIC time.
+	 */
+	static Timestamp now();
+
+	inline bool			 isRunning() const { return running.load(std::memory_order_acquire); }
+	inline Ring<Sample> &getSamples() { return samples; }
+	inline uint32_t		 getOverruns() const { return overruns.load(std::memory_order_relaxed); } // Samples dropped.
+
+	/**
+	 * @brief Get the jitter recorded for the bus.
+	 *
+	 * @return const JitterRecorder& The jitter of reads against their planned release.
+	 * @note Only consistent while the worker is stopped.
+	 */
+	inline const JitterRecorder &getJitter() const { return jitter; }
+
+private:
+	Scheduler	  &scheduler;
+	Options		   options;
+	Ring<Sample>   samples;
+	JitterRecorder jitter{};
+
+	std::thread			  thread{};
+	std::atomic<bool>	  running{false};
+	std::atomic<uint32_t> overruns{0u};
+	bool				  memoryLocked = false; // True if start() locked the process memory.
+
+	bool applyRealTime();
+	void run();
+};
@@ -0,0 +1,120 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ZoneIndex.hpp
+ * @brief			: TMP116 Incremental Zone Aggregates and Hottest Sensors Index
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "TMP116.hpp"
+
+#include <vector>
+
+/**
+ * @brief Segment tree over the latest temperature of every sensor in a fleet.
+ *
+ * @details Each node holds the min, max, sum and count of the sensors below it, so updating a sensor is O(log n) and
+ * the aggregate of any contiguous range of sensors is also O(log n). Zones such as racks, rows and rooms are registered
+ * as contiguous ranges of sensor identifiers, which nest naturally when sensors are numbered by location. The K hottest
+ * sensors are found by a best-first descent of the tree in O(K log n), without rescanning the fleet.
+ * @note Sensor identifiers must be less than the number of sensors given at construction.
+ */
+class TMP116::ZoneIndex {
+public:
+	using ZoneId = uint16_t;
+
+	/**
+	 * @brief Aggregate of the latest temperatures of a range of sensors.
+	 */
+	struct Aggregate {
+		int16_t	 min	= 0;  // Smallest raw temperature register value.
+		int16_t	 max	= 0;  // Largest raw temperature register value.
+		SensorId argMin = 0u; // Sensor with the smallest value.
+		SensorId argMax = 0u; // Sensor with the largest value.
+		uint32_t count	= 0u; // Number of sensors with a valid temperature.
+		int64_t	 sum	= 0;  // Sum of raw temperature register values.
+
+		/**
+		 * @brief Get the mean temperature of the sensors.
+		 *
+		 * @return float The mean temperature in degrees Celsius, or 0.0 if empty.
+		 */
+		float getMean() const;
+	};
+
+	/**
+	 * @brief Construct a new ZoneIndex object
+	 *
+	 * @param sensors The number of sensors. All sensors are initially invalid.
+	 */
+	explicit ZoneIndex(size_t sensors);
+
+	/**
+	 * @brief Update the latest temperature of a sensor.
+	 *
+	 * @param sample The latest sample of the sensor.
+	 * @return bool True if updated, false if the sensor identifier is out of range.
+	 */
+	bool update(const Sample &sample);
+
+	/**
+	 * @brief Remove the temperature of a sensor from all aggregates, such as when it becomes stale.
+	 *
+	 * @param sensorId The identifier of the sensor.
+	 * @return bool True if invalidated, false if the sensor identifier is out of range.
+	 */
+	bool invalidate(SensorId sensorId);
+
+	/**
+	 * @brief Register a zone of sensors.
+	 *
+	 * @param first The first sensor of the zone.
+	 * @param last The last sensor of the zone, inclusive.
+	 * @return std::optional<ZoneId> The identifier of the zone, or std::nullopt if the range is invalid.
+	 */
+	std::optional<ZoneId> addZone(SensorId first, SensorId last);
+
+	/**
+	 * @brief Get the aggregate of a zone.
+	 *
+	 * @param zone The identifier of the zone.
+	 * @return std::optional<Aggregate> The aggregate, or std::nullopt if the zone does not exist or has no valid sensors.
+	 */
+	std::optional<Aggregate> getZone(ZoneId zone) const;
+
+	/**
+	 * @brief Get the aggregate of a range of sensors.
+	 *
+	 * @param first The first sensor of the range.
+	 * @param last The last sensor of the range, inclusive.
+	 * @return std::optional<Aggregate> The aggregate, or std::nullopt if the range is invalid or has no valid sensors.
+	 */
+	std::optional<Aggregate> getRange(SensorId first, SensorId last) const;
+
+	/**
+	 * @brief Get the hottest sensors of the fleet.
+	 *
+	 * @param sensors The array to write the sensor identifiers to, hottest first.
+	 * @param count The number of sensors to find, being the size of the array.
+	 * @return size_t The number of sensors written, being fewer than count if fewer sensors are valid.
+	 */
+	size_t getHottest(SensorId *sensors, size_t count) const;
+
+	inline size_t getSensors() const { return sensors; }
+
+private:
+	struct Zone {
+		SensorId first;
+		SensorId last;
+	};
+
+	size_t				   sensors;
+	size_t				   leaves; // Number of leaves, being the number of sensors rounded up to a power of two.
+	std::vector<Aggregate> nodes;  // Implicit binary tree, with the root at 1 and leaves from index leaves.
+	std::vector<Zone>	   zones;
+
+	static Aggregate combine(const Aggregate &left, const Aggregate &right);
+	void			 set(size_t sensor, const Aggregate &leaf);
+};
@@ -12,6 +12,7 @@ using DeviceAddress = TMP116::I2C::DeviceAddress;
 using MemoryAddress = TMP116::I2C::MemoryAddress;
 using Register		= TMP116::I2C::Register;
 using Config		= TMP116::Config;
+using Duration		= TMP116::Duration;
 
 #define TMP116_TEMP_REG_ADDR	  static_cast<MemoryAddress>(0x00u) // Temperature Register Address
 #define TMP116_CFGR_REG_ADDR	  static_cast<MemoryAddress>(0x01u) // Configuration Register Address
@@ -50,12 +51,30 @@ static constexpr Register convertTemperatureRegister(float temperature) {
 }
 
 float TMP116::getTemperature() const {
-	auto transmission = this->i2c.read(this->deviceAddress, TMP116_TEMP_REG_ADDR);
+	auto transmission = this->getTemperatureRegister();
 	if (transmission) {
 		return convertTemperatureRegister(transmission.value());
 	} else return -256.0f;
 }
 
+std::optional<Register> TMP116::getTemperatureRegister() const {
+	return this->i2c.read(this->deviceAddress, TMP116_TEMP_REG_ADDR);
+}
+
+float TMP116::Sample::getTemperature() const { return convertTemperatureRegister(this->raw); }
+
+void TMP116::Sample::stamp(Trace::Hop hop, Timestamp time) {
+	const auto offset = (time - this->timestamp).count();
+	this->trace.offsets[static_cast<size_t>(hop)] =
+		offset > INT32_MAX ? INT32_MAX : (offset <= INT32_MIN ? INT32_MIN + 1 : static_cast<int32_t>(offset));
+}
+
+std::optional<TMP116::Timestamp> TMP116::Sample::getStamp(Trace::Hop hop) const {
+	const int32_t offset = this->trace.offsets[static_cast<size_t>(hop)];
+	if (offset == Trace::NONE) return std::nullopt;
+	return this->timestamp + Duration{offset};
+}
+
 std::optional<Register> TMP116::getDeviceId() {
 	return this->i2c.read(this->deviceAddress, TMP116_DEVICE_ID_REG_ADDR);
 }
@@ -192,3 +211,42 @@ TMP116::Config::operator Register() const {
 							 static_cast<Register>(this->dataReadyAlertSelection); // typeof<enum class> == Register
 	return registerValue;
 }
+
+Duration TMP116::Config::getConversionPeriod() const {
+	using std::chrono::microseconds;
+
+	microseconds cycleTime;
+	switch (this->conversionCycleTime) {
+	case ConversionCycleTime::CONV_15_5MS: cycleTime = microseconds{15'500}; break;
+	case ConversionCycleTime::CONV_125MS: cycleTime = microseconds{125'000}; break;
+	case ConversionCycleTime::CONV_250MS: cycleTime = microseconds{250'000}; break;
+	case ConversionCycleTime::CONV_500MS: cycleTime = microseconds{500'000}; break;
+	case ConversionCycleTime::CONV_1000MS: cycleTime = microseconds{1'000'000}; break;
+	case ConversionCycleTime::CONV_4000MS: cycleTime = microseconds{4'000'000}; break;
+	case ConversionCycleTime::CONV_8000MS: cycleTime = microseconds{8'000'000}; break;
+	case ConversionCycleTime::CONV_16000MS: cycleTime = microseconds{16'000'000}; break;
+	default: cycleTime = microseconds{1'000'000}; break;
+	}
+
+	// Active conversion time is 15.5ms per average, rounded by the TMP116 to the values below.
+	microseconds activeTime;
+	switch (this->averages) {
+	case Averages::AVG_1: activeTime = microseconds{15'500}; break;
+	case Averages::AVG_8: activeTime = microseconds{125'000}; break;
+	case Averages::AVG_32: activeTime = microseconds{500'000}; break;
+	case Averages::AVG_64: activeTime = microseconds{1'000'000}; break;
+	default: activeTime = microseconds{125'000}; break;
+	}
+
+	return cycleTime > activeTime ? cycleTime : activeTime;
+}
+
+uint32_t TMP116::Config::getAverageCount() const {
+	switch (this->averages) {
+	case Averages::AVG_1: return 1u;
+	case Averages::AVG_8: return 8u;
+	case Averages::AVG_32: return 32u;
+	case Averages::AVG_64: return 64u;
+	default: return 8u;
+	}
+}
@@ -0,0 +1,229 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Backfill.cpp
+ * @brief			: Source for TMP116_Backfill.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Backfill.hpp"
+#include "TMP116_ThreadPool.hpp"
+
+#include <algorithm>
+
+using Backfill	= TMP116::Backfill;
+using Aggregate = TMP116::Backfill::Aggregate;
+using Alert		= TMP116::Backfill::Alert;
+using Level		= TMP116::Backfill::Level;
+using Shard		= TMP116::Backfill::Shard;
+using Bucket	= TMP116::Rollup::Bucket;
+using Duration	= TMP116::Duration;
+using Sample	= TMP116::Sample;
+using SensorId	= TMP116::SensorId;
+using Timestamp = TMP116::Timestamp;
+
+/**
+ * @brief Results of one shard, merged in plan order.
+ */
+struct Backfill::Partial {
+	std::vector<Aggregate>					aggregates{};
+	std::vector<Alert>						alerts{};  // Changes of level within the shard.
+	std::vector<Alert>						entries{}; // First sample and level of each sensor in the shard.
+	std::vector<std::pair<SensorId, Level>> exits{};   // Level of each sensor at the end of the shard.
+	uint64_t								samples = 0u;
+	uint64_t								dropped = 0u;
+};
+
+/**
+ * @brief Round a time down to a multiple of an interval, also for negative times.
+ */
+static Timestamp floorTo(Timestamp time, Duration interval) {
+	auto index = time.count() / interval.count();
+	if (time.count() < 0 && time.count() % interval.count() != 0) index--;
+	return Timestamp{index * interval.count()};
+}
+
+Backfill::Backfill(std::vector<std::string> paths, Options options)
+	: paths{std::move(paths)}, options{std::move(options)} {
+	if (this->options.sensorsPerShard == 0u) this->options.sensorsPerShard = 1u;
+	if (this->options.shardDuration <= Duration::zero()) this->options.shardDuration = Duration{1};
+	if (this->options.rollupInterval <= Duration::zero()) this->options.rollupInterval = Duration{1};
+}
+
+Backfill::~Backfill() = default;
+
+bool Backfill::open() {
+	this->readers.clear();
+	this->empty = true;
+
+	bool opened = true;
+	for (const auto &path : this->paths) {
+		auto reader = std::make_unique<SegmentReader>(path);
+		if (!reader->open()) {
+			opened = false;
+			continue;
+		}
+
+		for (size_t i = 0u; i < reader->getBlocks(); i++) {
+			const auto &block = reader->getBlock(i);
+			if (block.count == 0u) continue;
+
+			const Timestamp minTimestamp{block.minTimestamp}, maxTimestamp{block.maxTimestamp};
+			if (this->empty) {
+				this->firstSensor = block.firstSensor;
+				this->lastSensor  = block.lastSensor;
+				this->from		  = minTimestamp;
+				this->to		  = maxTimestamp;
+				this->empty		  = false;
+				continue;
+			}
+			this->firstSensor = std::min(this->firstSensor, block.firstSensor);
+			this->lastSensor  = std::max(this->lastSensor, block.lastSensor);
+			this->from		  = std::min(this->from, minTimestamp);
+			this->to		  = std::max(this->to, maxTimestamp);
+		}
+		this->readers.push_back(std::move(reader));
+	}
+	return opened;
+}
+
+std::vector<Shard> Backfill::plan() const {
+	std::vector<Shard> shards{};
+	if (this->empty) return shards;
+
+	const uint32_t width	= this->options.sensorsPerShard;
+	const Duration duration = this->options.shardDuration;
+	const auto	   start	= floorTo(this->from, duration);
+
+	for (uint32_t first = this->firstSensor / width * width; first <= this->lastSensor; first += width) {
+		const auto last = static_cast<SensorId>(std::min<uint32_t>(first + width - 1u, this->lastSensor));
+		for (Timestamp window = start;; window += duration) {
+			// The last window ends at the latest timestamp, so that it cannot overflow past Timestamp::max().
+			const bool final = this->to - window < duration;
+			const auto end	 = final ? this->to : window + duration - Duration{1};
+			shards.push_back(Shard{static_cast<SensorId>(first), last, window, end});
+			if (final) break;
+		}
+	}
+	return shards;
+}
+
+Level Backfill::classify(Register raw) const {
+	const auto value = static_cast<int16_t>(raw);
+	if (value >= this->options.highLimit) return Level::HIGH;
+	if (value <= this->options.lowLimit) return Level::LOW;
+	return Level::NORMAL;
+}
+
+void Backfill::process(const Shard &shard, Partial &partial) const {
+	Segment::Query query{};
+	query.first = shard.first;
+	query.last	= shard.last;
+	query.from	= shard.from;
+	query.to	= shard.to;
+
+	std::vector<Sample> samples{};
+	for (const auto &reader : this->readers) {
+		reader->scan(query, [this, &samples, &partial](const Sample &sample) {
+			Sample filtered = sample;
+			if (!this->options.filter || this->options.filter(filtered)) samples.push_back(filtered);
+			else partial.dropped++;
+			return true;
+		});
+	}
+	partial.samples = samples.size() + partial.dropped;
+
+	// Stable, so that samples of equal sensor and time keep the order of the segments.
+	std::stable_sort(samples.begin(), samples.end(), [](const Sample &a, const Sample &b) {
+		return a.sensorId != b.sensorId ? a.sensorId < b.sensorId : a.timestamp < b.timestamp;
+	});
+
+	Level level = Level::NORMAL;
+	for (size_t i = 0u; i < samples.size(); i++) {
+		const Sample &sample = samples[i];
+		const auto	  raw	 = static_cast<int16_t>(sample.raw);
+		const auto	  start	 = floorTo(sample.timestamp, this->options.rollupInterval);
+
+		auto &aggregates = partial.aggregates;
+		if (aggregates.empty() || aggregates.back().sensorId != sample.sensorId ||
+			aggregates.back().bucket.start != start)
+			aggregates.push_back(Aggregate{sample.sensorId, Bucket{start, raw, raw, raw, 0u, 0}});
+		Bucket &bucket = aggregates.back().bucket;
+		bucket.min	   = std::min(bucket.min, raw);
+		bucket.max	   = std::max(bucket.max, raw);
+		bucket.last	   = raw;
+		bucket.count++;
+		bucket.sum += raw;
+
+		const Level current = this->classify(sample.raw);
+		if (i == 0u || samples[i - 1u].sensorId != sample.sensorId) {
+			if (i > 0u) partial.exits.emplace_back(samples[i - 1u].sensorId, level);
+			partial.entries.push_back(Alert{sample.sensorId, sample.timestamp, sample.raw, current});
+		} else if (current != level) {
+			partial.alerts.push_back(Alert{sample.sensorId, sample.timestamp, sample.raw, current});
+		}
+		level = current;
+	}
+	if (!samples.empty()) partial.exits.emplace_back(samples.back().sensorId, level);
+}
+
+Backfill::Result Backfill::run(ThreadPool &pool) const {
+	const auto	   started = std::chrono::steady_clock::now();
+	const uint64_t steals  = pool.getSteals();
+
+	const auto			 shards = this->plan();
+	std::vector<Partial> partials(shards.size());
+	ThreadPool::Group	 group{};
+	for (size_t i = 0u; i < shards.size(); i++) {
+		pool.submit([this, &shards, &partials, i]() { this->process(shards[i], partials[i]); }, group);
+	}
+	pool.wait(group);
+
+	Result result{};
+	result.shards = shards.size();
+
+	// Shards are merged in plan order, which visits the windows of each sensor in time order.
+	std::vector<Level> levels(size_t{std::numeric_limits<SensorId>::max()} + 1u, Level::NORMAL);
+	for (auto &partial : partials) {
+		result.samples += partial.samples;
+		result.dropped += partial.dropped;
+
+		for (const auto &entry : partial.entries) {
+			if (entry.level != levels[entry.sensorId]) result.alerts.push_back(entry);
+		}
+		result.alerts.insert(result.alerts.end(), partial.alerts.begin(), partial.alerts.end());
+		for (const auto &exit : partial.exits) levels[exit.first] = exit.second;
+
+		result.aggregates.insert(result.aggregates.end(), partial.aggregates.begin(), partial.aggregates.end());
+	}
+
+	std::stable_sort(result.alerts.begin(), result.alerts.end(), [](const Alert &a, const Alert &b) {
+		return a.sensorId != b.sensorId ? a.sensorId < b.sensorId : a.timestamp < b.timestamp;
+	});
+	std::stable_sort(result.aggregates.begin(), result.aggregates.end(), [](const Aggregate &a, const Aggregate &b) {
+		return a.sensorId != b.sensorId ? a.sensorId < b.sensorId : a.bucket.start < b.bucket.start;
+	});
+
+	// Intervals which span the boundary of two windows are aggregated by both shards, and are combined here.
+	size_t merged = 0u;
+	for (size_t i = 0u; i < result.aggregates.size(); i++) {
+		const Aggregate &aggregate = result.aggregates[i];
+		if (merged > 0u) {
+			Aggregate &previous = result.aggregates[merged - 1u];
+			if (previous.sensorId == aggregate.sensorId && previous.bucket.start == aggregate.bucket.start) {
+				previous.bucket.min	 = std::min(previous.bucket.min, aggregate.bucket.min);
+				previous.bucket.max	 = std::max(previous.bucket.max, aggregate.bucket.max);
+				previous.bucket.last = aggregate.bucket.last;
+				previous.bucket.count += aggregate.bucket.count;
+				previous.bucket.sum += aggregate.bucket.sum;
+				continue;
+			}
+		}
+		result.aggregates[merged++] = aggregate;
+	}
+	result.aggregates.resize(merged);
+
+	result.steals  = pool.getSteals() - steals;
+	result.elapsed = std::chrono::duration_cast<Duration>(std::chrono::steady_clock::now() - started);
+	return result;
+}
@@ -0,0 +1,131 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_BusModel.cpp
+ * @brief			: Source for TMP116_BusModel.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_BusModel.hpp"
+
+#include <algorithm>
+
+using BusModel			  = TMP116::BusModel;
+using BusMonitor		  = TMP116::BusMonitor;
+using Operation			  = TMP116::BusModel::Operation;
+using PollPolicy		  = TMP116::BusModel::PollPolicy;
+using ConversionCycleTime = TMP116::Config::ConversionCycleTime;
+using Duration			  = TMP116::Duration;
+using Register			  = TMP116::Register;
+
+/**
+ * @brief Convert a number of SCL clock cycles to a Duration, rounding up.
+ *
+ * @param cycles The number of clock cycles.
+ * @param clockFrequency The SCL clock frequency in Hz.
+ * @return Duration The equivalent bus time.
+ */
+static constexpr Duration convertClockCycles(uint64_t cycles, uint32_t clockFrequency) {
+	return Duration{static_cast<Duration::rep>((cycles * 1'000'000u + clockFrequency - 1u) / clockFrequency)};
+}
+
+/**
+ * @brief Get the next slower Conversion Cycle Time.
+ *
+ * @param conversionCycleTime The current Conversion Cycle Time.
+ * @return std::optional<ConversionCycleTime> The next slower Conversion Cycle Time, or std::nullopt if already slowest.
+ */
+static std::optional<ConversionCycleTime> slowerConversionCycleTime(ConversionCycleTime conversionCycleTime) {
+	if (conversionCycleTime == ConversionCycleTime::CONV_16000MS) return std::nullopt;
+	return static_cast<ConversionCycleTime>(static_cast<Register>(conversionCycleTime) + (1u << 7));
+}
+
+Duration PollPolicy::getPeriod() const {
+	const Duration conversionPeriod = this->config.getConversionPeriod();
+	if (this->period && this->period.value() > conversionPeriod) return this->period.value();
+	else return conversionPeriod;
+}
+
+BusModel::BusModel(uint32_t clockFrequency, float budget)
+	: clockFrequency{std::max(clockFrequency, 1u)}, budget{budget} {}
+
+Duration BusModel::getTransactionTime(Operation operation) const {
+	return convertClockCycles(getClockCycles(operation), this->clockFrequency);
+}
+
+Duration BusModel::getPollTime(const PollPolicy &policy) const {
+	return convertClockCycles(this->getPollCycles(policy), this->clockFrequency);
+}
+
+uint32_t BusModel::getPollCycles(const PollPolicy &policy) const {
+	uint32_t cycles = getClockCycles(Operation::GET_TEMPERATURE);
+	if (policy.pollDataReady) cycles += getClockCycles(Operation::DATA_READY);
+	return cycles;
+}
+
+float BusModel::getOccupancy(const PollPolicy &policy) const {
+	const float pollTime = static_cast<float>(this->getPollCycles(policy)) / static_cast<float>(this->clockFrequency);
+	const float period	 = std::chrono::duration<float>(policy.getPeriod()).count();
+	return pollTime / period;
+}
+
+float BusModel::getOccupancy() const {
+	float occupancy = 0.0f;
+	for (const auto &policy : this->policies) occupancy += this->getOccupancy(policy);
+	return occupancy;
+}
+
+std::optional<PollPolicy> BusModel::fit(PollPolicy policy) const {
+	const float occupancy = this->getOccupancy();
+
+	while (occupancy + this->getOccupancy(policy) > this->budget) {
+		auto slower = slowerConversionCycleTime(policy.config.conversionCycleTime);
+		if (!slower) return std::nullopt;
+		policy.config.conversionCycleTime = slower.value();
+	}
+
+	return policy;
+}
+
+std::optional<PollPolicy> BusModel::admit(PollPolicy policy) {
+	auto fitted = this->fit(policy);
+	if (fitted) this->policies.push_back(fitted.value());
+	return fitted;
+}
+
+void BusModel::clear() { this->policies.clear(); }
+
+BusMonitor::BusMonitor(I2C &i2c, const BusModel &model) : i2c{i2c}, model{model} {}
+
+std::optional<Register> BusMonitor::read(DeviceAddress deviceAddress, MemoryAddress memoryAddress) {
+	this->reads++;
+	auto transmission = this->i2c.read(deviceAddress, memoryAddress);
+	if (!transmission) this->failures++;
+	return transmission;
+}
+
+std::optional<Register> BusMonitor::write(DeviceAddress deviceAddress, MemoryAddress memoryAddress, Register data) {
+	this->writes++;
+	auto transmission = this->i2c.write(deviceAddress, memoryAddress, data);
+	if (!transmission) this->failures++;
+	return transmission;
+}
+
+float BusMonitor::getOccupancy(Duration elapsed) const {
+	if (elapsed <= Duration::zero()) return 0.0f;
+
+	const uint64_t cycles = static_cast<uint64_t>(this->reads) * BusModel::getClockCycles(Operation::GET_TEMPERATURE) +
+							static_cast<uint64_t>(this->writes) * BusModel::getClockCycles(Operation::SET_CONFIG);
+	const float busTime = static_cast<float>(cycles) / static_cast<float>(this->model.getClockFrequency());
+	return busTime / std::chrono::duration<float>(elapsed).count();
+}
+
+float BusMonitor::getOccupancyError(Duration elapsed) const {
+	return this->getOccupancy(elapsed) - this->model.getOccupancy();
+}
+
+void BusMonitor::reset() {
+	this->reads	   = 0u;
+	this->writes   = 0u;
+	this->failures = 0u;
+}
@@ -0,0 +1,217 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_C.cpp
+ * @brief			: Source for TMP116_C.h
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_C.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+using DeviceAddress = TMP116::I2C::DeviceAddress;
+using MemoryAddress = TMP116::I2C::MemoryAddress;
+using Register		= TMP116::I2C::Register;
+using SampleRing	= TMP116::Ring<TMP116::Sample>;
+
+static constexpr size_t CHUNK = 64u; // Samples converted per pop from a ring.
+
+// The layout bindings declare, without implicit padding.
+static_assert(sizeof(TMP116_Sample) == 16u, "TMP116_Sample must be 16 bytes");
+static_assert(offsetof(TMP116_Sample, sensorId) == 8u && offsetof(TMP116_Sample, raw) == 10u);
+static_assert(offsetof(TMP116_Sample, reserved) == 12u);
+
+/**
+ * @brief TMP116::I2C calling the callbacks of a TMP116_Bus.
+ */
+class Bus final : public TMP116::I2C {
+public:
+	explicit Bus(const TMP116_Bus &bus) : bus{bus} {}
+
+	std::optional<Register> read(DeviceAddress deviceAddress, MemoryAddress memoryAddress) override {
+		Register data = 0u;
+		if (this->bus.read(this->bus.context, static_cast<uint8_t>(deviceAddress), memoryAddress, &data) != 0)
+			return std::nullopt;
+		return data;
+	}
+
+	std::optional<Register> write(DeviceAddress deviceAddress, MemoryAddress memoryAddress, Register data) override {
+		if (this->bus.write(this->bus.context, static_cast<uint8_t>(deviceAddress), memoryAddress, data) != 0)
+			return std::nullopt;
+		return data;
+	}
+
+private:
+	TMP116_Bus bus;
+};
+
+struct TMP116_Fleet {
+	struct Sensor {
+		Bus	   bus;
+		TMP116 driver;
+
+		Sensor(const TMP116_Bus &bus, DeviceAddress deviceAddress) : bus{bus}, driver{this->bus, deviceAddress} {}
+	};
+
+	std::vector<std::unique_ptr<Sensor>> sensors; // Held by pointer, as each driver refers to its bus.
+
+	TMP116 *find(TMP116_SensorId sensorId) {
+		return sensorId < this->sensors.size() ? &this->sensors[sensorId]->driver : nullptr;
+	}
+};
+
+static TMP116_Sample toSample(const TMP116::Sample &sample) {
+	return TMP116_Sample{sample.timestamp.count(), sample.sensorId, sample.raw, 0u};
+}
+
+static size_t mark(uint8_t *succeeded, size_t index, bool success) {
+	if (succeeded != nullptr) succeeded[index] = success ? 1u : 0u;
+	return success ? 1u : 0u;
+}
+
+uint32_t TMP116_getAbiVersion(void) { return TMP116_C_ABI_VERSION; }
+
+TMP116_Fleet *TMP116_Fleet_create(void) { return new (std::nothrow) TMP116_Fleet{}; }
+
+void TMP116_Fleet_destroy(TMP116_Fleet *fleet) { delete fleet; }
+
+int32_t TMP116_Fleet_addSensor(TMP116_Fleet *fleet, const TMP116_Bus *bus, uint8_t deviceAddress) {
+	if (fleet == nullptr || bus == nullptr || bus->read == nullptr || bus->write == nullptr) return -1;
+	if (deviceAddress < static_cast<uint8_t>(DeviceAddress::ADD0_GND) ||
+		deviceAddress > static_cast<uint8_t>(DeviceAddress::ADD0_SCL))
+		return -1;
+	if (fleet->sensors.size() > std::numeric_limits<TMP116_SensorId>::max()) return -1;
+
+	// Exceptions must not cross the C interface.
+	try {
+		const auto address = static_cast<DeviceAddress>(deviceAddress);
+		fleet->sensors.push_back(std::make_unique<TMP116_Fleet::Sensor>(*bus, address));
+	} catch (const std::bad_alloc &) {
+		return -1;
+	}
+	return static_cast<int32_t>(fleet->sensors.size() - 1u);
+}
+
+size_t TMP116_Fleet_getSensors(const TMP116_Fleet *fleet) { return fleet != nullptr ? fleet->sensors.size() : 0u; }
+
+size_t TMP116_Fleet_readTemperatures(
+	TMP116_Fleet *fleet, const TMP116_SensorId *sensors, size_t count, float *temperatures
+) {
+	if (fleet == nullptr || (count > 0u && (sensors == nullptr || temperatures == nullptr))) return 0u;
+
+	size_t read = 0u;
+	for (size_t i = 0u; i < count; i++) {
+		TMP116 *const sensor = fleet->find(sensors[i]);
+		const auto	  raw	  = sensor != nullptr ? sensor->getTemperatureRegister() : std::nullopt;
+		const auto	  value	  = static_cast<int16_t>(raw.value_or(0u));
+		const float	  celsius = static_cast<float>(value) * TMP116::TEMPERATURE_RESOLUTION;
+
+		temperatures[i] = raw.has_value() ? celsius : std::numeric_limits<float>::quiet_NaN();
+		read += raw.has_value() ? 1u : 0u;
+	}
+	return read;
+}
+
+size_t TMP116_Fleet_sample(
+	TMP116_Fleet *fleet, const TMP116_SensorId *sensors, size_t count, int64_t timestamp, TMP116_Sample *samples
+) {
+	if (fleet == nullptr || (count > 0u && (sensors == nullptr || samples == nullptr))) return 0u;
+
+	size_t written = 0u;
+	for (size_t i = 0u; i < count; i++) {
+		TMP116 *const sensor = fleet->find(sensors[i]);
+		const auto	  raw	 = sensor != nullptr ? sensor->getTemperatureRegister() : std::nullopt;
+		if (raw.has_value()) samples[written++] = TMP116_Sample{timestamp, sensors[i], *raw, 0u};
+	}
+	return written;
+}
+
+size_t TMP116_Fleet_readConfigs(
+	TMP116_Fleet *fleet, const TMP116_SensorId *sensors, size_t count, uint16_t *configs, uint8_t *succeeded
+) {
+	if (fleet == nullptr || (count > 0u && (sensors == nullptr || configs == nullptr))) return 0u;
+
+	size_t read = 0u;
+	for (size_t i = 0u; i < count; i++) {
+		TMP116 *const sensor = fleet->find(sensors[i]);
+		const auto	  config = sensor != nullptr ? sensor->getConfigRegister() : std::nullopt;
+
+		configs[i] = config.value_or(0u);
+		read += mark(succeeded, i, config.has_value());
+	}
+	return read;
+}
+
+size_t TMP116_Fleet_applyConfigs(
+	TMP116_Fleet *fleet, const TMP116_SensorId *sensors, size_t count, const uint16_t *configs, uint8_t *succeeded
+) {
+	if (fleet == nullptr || (count > 0u && (sensors == nullptr || configs == nullptr))) return 0u;
+
+	size_t written = 0u;
+	for (size_t i = 0u; i < count; i++) {
+		TMP116 *const sensor = fleet->find(sensors[i]);
+		const bool	  success =
+			sensor != nullptr && sensor->setConfig(TMP116::Config{static_cast<Register>(configs[i])}).has_value();
+		written += mark(succeeded, i, success);
+	}
+	return written;
+}
+
+size_t TMP116_Fleet_setLimits(
+	TMP116_Fleet		  *fleet,
+	const TMP116_SensorId *sensors,
+	size_t				   count,
+	const float			  *low,
+	const float			  *high,
+	uint8_t				  *succeeded
+) {
+	if (fleet == nullptr || (count > 0u && (sensors == nullptr || low == nullptr || high == nullptr))) return 0u;
+
+	size_t written = 0u;
+	for (size_t i = 0u; i < count; i++) {
+		TMP116 *const sensor = fleet->find(sensors[i]);
+		bool		  success = sensor != nullptr;
+		success				  = success && sensor->setLowLimit(low[i]).has_value();
+		success				  = success && sensor->setHighLimit(high[i]).has_value();
+		written += mark(succeeded, i, success);
+	}
+	return written;
+}
+
+size_t TMP116_SampleRing_drain(TMP116_SampleRing *ring, TMP116_Sample *samples, size_t capacity) {
+	if (ring == nullptr || (capacity > 0u && samples == nullptr)) return 0u;
+
+	SampleRing &source = *reinterpret_cast<SampleRing *>(ring);
+
+	// Pops in chunks, each one pair of atomic operations on the ring, converting on the stack.
+	TMP116::Sample chunk[CHUNK];
+	size_t		   drained = 0u;
+	while (drained < capacity) {
+		const size_t popped = source.pop(chunk, std::min(CHUNK, capacity - drained));
+		for (size_t i = 0u; i < popped; i++) samples[drained + i] = toSample(chunk[i]);
+		drained += popped;
+		if (popped < CHUNK) break;
+	}
+	return drained;
+}
+
+size_t TMP116_SampleRing_drainAll(
+	TMP116_SampleRing *const *rings, size_t count, TMP116_Sample *samples, size_t capacity
+) {
+	if (count > 0u && rings == nullptr) return 0u;
+
+	size_t drained = 0u;
+	for (size_t i = 0u; i < count && drained < capacity; i++)
+		drained += TMP116_SampleRing_drain(rings[i], samples + drained, capacity - drained);
+	return drained;
+}
+
+size_t TMP116_SampleRing_size(const TMP116_SampleRing *ring) {
+	return ring != nullptr ? reinterpret_cast<const SampleRing *>(ring)->size() : 0u;
+}
@@ -0,0 +1,60 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ChangePublisher.cpp
+ * @brief			: Source for TMP116_ChangePublisher.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_ChangePublisher.hpp"
+
+using ChangePublisher = TMP116::ChangePublisher;
+using Statistics	  = TMP116::ChangePublisher::Statistics;
+using Sample		  = TMP116::Sample;
+using SensorId		  = TMP116::SensorId;
+
+ChangePublisher::ChangePublisher(size_t sensors, uint16_t deadband, Duration heartbeat)
+	: heartbeat{heartbeat}, channels(sensors, Channel{deadband}) {}
+
+bool ChangePublisher::setDeadband(SensorId sensorId, uint16_t deadband) {
+	if (sensorId >= this->channels.size()) return false;
+
+	this->channels[sensorId].deadband = deadband;
+	return true;
+}
+
+std::optional<Sample> ChangePublisher::offer(const Sample &sample) {
+	if (sample.sensorId >= this->channels.size()) return std::nullopt;
+
+	Channel &channel = this->channels[sample.sensorId];
+	channel.statistics.received++;
+	this->total.received++;
+
+	const auto raw	   = static_cast<int16_t>(sample.raw);
+	const auto change  = static_cast<int32_t>(raw) - static_cast<int32_t>(channel.raw);
+	const bool changed = !channel.published || change > channel.deadband || -change > channel.deadband;
+	const bool expired = sample.timestamp - channel.timestamp >= this->heartbeat;
+
+	if (!changed && !expired) {
+		channel.statistics.suppressed++;
+		this->total.suppressed++;
+		return std::nullopt;
+	}
+
+	if (!changed) {
+		channel.statistics.heartbeats++;
+		this->total.heartbeats++;
+	}
+	channel.statistics.published++;
+	this->total.published++;
+
+	channel.published = true;
+	channel.raw		  = raw;
+	channel.timestamp = sample.timestamp;
+	return sample;
+}
+
+std::optional<Statistics> ChangePublisher::getStatistics(SensorId sensorId) const {
+	if (sensorId >= this->channels.size()) return std::nullopt;
+	return this->channels[sensorId].statistics;
+}
@@ -0,0 +1,239 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ColumnarExporter.cpp
+ * @brief			: Source for TMP116_ColumnarExporter.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_ColumnarExporter.hpp"
+
+#include <cstring>
+#include <new>
+
+using ColumnarExporter = TMP116::ColumnarExporter;
+using Buffer		   = TMP116::ColumnarExporter::Buffer;
+using Sample		   = TMP116::Sample;
+using SensorId		   = TMP116::SensorId;
+using Timestamp		   = TMP116::Timestamp;
+
+static constexpr size_t COLUMNS = 3u;
+
+/**
+ * @brief Allocate a zeroed buffer, padded and aligned to ColumnarExporter::ALIGNMENT.
+ *
+ * @param size The size of the buffer in bytes.
+ * @return Buffer The buffer.
+ */
+static Buffer allocateBuffer(size_t size) {
+	const size_t padded = (size + ColumnarExporter::ALIGNMENT - 1u) / ColumnarExporter::ALIGNMENT * ColumnarExporter::ALIGNMENT;
+	auto *buffer = static_cast<uint8_t *>(::operator new[](padded, std::align_val_t{ColumnarExporter::ALIGNMENT}));
+	std::memset(buffer, 0, padded);
+	return Buffer{buffer};
+}
+
+void ColumnarExporter::Deallocate::operator()(uint8_t *buffer) const {
+	::operator delete[](buffer, std::align_val_t{ColumnarExporter::ALIGNMENT});
+}
+
+/**
+ * @brief Private data of an exported array, owning its buffers and children.
+ * @note The array is used by children only, the parent array being owned by the caller.
+ */
+struct ExportedArray {
+	ArrowArray			array{};
+	const void		   *buffers[2]{};
+	ArrowArray		   *children[COLUMNS]{};
+	std::vector<Buffer> owned{};
+};
+
+/**
+ * @brief Release callback of exported arrays.
+ *
+ * @param array The array, released along with any children and dictionary not moved by the consumer.
+ */
+static void releaseArray(ArrowArray *array) {
+	auto *exported = static_cast<ExportedArray *>(array->private_data);
+	for (int64_t i = 0; i < array->n_children; i++) {
+		if (array->children[i]->release != nullptr) array->children[i]->release(array->children[i]);
+	}
+	if (array->dictionary != nullptr && array->dictionary->release != nullptr) array->dictionary->release(array->dictionary);
+
+	array->release = nullptr;
+	delete exported;
+}
+
+/**
+ * @brief Initialise an exported array.
+ *
+ * @param array The array to initialise, or null to allocate a child array owned by its private data.
+ * @param length The number of elements.
+ * @param nullCount The number of null elements.
+ * @param validity The validity bitmap, or null if all elements are valid.
+ * @param values The values buffer, or null for struct arrays.
+ * @return ArrowArray* The array initialised.
+ */
+static ArrowArray *makeArray(ArrowArray *array, size_t length, size_t nullCount, Buffer validity, Buffer values) {
+	auto *exported = new ExportedArray{};
+	if (array == nullptr) array = &exported->array;
+	*array = ArrowArray{};
+
+	exported->buffers[0] = validity.get();
+	exported->buffers[1] = values.get();
+	exported->owned.push_back(std::move(validity));
+	exported->owned.push_back(std::move(values));
+
+	array->length		= static_cast<int64_t>(length);
+	array->null_count	= static_cast<int64_t>(nullCount);
+	array->n_buffers	= exported->buffers[1] != nullptr ? 2 : 1;
+	array->buffers		= exported->buffers;
+	array->children		= exported->children;
+	array->release		= releaseArray;
+	array->private_data = exported;
+	return array;
+}
+
+/**
+ * @brief Private data of an exported schema, owning its children.
+ */
+struct ExportedSchema {
+	ArrowSchema	 schema{};
+	ArrowSchema *children[COLUMNS]{};
+};
+
+/**
+ * @brief Release callback of exported schemas.
+ *
+ * @param schema The schema, released along with any children and dictionary not moved by the consumer.
+ */
+static void releaseSchema(ArrowSchema *schema) {
+	auto *exported = static_cast<ExportedSchema *>(schema->private_data);
+	for (int64_t i = 0; i < schema->n_children; i++) {
+		if (schema->children[i]->release != nullptr) schema->children[i]->release(schema->children[i]);
+	}
+	if (schema->dictionary != nullptr && schema->dictionary->release != nullptr) {
+		schema->dictionary->release(schema->dictionary);
+	}
+
+	schema->release = nullptr;
+	delete exported;
+}
+
+/**
+ * @brief Initialise an exported schema.
+ *
+ * @param schema The schema to initialise, or null to allocate a child schema owned by its private data.
+ * @param format The Arrow format string.
+ * @param name The field name.
+ * @param flags The Arrow field flags.
+ * @return ArrowSchema* The schema initialised.
+ */
+static ArrowSchema *makeSchema(ArrowSchema *schema, const char *format, const char *name, int64_t flags) {
+	auto *exported = new ExportedSchema{};
+	if (schema == nullptr) schema = &exported->schema;
+	*schema = ArrowSchema{};
+
+	schema->format		 = format;
+	schema->name		 = name;
+	schema->flags		 = flags;
+	schema->children	 = exported->children;
+	schema->release		 = releaseSchema;
+	schema->private_data = exported;
+	return schema;
+}
+
+ColumnarExporter::ColumnarExporter(size_t batchSize) : batchSize{batchSize}, lookup(UINT16_MAX + 1u) {
+	this->allocate();
+}
+
+void ColumnarExporter::allocate() {
+	this->timestamps = allocateBuffer(this->batchSize * sizeof(int64_t));
+	this->indices	 = allocateBuffer(this->batchSize * sizeof(int32_t));
+	this->raw		 = allocateBuffer(this->batchSize * sizeof(int16_t));
+	this->validity	 = allocateBuffer((this->batchSize + 7u) / 8u);
+	this->dictionary = allocateBuffer(this->batchSize * sizeof(SensorId));
+}
+
+void ColumnarExporter::appendRow(SensorId sensorId, Timestamp timestamp) {
+	uint32_t &index = this->lookup[sensorId];
+	if (index == 0u) {
+		reinterpret_cast<SensorId *>(this->dictionary.get())[this->dictionarySize++] = sensorId;
+		index = static_cast<uint32_t>(this->dictionarySize);
+	}
+
+	reinterpret_cast<int64_t *>(this->timestamps.get())[this->length] = timestamp.count();
+	reinterpret_cast<int32_t *>(this->indices.get())[this->length]	 = static_cast<int32_t>(index - 1u);
+}
+
+bool ColumnarExporter::append(const Sample &sample) {
+	if (this->isFull()) return false;
+
+	this->appendRow(sample.sensorId, sample.timestamp);
+	reinterpret_cast<int16_t *>(this->raw.get())[this->length] = static_cast<int16_t>(sample.raw);
+	this->validity[this->length / 8u] |= static_cast<uint8_t>(1u << (this->length % 8u));
+	this->length++;
+	return true;
+}
+
+bool ColumnarExporter::appendMissing(SensorId sensorId, Timestamp timestamp) {
+	if (this->isFull()) return false;
+
+	this->appendRow(sensorId, timestamp);
+	this->nullCount++;
+	this->length++;
+	return true;
+}
+
+size_t ColumnarExporter::append(const Sample *samples, size_t count) {
+	size_t appended = 0u;
+	while (appended < count && this->append(samples[appended])) appended++;
+	return appended;
+}
+
+void ColumnarExporter::exportSchema(ArrowSchema *schema) {
+	makeSchema(schema, "+s", "", 0);
+	schema->n_children	= COLUMNS;
+	schema->children[0] = makeSchema(nullptr, "tsu:", "timestamp", 0);
+	schema->children[1] = makeSchema(nullptr, "i", "sensor_id", 0);
+	schema->children[2] = makeSchema(nullptr, "s", "raw", ARROW_FLAG_NULLABLE);
+
+	schema->children[1]->dictionary = makeSchema(nullptr, "S", nullptr, 0);
+}
+
+bool ColumnarExporter::exportBatch(ArrowArray *array) {
+	if (this->length == 0u) return false;
+
+	makeArray(array, this->length, 0u, nullptr, nullptr);
+	array->n_children  = COLUMNS;
+	array->children[0] = makeArray(nullptr, this->length, 0u, nullptr, std::move(this->timestamps));
+	array->children[1] = makeArray(nullptr, this->length, 0u, nullptr, std::move(this->indices));
+	array->children[2] = makeArray(
+		nullptr,
+		this->length,
+		this->nullCount,
+		this->nullCount > 0u ? std::move(this->validity) : nullptr,
+		std::move(this->raw)
+	);
+
+	array->children[1]->dictionary = makeArray(nullptr, this->dictionarySize, 0u, nullptr, std::move(this->dictionary));
+
+	// The dictionary buffer was transferred, so the lookup is cleared from the dictionary exported.
+	const auto *exported = static_cast<const SensorId *>(array->children[1]->dictionary->buffers[1]);
+	for (size_t i = 0u; i < this->dictionarySize; i++) this->lookup[exported[i]] = 0u;
+
+	this->length		 = 0u;
+	this->nullCount		 = 0u;
+	this->dictionarySize = 0u;
+	this->allocate();
+	return true;
+}
+
+void ColumnarExporter::clear() {
+	for (size_t i = 0u; i < this->dictionarySize; i++) {
+		this->lookup[reinterpret_cast<const SensorId *>(this->dictionary.get())[i]] = 0u;
+	}
+	std::memset(this->validity.get(), 0, (this->batchSize + 7u) / 8u);
+	this->length		 = 0u;
+	this->nullCount		 = 0u;
+	this->dictionarySize = 0u;
+}
@@ -0,0 +1,431 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Compactor.cpp
+ * @brief			: Source for TMP116_Compactor.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Compactor.hpp"
+#include "TMP116_Segment.hpp"
+#include "TMP116_Worker.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <optional>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using Compactor	 = TMP116::Compactor;
+using Statistics = TMP116::Compactor::Statistics;
+using Segment	 = TMP116::Segment;
+using Duration	 = TMP116::Duration;
+using Sample	 = TMP116::Sample;
+using SensorId	 = TMP116::SensorId;
+using Timestamp	 = TMP116::Timestamp;
+using Record	 = TMP116::Segment::Record;
+
+static const std::string EXTENSION = ".seg";
+static const std::string TEMPORARY = ".tmp";
+
+/**
+ * @brief A sealed segment of the directory.
+ */
+struct Compactor::Entry {
+	std::string path;
+	uint64_t	size;
+	uint16_t	flags;
+	Timestamp	minTimestamp;
+	Timestamp	maxTimestamp;
+};
+
+/**
+ * @brief Delays a pass so that its bytes read and written do not exceed a rate.
+ */
+class Compactor::Throttle {
+public:
+	Throttle(Compactor &compactor, uint64_t bytesPerSecond)
+		: compactor{compactor}, bytesPerSecond{bytesPerSecond}, start{std::chrono::steady_clock::now()} {}
+
+	/**
+	 * @brief Account for bytes read or written, sleeping until they are within the rate.
+	 *
+	 * @param bytes The number of bytes.
+	 * @return bool False if the compactor is stopping.
+	 */
+	bool consume(uint64_t bytes) {
+		this->total += bytes;
+		if (this->bytesPerSecond == 0u) return !this->compactor.stopping.load(std::memory_order_relaxed);
+
+		const auto due = this->start + std::chrono::microseconds{this->total * 1'000'000u / this->bytesPerSecond};
+		return this->compactor.wait(due);
+	}
+
+private:
+	Compactor							 &compactor;
+	uint64_t							  bytesPerSecond;
+	uint64_t							  total = 0u;
+	std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * @brief Round a time down to a multiple of an interval, also for negative times.
+ */
+static Timestamp floorTo(Timestamp time, Duration interval) {
+	auto index = time.count() / interval.count();
+	if (time.count() < 0 && time.count() % interval.count() != 0) index--;
+	return Timestamp{index * interval.count()};
+}
+
+/**
+ * @brief Get the time before which samples are older than an age.
+ */
+static Timestamp cutoff(Timestamp now, Duration age) {
+	if (age == Duration::max() || now.count() < Timestamp::min().count() + age.count()) return Timestamp::min();
+	return now - age;
+}
+
+static bool endsWith(const std::string &name, const std::string &suffix) {
+	return name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/**
+ * @brief Make renames and unlinks within a directory durable.
+ */
+static void syncDirectory(const std::string &directory) {
+	const int file = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (file < 0) return;
+	fsync(file);
+	::close(file);
+}
+
+Compactor::Compactor(std::string directory, Policy policy)
+	: directory{std::move(directory)}, policy{std::move(policy)} {
+	if (this->policy.rollupInterval <= Duration::zero()) this->policy.rollupInterval = Duration{1};
+	if (!this->policy.clock) this->policy.clock = Worker::now;
+}
+
+Compactor::~Compactor() { this->stop(); }
+
+bool Compactor::start() {
+	if (this->running.exchange(true)) return false;
+
+	this->stopping.store(false);
+	this->thread = std::thread([this]() { this->run(); });
+	return true;
+}
+
+void Compactor::stop() {
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->stopping.store(true);
+	}
+	this->wakeup.notify_all();
+
+	if (this->thread.joinable()) this->thread.join();
+	this->stopping.store(false); // So that compact() may still be called on other threads.
+	this->running.store(false, std::memory_order_release);
+}
+
+bool Compactor::wait(std::chrono::steady_clock::time_point until) {
+	std::unique_lock<std::mutex> lock{this->mutex};
+	return !this->wakeup.wait_until(lock, until, [this]() { return this->stopping.load(); });
+}
+
+void Compactor::run() {
+	for (;;) {
+		this->compact();
+		if (!this->wait(std::chrono::steady_clock::now() + this->policy.period)) return;
+	}
+}
+
+Statistics Compactor::getStatistics() const {
+	std::lock_guard<std::mutex> lock{this->mutex};
+	return this->totals;
+}
+
+std::vector<Compactor::Entry> Compactor::list() const {
+	std::vector<std::string> paths{};
+
+	DIR *directory = opendir(this->directory.c_str());
+	if (directory == nullptr) return {};
+	bool removed = false;
+	while (const dirent *entry = readdir(directory)) {
+		const std::string name{entry->d_name};
+		if (endsWith(name, EXTENSION)) paths.push_back(this->directory + "/" + name);
+		else if (endsWith(name, EXTENSION + TEMPORARY)) {
+			// Passes run one at a time, so outputs under a temporary name were left by an abandoned pass or a crash.
+			removed = unlink((this->directory + "/" + name).c_str()) == 0 || removed;
+		}
+	}
+	closedir(directory);
+	if (removed) syncDirectory(this->directory);
+	std::sort(paths.begin(), paths.end());
+
+	std::vector<Entry> entries{};
+	for (const auto &path : paths) {
+		SegmentReader reader{path};
+		if (!reader.open() || !reader.isSealed()) continue; // Still being written, or to be recovered by its writer.
+
+		Entry entry{path, 0u, reader.getFlags(), Timestamp::max(), Timestamp::min()};
+		for (size_t i = 0u; i < reader.getBlocks(); i++) {
+			const auto &block = reader.getBlock(i);
+			entry.size += sizeof(Segment::Block) + uint64_t{block.count} * sizeof(Segment::Record);
+			if (block.count == 0u) continue;
+			entry.minTimestamp = std::min(entry.minTimestamp, Timestamp{block.minTimestamp});
+			entry.maxTimestamp = std::max(entry.maxTimestamp, Timestamp{block.maxTimestamp});
+		}
+		entries.push_back(entry);
+	}
+	return entries;
+}
+
+Statistics Compactor::compact() {
+	std::lock_guard<std::mutex> lock{this->compacting};
+
+	Statistics pass{};
+	Throttle   throttle{*this, this->policy.bytesPerSecond};
+
+	const Timestamp now		   = this->policy.clock();
+	const Timestamp retain	   = cutoff(now, this->policy.retention);
+	Timestamp		downsample = cutoff(now, this->policy.downsampleAfter);
+
+	// Aligned, so that an interval is never split between a downsampled and a raw segment.
+	if (downsample != Timestamp::min()) downsample = floorTo(downsample, this->policy.rollupInterval);
+
+	std::vector<Entry> inputs{};
+	uint64_t		   bytes = 0u;
+	size_t			   small = 0u;
+	bool			   due	 = false; // Whether any input holds samples to expire or downsample.
+
+	for (const auto &entry : this->list()) {
+		// Segments without samples or with all samples expired are removed without reading them.
+		if (entry.maxTimestamp < retain || entry.minTimestamp > entry.maxTimestamp) {
+			if (unlink(entry.path.c_str()) == 0) pass.segmentsDeleted++;
+			continue;
+		}
+
+		const bool expiring	   = entry.minTimestamp < retain;
+		const bool downsampled = (entry.flags & Segment::DOWNSAMPLED) != 0u;
+		const bool aging	   = !downsampled && entry.minTimestamp < downsample;
+		const bool isSmall	   = entry.size < this->policy.smallSegment;
+		if (!expiring && !aging && !isSmall) continue;
+		if (!inputs.empty() && bytes + entry.size > this->policy.maxRewrite) continue;
+
+		inputs.push_back(entry);
+		bytes += entry.size;
+		small += isSmall ? 1u : 0u;
+		due = due || expiring || aging;
+	}
+	if (pass.segmentsDeleted > 0u) syncDirectory(this->directory);
+
+	if (due || small >= 2u) this->rewrite(inputs, retain, downsample, throttle, pass);
+
+	pass.passes = 1u;
+	std::lock_guard<std::mutex> totalsLock{this->mutex};
+	this->totals.passes += pass.passes;
+	this->totals.segmentsRewritten += pass.segmentsRewritten;
+	this->totals.segmentsWritten += pass.segmentsWritten;
+	this->totals.segmentsDeleted += pass.segmentsDeleted;
+	this->totals.samplesExpired += pass.samplesExpired;
+	this->totals.samplesDownsampled += pass.samplesDownsampled;
+	this->totals.bytesRead += pass.bytesRead;
+	this->totals.bytesWritten += pass.bytesWritten;
+	return pass;
+}
+
+/**
+ * @brief A segment being written by a pass, under a temporary name until finished.
+ */
+struct Compactor::Output {
+	uint16_t					   flags;
+	std::string					   temporary{};
+	std::unique_ptr<SegmentWriter> writer{};
+};
+
+/**
+ * @brief An input segment, read block by block. Downsampled inputs are in order of interval start and then sensor.
+ */
+struct Compactor::Cursor {
+	std::unique_ptr<SegmentReader> reader;
+	size_t						   block = 0u;
+	std::vector<Record>			   records{};
+	size_t						   position = 0u;
+
+	inline bool			 atEnd() const { return position == records.size(); }
+	inline const Record &get() const { return records[position]; }
+};
+
+bool Compactor::rewrite(
+	const std::vector<Entry> &inputs,
+	Timestamp				  retain,
+	Timestamp				  downsample,
+	Throttle				 &throttle,
+	Statistics				 &pass
+) {
+	using Key = std::pair<int64_t, SensorId>; // Interval start and sensor.
+	struct Mean {
+		int64_t	 sum   = 0;
+		uint32_t count = 0u;
+	};
+
+	// Samples are streamed block by block into the outputs, only the means of the intervals being held in memory.
+	Output				raw{0u};
+	Output				old{Segment::DOWNSAMPLED}; // Samples downsampled.
+	std::vector<Cursor> cursors{};				   // Downsampled inputs.
+
+	std::map<Key, Mean>		 means{}; // Of raw samples.
+	uint64_t				 expired = 0u, aged = 0u;
+	std::vector<std::string> outputs{}; // Outputs finished.
+
+	// Read the next block of a cursor once its records are consumed, returning false if unreadable.
+	const auto advance = [&](Cursor &cursor) {
+		for (; cursor.atEnd() && cursor.block < cursor.reader->getBlocks(); cursor.block++) {
+			if (!this->read(cursor, throttle, pass)) return false;
+		}
+		return true;
+	};
+
+	// Abandoned, so the outputs are removed to leave the inputs as the only copy of their samples.
+	const auto abandon = [&]() {
+		for (Output *output : {&old, &raw}) {
+			if (!output->writer) continue;
+			output->writer.reset();
+			unlink(output->temporary.c_str());
+		}
+		for (const auto &output : outputs) unlink(output.c_str());
+		pass.segmentsWritten -= outputs.size();
+		syncDirectory(this->directory);
+		return false;
+	};
+
+	for (const auto &input : inputs) {
+		Cursor cursor{std::make_unique<SegmentReader>(input.path)};
+		if (!cursor.reader->open()) return abandon();
+		if ((cursor.reader->getFlags() & Segment::DOWNSAMPLED) != 0u) {
+			cursors.push_back(std::move(cursor));
+			continue;
+		}
+
+		for (; cursor.block < cursor.reader->getBlocks(); cursor.block++) {
+			if (!this->read(cursor, throttle, pass)) return abandon();
+
+			for (const auto &record : cursor.records) {
+				const Sample sample{record.sensorId, Timestamp{record.timestamp}, record.raw};
+				if (sample.timestamp < retain) expired++;
+				else if (sample.timestamp < downsample) {
+					const auto start = floorTo(sample.timestamp, this->policy.rollupInterval);
+					Mean	  &mean	 = means[{start.count(), sample.sensorId}];
+					mean.sum += static_cast<int16_t>(sample.raw);
+					mean.count++;
+					aged++;
+				} else if (!this->append(raw, sample, throttle)) return abandon();
+			}
+		}
+	}
+
+	// Merge the downsampled inputs with the new means. Means of the same interval and sensor, such as of raw samples
+	// arriving late for an interval already downsampled, are folded into one, weighted by their counts.
+	for (auto &cursor : cursors) {
+		if (!advance(cursor)) return abandon();
+	}
+	// Round half away from zero.
+	const auto average = [](const Key &key, const Mean &mean) {
+		const int64_t half	= static_cast<int64_t>(mean.count / 2u);
+		const int64_t value = (mean.sum >= 0 ? mean.sum + half : mean.sum - half) / static_cast<int64_t>(mean.count);
+		return Sample{key.second, Timestamp{key.first}, static_cast<Register>(static_cast<int16_t>(value))};
+	};
+
+	auto mean = means.begin();
+	for (;;) {
+		std::optional<Key> key{};
+		for (const auto &cursor : cursors) {
+			if (!cursor.atEnd() && (!key || Key{cursor.get().timestamp, cursor.get().sensorId} < *key))
+				key = Key{cursor.get().timestamp, cursor.get().sensorId};
+		}
+		if (mean != means.end() && (!key || mean->first < *key)) key = mean->first;
+		if (!key) break;
+
+		Mean total{};
+		for (auto &cursor : cursors) {
+			while (!cursor.atEnd() && Key{cursor.get().timestamp, cursor.get().sensorId} == *key) {
+				const Record record = cursor.get();
+				cursor.position++;
+				if (!advance(cursor)) return abandon();
+				if (Timestamp{record.timestamp} < retain) {
+					expired++;
+					continue;
+				}
+				const uint32_t count = std::max(record.count, 1u); // Counted once where its count was not recorded.
+				total.sum += static_cast<int16_t>(record.raw) * static_cast<int64_t>(count);
+				total.count += count;
+			}
+		}
+		if (mean != means.end() && mean->first == *key) {
+			total.sum += mean->second.sum;
+			total.count += mean->second.count;
+			mean++;
+		}
+		if (total.count > 0u && !this->append(old, average(*key, total), throttle, total.count)) return abandon();
+	}
+
+	if (!this->finish(old, pass, outputs) || !this->finish(raw, pass, outputs)) return abandon();
+
+	for (const auto &input : inputs) {
+		if (unlink(input.path.c_str()) == 0) pass.segmentsRewritten++;
+	}
+	syncDirectory(this->directory);
+
+	pass.samplesExpired += expired;
+	pass.samplesDownsampled += aged;
+	return true;
+}
+
+bool Compactor::read(Cursor &cursor, Throttle &throttle, Statistics &pass) {
+	if (!cursor.reader->readRecords(cursor.block, cursor.records)) return false;
+	cursor.position = 0u;
+
+	const uint64_t size = sizeof(Segment::Block) + cursor.records.size() * sizeof(Record);
+	pass.bytesRead += size;
+	return throttle.consume(size);
+}
+
+bool Compactor::append(Output &output, const Sample &sample, Throttle &throttle, uint32_t count) {
+	if (!output.writer) {
+		output.temporary = this->name() + TEMPORARY;
+		output.writer	 = std::make_unique<SegmentWriter>(output.temporary, this->policy.blockCapacity, output.flags);
+		if (!output.writer->open()) return false;
+	}
+
+	if (!output.writer->append(sample, count)) return false;
+	if (output.writer->getSamples() % this->policy.blockCapacity != 0u) return true;
+	return throttle.consume(this->policy.blockCapacity * sizeof(Segment::Record));
+}
+
+bool Compactor::finish(Output &output, Statistics &pass, std::vector<std::string> &outputs) {
+	if (!output.writer) return true;
+
+	const bool written = output.writer->seal();
+	pass.bytesWritten += output.writer->getSize();
+	output.writer.reset();
+
+	// Renamed only once sealed and synced, so that the directory never holds a partial output.
+	const std::string path = this->name();
+	if (!written || std::rename(output.temporary.c_str(), path.c_str()) != 0) {
+		unlink(output.temporary.c_str());
+		return false;
+	}
+	outputs.push_back(path);
+	pass.segmentsWritten++;
+	return true;
+}
+
+std::string Compactor::name() {
+	const auto epoch = std::chrono::system_clock::now().time_since_epoch();
+	return this->directory + "/compact-" + std::to_string(std::chrono::duration_cast<Duration>(epoch).count()) + "-" +
+		   std::to_string(this->sequence++) + EXTENSION;
+}
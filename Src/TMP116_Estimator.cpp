@@ -0,0 +1,95 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Estimator.cpp
+ * @brief			: Source for TMP116_Estimator.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Estimator.hpp"
+
+#include <algorithm>
+
+using Estimator = TMP116::Estimator;
+
+/**
+ * @brief Predict and correct every sensor, without branches so that compilers vectorise the loop.
+ */
+static void filter(
+	size_t					sensors,
+	const float *__restrict staged,
+	const float *__restrict fresh,
+	const float *__restrict measurementVariance,
+	const float *__restrict processVariance,
+	float *__restrict		value,
+	float *__restrict		variance,
+	float *__restrict		gain
+) {
+	for (size_t i = 0u; i < sensors; i++) {
+		const float predicted = variance[i] + processVariance[i];
+		const float k		  = fresh[i] * predicted / (predicted + measurementVariance[i]);
+		value[i] += k * (staged[i] - value[i]);
+		// Being (1 - k) times the prediction when corrected, in a form not cancelling when the gain nears one.
+		variance[i] = k * measurementVariance[i] + (1.0f - fresh[i]) * predicted;
+		gain[i]		= k;
+	}
+}
+
+Estimator::Estimator(size_t sensors, Options options)
+	: options{options}, staged(sensors, 0.0f), fresh(sensors, 0.0f), measurementVariance(sensors, 0.0f),
+	  processVariance(sensors, 0.0f), value(sensors, 0.0f), variance(sensors, options.variance), gain(sensors, 0.0f) {
+	for (size_t sensor = 0u; sensor < sensors; sensor++) this->configure(static_cast<SensorId>(sensor), Config{});
+}
+
+Estimator::Estimator(size_t sensors) : Estimator(sensors, Options{}) {}
+
+bool Estimator::configure(SensorId sensorId, const Config &config, std::optional<Duration> interval) {
+	if (sensorId >= this->size()) return false;
+
+	// Averaging N conversions divides the variance of their noise by N, but not that of rounding the result.
+	const float noise					= this->options.noise * TEMPERATURE_RESOLUTION;
+	const float rounding				= TEMPERATURE_RESOLUTION * TEMPERATURE_RESOLUTION / 12.0f;
+	this->measurementVariance[sensorId] = noise * noise / static_cast<float>(config.getAverageCount()) + rounding;
+
+	const auto seconds = std::chrono::duration<float>(interval.value_or(config.getConversionPeriod())).count();
+	this->processVariance[sensorId] = this->options.drift * std::max(seconds, 0.0f);
+	return true;
+}
+
+bool Estimator::observe(const Sample &sample) {
+	if (sample.sensorId >= this->size()) return false;
+
+	this->staged[sample.sensorId] = sample.getTemperature();
+	this->fresh[sample.sensorId]  = 1.0f;
+	return true;
+}
+
+void Estimator::tick() {
+	filter(
+		this->size(),
+		this->staged.data(),
+		this->fresh.data(),
+		this->measurementVariance.data(),
+		this->processVariance.data(),
+		this->value.data(),
+		this->variance.data(),
+		this->gain.data()
+	);
+	std::fill(this->fresh.begin(), this->fresh.end(), 0.0f);
+}
+
+bool Estimator::reset(SensorId sensorId) {
+	if (sensorId >= this->size()) return false;
+
+	this->value[sensorId]	 = 0.0f;
+	this->variance[sensorId] = this->options.variance;
+	this->gain[sensorId]	 = 0.0f;
+	this->fresh[sensorId]	 = 0.0f;
+	return true;
+}
+
+std::optional<Estimator::Estimate> Estimator::getEstimate(SensorId sensorId) const {
+	if (sensorId >= this->size()) return std::nullopt;
+
+	return Estimate{this->value[sensorId], this->variance[sensorId], this->gain[sensorId]};
+}
@@ -0,0 +1,133 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_FilterBank.cpp
+ * @brief			: Source for TMP116_FilterBank.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_FilterBank.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using FilterBank = TMP116::FilterBank;
+using Biquad	 = TMP116::FilterBank::Biquad;
+using Register	 = TMP116::Register;
+
+/**
+ * @brief Convert raw Temperature Register values to degrees Celsius.
+ */
+static void convert(size_t channels, const Register *__restrict raw, float *__restrict output) {
+	for (size_t i = 0u; i < channels; i++)
+		output[i] = static_cast<float>(static_cast<int16_t>(raw[i])) * TMP116::TEMPERATURE_RESOLUTION;
+}
+
+/**
+ * @brief Accumulate one tap of an FIR filter into the output of every channel.
+ */
+static void accumulate(size_t channels, float tap, const float *__restrict input, float *__restrict output) {
+	for (size_t i = 0u; i < channels; i++) output[i] += tap * input[i];
+}
+
+/**
+ * @brief Apply one biquad section to every channel in place, in the transposed direct form II.
+ */
+static void
+biquad(size_t channels, const Biquad &section, float *__restrict z1, float *__restrict z2, float *__restrict signal) {
+	const float b0 = section.b0, b1 = section.b1, b2 = section.b2, a1 = section.a1, a2 = section.a2;
+
+	for (size_t i = 0u; i < channels; i++) {
+		const float x = signal[i];
+		const float y = b0 * x + z1[i];
+		z1[i]		  = b1 * x - a1 * y + z2[i];
+		z2[i]		  = b2 * x - a2 * y;
+		signal[i]	  = y;
+	}
+}
+
+Biquad Biquad::lowPass(float cutoff, float sampleRate, float q) {
+	constexpr float PI = 3.14159265f;
+
+	const float omega = 2.0f * PI * cutoff / sampleRate;
+	const float alpha = std::sin(omega) / (2.0f * q);
+	const float cosw  = std::cos(omega);
+	const float a0	  = 1.0f + alpha;
+
+	Biquad section{};
+	section.b0 = (1.0f - cosw) / 2.0f / a0;
+	section.b1 = (1.0f - cosw) / a0;
+	section.b2 = section.b0;
+	section.a1 = -2.0f * cosw / a0;
+	section.a2 = (1.0f - alpha) / a0;
+	return section;
+}
+
+FilterBank::FilterBank(size_t channels, std::vector<float> taps)
+	: channels{channels}, taps{std::move(taps)}, history(this->taps.size() * channels, 0.0f) {}
+
+FilterBank::FilterBank(size_t channels, std::vector<Biquad> sections)
+	: channels{channels}, sections{std::move(sections)}, state(this->sections.size() * 2u * channels, 0.0f) {}
+
+void FilterBank::process(const Register *raw, float *output) {
+	if (this->isRecursive()) {
+		convert(this->channels, raw, output);
+		for (size_t section = 0u; section < this->sections.size(); section++) {
+			float *const z1 = this->state.data() + section * 2u * this->channels;
+			biquad(this->channels, this->sections[section], z1, z1 + this->channels, output);
+		}
+		return;
+	}
+
+	if (this->taps.empty()) return;
+
+	// The newest frame replaces the oldest row of the ring, then each tap is applied to the row of its delay.
+	const size_t rows = this->taps.size();
+	this->head		  = this->head == 0u ? rows - 1u : this->head - 1u;
+	float *const row  = this->history.data() + this->head * this->channels;
+	convert(this->channels, raw, row);
+
+	std::fill(output, output + this->channels, 0.0f);
+	for (size_t tap = 0u; tap < rows; tap++) {
+		const size_t delayed = (this->head + tap) % rows;
+		accumulate(this->channels, this->taps[tap], this->history.data() + delayed * this->channels, output);
+	}
+}
+
+void FilterBank::process(const Register *raw, size_t frames, float *output) {
+	for (size_t frame = 0u; frame < frames; frame++)
+		this->process(raw + frame * this->channels, output + frame * this->channels);
+}
+
+void FilterBank::prime(const Register *raw) {
+	std::vector<float> input(this->channels);
+	convert(this->channels, raw, input.data());
+
+	if (!this->isRecursive()) {
+		for (size_t row = 0u; row < this->taps.size(); row++)
+			std::copy(input.begin(), input.end(), this->history.begin() + row * this->channels);
+		return;
+	}
+
+	// The steady state of each section is found from its DC gain, which is the input of the next section.
+	for (size_t section = 0u; section < this->sections.size(); section++) {
+		const Biquad &s	   = this->sections[section];
+		const float	  gain = (s.b0 + s.b1 + s.b2) / (1.0f + s.a1 + s.a2);
+		float *const  z1   = this->state.data() + section * 2u * this->channels;
+		float *const  z2   = z1 + this->channels;
+
+		for (size_t i = 0u; i < this->channels; i++) {
+			const float x = input[i];
+			const float y = gain * x;
+			z2[i]		  = s.b2 * x - s.a2 * y;
+			z1[i]		  = s.b1 * x - s.a1 * y + z2[i];
+			input[i]	  = y;
+		}
+	}
+}
+
+void FilterBank::reset() {
+	std::fill(this->history.begin(), this->history.end(), 0.0f);
+	std::fill(this->state.begin(), this->state.end(), 0.0f);
+	this->head = 0u;
+}
@@ -0,0 +1,105 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Formatter.cpp
+ * @brief			: Source for TMP116_Formatter.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Formatter.hpp"
+
+#include <cstring>
+
+using Formatter = TMP116::Formatter;
+using Register	= TMP116::Register;
+
+static constexpr uint32_t POWERS_OF_TEN[] = {1u, 10u, 100u, 1'000u, 10'000u, 100'000u, 1'000'000u, 10'000'000u};
+
+static constexpr char DIGIT_PAIRS[] = "00010203040506070809"
+									  "10111213141516171819"
+									  "20212223242526272829"
+									  "30313233343536373839"
+									  "40414243444546474849"
+									  "50515253545556575859"
+									  "60616263646566676869"
+									  "70717273747576777879"
+									  "80818283848586878889"
+									  "90919293949596979899";
+
+/**
+ * @brief Write a number of exactly a given number of digits, zero padded.
+ *
+ * @param value The number. Must be less than 10^digits.
+ * @param digits The number of digits.
+ * @param buffer The buffer to write to.
+ */
+static void writeDigits(uint32_t value, size_t digits, char *buffer) {
+	while (digits >= 2u) {
+		digits -= 2u;
+		std::memcpy(buffer + digits, DIGIT_PAIRS + (value % 100u) * 2u, 2u);
+		value /= 100u;
+	}
+	if (digits) buffer[0] = static_cast<char>('0' + value % 10u);
+}
+
+/**
+ * @brief Get the number of digits of an integer part, being at most 256.
+ *
+ * @param value The integer part.
+ * @return size_t The number of digits.
+ */
+static constexpr size_t countDigits(uint32_t value) { return value >= 100u ? 3u : value >= 10u ? 2u : 1u; }
+
+size_t Formatter::format(Register raw, char *buffer, uint8_t decimals) {
+	if (decimals > EXACT_DECIMALS) decimals = EXACT_DECIMALS;
+
+	const int32_t  value	 = static_cast<int16_t>(raw);
+	const uint64_t magnitude = static_cast<uint64_t>(value < 0 ? -value : value);
+
+	// Scale to units of 10^-decimals, rounding half away from zero. Exact when decimals is EXACT_DECIMALS.
+	const uint32_t scale  = POWERS_OF_TEN[decimals];
+	const auto	   scaled = static_cast<uint32_t>((magnitude * scale + 64u) >> 7u);
+
+	const uint32_t integer	  = scaled / scale;
+	const uint32_t fractional = scaled % scale;
+
+	size_t length = 0u;
+	if (value < 0 && scaled != 0u) buffer[length++] = '-';
+
+	const size_t digits = countDigits(integer);
+	writeDigits(integer, digits, buffer + length);
+	length += digits;
+
+	if (decimals) {
+		buffer[length++] = '.';
+		writeDigits(fractional, decimals, buffer + length);
+		length += decimals;
+	}
+	return length;
+}
+
+Formatter::Result Formatter::format(
+	const Register *raws,
+	size_t			count,
+	char		   *buffer,
+	size_t			size,
+	uint8_t			decimals,
+	char			separator
+) {
+	Result result{0u, 0u};
+	char   scratch[MAX_LENGTH];
+
+	for (; result.values < count; result.values++) {
+		if (size - result.length > MAX_LENGTH) {
+			result.length += format(raws[result.values], buffer + result.length, decimals);
+		} else {
+			// Near the end of the buffer, format into scratch space and only copy if it fits.
+			const size_t length = format(raws[result.values], scratch, decimals);
+			if (size - result.length < length + 1u) break;
+			std::memcpy(buffer + result.length, scratch, length);
+			result.length += length;
+		}
+		buffer[result.length++] = separator;
+	}
+	return result;
+}
@@ -0,0 +1,215 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Fusion.cpp
+ * @brief			: Source for TMP116_Fusion.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Fusion.hpp"
+#include "TMP116_Vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using Fusion = TMP116::Fusion;
+using Sample = TMP116::Sample;
+
+// Stands in for members without a reading, sorting them after every reading. Finite, so that the median candidates
+// summing two of them neither overflow nor raise invalid operations.
+static constexpr float ABSENT = 1e30f;
+
+/**
+ * @brief Replace missing readings with ABSENT, noting which are present.
+ */
+static void prepare(
+	size_t sensors, const float *__restrict readings, float *__restrict values, float *__restrict present
+) {
+	for (size_t i = 0u; i < sensors; i++) {
+		const bool valid = !std::isnan(readings[i]);
+		values[i]		 = valid ? readings[i] : ABSENT;
+		present[i]		 = valid ? 1.0f : 0.0f;
+	}
+}
+
+/**
+ * @brief Gather the readings of one member slot of every set, counting the members read.
+ */
+static void gather(
+	size_t					   sets,
+	const uint32_t *__restrict members,
+	const float *__restrict	   values,
+	const float *__restrict	   present,
+	float *__restrict		   gathered,
+	float *__restrict		   counts
+) {
+	for (size_t i = 0u; i < sets; i++) {
+		gathered[i] = values[members[i]];
+		counts[i] += present[members[i]];
+	}
+}
+
+/**
+ * @brief Compare and exchange two member slots of every set, leaving the lower reading in the first.
+ */
+static void exchange(size_t sets, float *__restrict low, float *__restrict high) {
+	for (size_t i = 0u; i < sets; i++) {
+		const float a = low[i];
+		const float b = high[i];
+		low[i]		  = std::min(a, b);
+		high[i]		  = std::max(a, b);
+	}
+}
+
+/**
+ * @brief Select the median and spread of the sorted readings of every set by its count of members read.
+ */
+static void select(
+	size_t					sets,
+	const float *__restrict a0,
+	const float *__restrict a1,
+	const float *__restrict a2,
+	const float *__restrict a3,
+	const float *__restrict counts,
+	float *__restrict		fused,
+	float *__restrict		spreads
+) {
+	for (size_t i = 0u; i < sets; i++) {
+		const float n  = counts[i];
+		const float g1 = n < 1.0f ? 0.0f : 1.0f; // At least one member read.
+		const float g2 = n < 2.0f ? 0.0f : 1.0f;
+		const float g3 = n < 3.0f ? 0.0f : 1.0f;
+		const float n4 = n < 4.0f ? 0.0f : 1.0f;
+		const float n1 = g1 - g2; // Exactly one member read.
+		const float n2 = g2 - g3;
+		const float n3 = g3 - n4;
+
+		// Readings past the count are ABSENT, but finite, so zeroing them by their masks is exact.
+		const float median  = n1 * a0[i] + n2 * 0.5f * (a0[i] + a1[i]) + n3 * a1[i] + n4 * 0.5f * (a1[i] + a2[i]);
+		const float highest = n1 * a0[i] + n2 * a1[i] + n3 * a2[i] + n4 * a3[i];
+
+		// Without a reading every mask is zero and so is each sum, which divided by zero is NaN.
+		fused[i]   = median / g1;
+		spreads[i] = (highest - g1 * a0[i]) / g1;
+	}
+}
+
+/**
+ * @brief Vote one member slot of every set against the fused value, adding its bit to the outliers if beyond the
+ * tolerance. Members without a reading neither agree nor are outliers.
+ */
+static void vote(
+	size_t					sets,
+	const float *__restrict gathered,
+	const float *__restrict fused,
+	float					tolerance,
+	float					bit,
+	float *__restrict		agreeing,
+	float *__restrict		outliers
+) {
+	for (size_t i = 0u; i < sets; i++) {
+		const float valid = gathered[i] < ABSENT ? 1.0f : 0.0f;
+		const float agree = std::fabs(gathered[i] - fused[i]) <= tolerance ? 1.0f : 0.0f;
+		agreeing[i] += valid * agree;
+		outliers[i] += valid * (1.0f - agree) * bit;
+	}
+}
+
+Fusion::Fusion(size_t sensors, const std::vector<Set> &sets, float tolerance)
+	: tolerance{tolerance}, readings(sensors + 1u, MISSING), values(sensors + 1u, ABSENT),
+	  present(sensors + 1u, 0.0f), counts(sets.size(), 0.0f), fused(sets.size(), MISSING),
+	  spreads(sets.size(), MISSING), agreeing(sets.size(), 0.0f), outliers(sets.size(), 0.0f) {
+	for (size_t slot = 0u; slot < MEMBERS; slot++) {
+		this->members[slot].assign(sets.size(), static_cast<uint32_t>(sensors));
+		this->gathered[slot].assign(sets.size(), ABSENT);
+		this->sorted[slot].assign(sets.size(), ABSENT);
+	}
+
+	for (size_t set = 0u; set < sets.size(); set++) {
+		const size_t size = std::min(sets[set].size(), MEMBERS);
+		for (size_t slot = 0u; slot < size; slot++) {
+			const SensorId sensor = sets[set][slot];
+			if (sensor < sensors) this->members[slot][set] = sensor;
+		}
+	}
+}
+
+bool Fusion::update(const Sample &sample) {
+	if (sample.sensorId >= this->getSensors()) return false;
+
+	this->readings[sample.sensorId] = sample.getTemperature();
+	return true;
+}
+
+bool Fusion::clear(SensorId sensorId) {
+	if (sensorId >= this->getSensors()) return false;
+
+	this->readings[sensorId] = MISSING;
+	return true;
+}
+
+void Fusion::tick() {
+	const size_t sets = this->fused.size();
+	prepare(this->readings.size(), this->readings.data(), this->values.data(), this->present.data());
+
+	std::fill(this->counts.begin(), this->counts.end(), 0.0f);
+	for (size_t slot = 0u; slot < MEMBERS; slot++) {
+		gather(
+			sets,
+			this->members[slot].data(),
+			this->values.data(),
+			this->present.data(),
+			this->gathered[slot].data(),
+			this->counts.data()
+		);
+		this->sorted[slot] = this->gathered[slot];
+	}
+
+	// Optimal sorting network of four, members without a reading sorting last.
+	auto &sorted = this->sorted;
+	exchange(sets, sorted[0].data(), sorted[1].data());
+	exchange(sets, sorted[2].data(), sorted[3].data());
+	exchange(sets, sorted[0].data(), sorted[2].data());
+	exchange(sets, sorted[1].data(), sorted[3].data());
+	exchange(sets, sorted[1].data(), sorted[2].data());
+
+	select(
+		sets,
+		sorted[0].data(),
+		sorted[1].data(),
+		sorted[2].data(),
+		sorted[3].data(),
+		this->counts.data(),
+		this->fused.data(),
+		this->spreads.data()
+	);
+
+	std::fill(this->agreeing.begin(), this->agreeing.end(), 0.0f);
+	std::fill(this->outliers.begin(), this->outliers.end(), 0.0f);
+	for (size_t slot = 0u; slot < MEMBERS; slot++) {
+		vote(
+			sets,
+			this->gathered[slot].data(),
+			this->fused.data(),
+			this->tolerance,
+			static_cast<float>(1u << slot),
+			this->agreeing.data(),
+			this->outliers.data()
+		);
+	}
+}
+
+std::optional<Fusion::Result> Fusion::getResult(size_t set) const {
+	if (set >= this->fused.size()) return std::nullopt;
+
+	const auto read		= static_cast<uint8_t>(this->counts[set]);
+	const auto agreeing = static_cast<uint8_t>(this->agreeing[set]);
+	return Result{
+		this->fused[set],
+		this->spreads[set],
+		read,
+		agreeing,
+		static_cast<uint8_t>(this->outliers[set]),
+		2u * agreeing <= read,
+	};
+}
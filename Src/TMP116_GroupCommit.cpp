@@ -0,0 +1,166 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_GroupCommit.cpp
+ * @brief			: Source for TMP116_GroupCommit.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_GroupCommit.hpp"
+
+#include <algorithm>
+
+using GroupCommitWriter = TMP116::GroupCommitWriter;
+using JitterRecorder	= TMP116::JitterRecorder;
+using Duration			= TMP116::Duration;
+using Sample			= TMP116::Sample;
+
+GroupCommitWriter::GroupCommitWriter(std::string path, Options options)
+	: options{options}, writer{std::move(path), options.blockCapacity} {
+	if (this->options.batchSize == 0u) this->options.batchSize = 1u;
+	if (this->options.capacity < this->options.batchSize) this->options.capacity = this->options.batchSize;
+	this->pending.reserve(this->options.capacity);
+}
+
+GroupCommitWriter::~GroupCommitWriter() { this->stop(); }
+
+bool GroupCommitWriter::start() {
+	if (this->running.exchange(true)) return false;
+
+	// Reopening the segment would truncate the samples already made durable.
+	if (this->started || !this->writer.open()) {
+		this->running.store(false);
+		return false;
+	}
+
+	this->started = true;
+	this->thread = std::thread([this]() { this->run(); });
+	return true;
+}
+
+void GroupCommitWriter::stop() {
+	if (!this->running.load(std::memory_order_acquire)) return;
+
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->stopping = true;
+	}
+	this->pendingReady.notify_one();
+	if (this->thread.joinable()) this->thread.join();
+
+	this->writer.seal();
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->running.store(false, std::memory_order_release);
+	}
+	this->committed.notify_all();
+}
+
+bool GroupCommitWriter::enqueue(const Sample *samples, size_t count, std::promise<bool> *promise) {
+	bool notify = false;
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		if (this->stopping || !this->running.load(std::memory_order_relaxed) ||
+			this->pending.size() + count > this->options.capacity) {
+			this->statistics.refused += count;
+			return false;
+		}
+
+		if (this->pending.empty()) {
+			this->oldest = Clock::now();
+			notify		 = true; // The commit thread now has a deadline to wait for.
+		}
+		this->pending.insert(this->pending.end(), samples, samples + count);
+		this->appended += count;
+		if (promise != nullptr) this->promises.push_back(std::move(*promise));
+		notify = notify || this->pending.size() >= this->options.batchSize;
+	}
+	if (notify) this->pendingReady.notify_one();
+	return true;
+}
+
+bool GroupCommitWriter::append(const Sample *samples, size_t count) {
+	return this->enqueue(samples, count, nullptr);
+}
+
+std::future<bool> GroupCommitWriter::appendDurable(const Sample *samples, size_t count) {
+	std::promise<bool> promise{};
+	auto			   future = promise.get_future();
+	if (!this->enqueue(samples, count, &promise)) promise.set_value(false);
+	return future;
+}
+
+bool GroupCommitWriter::flush() {
+	std::unique_lock<std::mutex> lock{this->mutex};
+	const uint64_t				 target = this->appended;
+	this->requested						= target;
+	this->pendingReady.notify_one();
+
+	this->committed.wait(lock, [this, target]() {
+		return this->durable >= target || !this->running.load(std::memory_order_relaxed);
+	});
+	return this->durable >= target && !this->failed;
+}
+
+JitterRecorder GroupCommitWriter::getCommitLatency() const {
+	std::lock_guard<std::mutex> lock{this->mutex};
+	return this->latency;
+}
+
+GroupCommitWriter::Statistics GroupCommitWriter::getStatistics() const {
+	std::lock_guard<std::mutex> lock{this->mutex};
+	return this->statistics;
+}
+
+void GroupCommitWriter::run() {
+	std::vector<Sample>				group{};
+	std::vector<std::promise<bool>> promises{};
+	group.reserve(this->options.capacity);
+
+	std::unique_lock<std::mutex> lock{this->mutex};
+	for (;;) {
+		if (this->pending.empty()) {
+			if (this->stopping) return;
+			this->pendingReady.wait(lock, [this]() { return this->stopping || !this->pending.empty(); });
+			continue;
+		}
+
+		const auto deadline = this->oldest + this->options.maxDelay;
+		if (!this->stopping && this->pending.size() < this->options.batchSize && this->requested <= this->durable &&
+			Clock::now() < deadline) {
+			this->pendingReady.wait_until(lock, deadline);
+			continue;
+		}
+
+		// Swapped, so that producers append to the other buffer while this group is written.
+		std::swap(group, this->pending);
+		std::swap(promises, this->promises);
+		const uint64_t			target = this->appended;
+		const Clock::time_point first  = this->oldest;
+		const bool				broken = this->failed;
+		lock.unlock();
+
+		bool written = !broken;
+		for (size_t i = 0u; written && i < group.size(); i++) written = this->writer.append(group[i]);
+		written = written && this->writer.sync();
+
+		lock.lock();
+		this->durable = target;
+		this->failed  = this->failed || !written;
+		if (written) {
+			this->statistics.commits++;
+			this->statistics.samples += group.size();
+			this->statistics.largest = std::max(this->statistics.largest, group.size());
+			this->latency.record(
+				std::chrono::duration_cast<Duration>(first.time_since_epoch()),
+				std::chrono::duration_cast<Duration>(Clock::now().time_since_epoch())
+			);
+		} else this->statistics.failures++;
+
+		// Completed once accounted for, so that producers woken see the statistics of their commit.
+		for (auto &promise : promises) promise.set_value(written);
+		group.clear();
+		promises.clear();
+		this->committed.notify_all();
+	}
+}
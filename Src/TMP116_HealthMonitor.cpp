@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_HealthMonitor.cpp
+ * @brief			: Source for TMP116_HealthMonitor.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_HealthMonitor.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+
+using HealthMonitor = TMP116::HealthMonitor;
+using Status		= TMP116::HealthMonitor::Status;
+using Sample		= TMP116::Sample;
+
+HealthMonitor::HealthMonitor(size_t sensors, Options options)
+	: options{options}, staged(sensors, 0), fresh(sensors, 0), last(sensors, 0), seen(sensors, 0), run(sensors, 0u),
+	  stepRate(sensors, 0.0f), verifications(sensors, 0u), verified(sensors, 0u), noiseFloor(sensors, 0.0f),
+	  stepLimit(sensors, 0), runLimit(sensors, 0.0f), verifiedScore(sensors, 1.0f), score(sensors, 1.0f) {
+	for (size_t sensor = 0u; sensor < sensors; sensor++) this->configure(static_cast<SensorId>(sensor), Config{});
+}
+
+HealthMonitor::HealthMonitor(size_t sensors) : HealthMonitor(sensors, Options{}) {}
+
+bool HealthMonitor::configure(SensorId sensorId, const Config &config) {
+	if (sensorId >= this->size()) return false;
+
+	// Averaging lowers the noise floor, lengthening the runs of identical values expected of a healthy sensor.
+	const float averaging	   = std::sqrt(static_cast<float>(config.getAverageCount()));
+	const float floor		   = this->options.noise / averaging;
+	this->noiseFloor[sensorId] = floor;
+	this->stepLimit[sensorId]  = static_cast<int32_t>(std::ceil(this->options.stepFactor * std::max(floor, 1.0f)));
+	this->runLimit[sensorId]   = static_cast<float>(this->options.stuckRun) * averaging;
+	return true;
+}
+
+bool HealthMonitor::observe(const Sample &sample) {
+	if (sample.sensorId >= this->size()) return false;
+
+	this->staged[sample.sensorId] = static_cast<int16_t>(sample.raw);
+	this->fresh[sample.sensorId]  = 1;
+	return true;
+}
+
+bool HealthMonitor::verify(SensorId sensorId, std::optional<Register> deviceId) {
+	if (sensorId >= this->size()) return false;
+
+	const bool failed			  = !deviceId || (deviceId.value() & 0x0FFFu) != 0x0116u;
+	this->verifications[sensorId] = static_cast<uint8_t>((this->verifications[sensorId] << 1u) | (failed ? 1u : 0u));
+	if (this->verified[sensorId] < VERIFICATIONS) this->verified[sensorId]++;
+
+	const auto failures			  = std::bitset<8>(this->verifications[sensorId]).count();
+	this->verifiedScore[sensorId] = 1.0f - static_cast<float>(failures) / static_cast<float>(VERIFICATIONS);
+	if (failed) this->verifiedScore[sensorId] = 0.0f; // The last verification failing outweighs the history.
+	return true;
+}
+
+/**
+ * @brief Compare the samples staged for each sensor against its last sample, without branches so as to be vectorised.
+ */
+static void compareSamples(
+	size_t					  sensors,
+	const int32_t *__restrict staged,
+	int32_t *__restrict		  fresh,
+	int32_t *__restrict		  last,
+	int32_t *__restrict		  seen,
+	uint32_t *__restrict	  run,
+	float *__restrict		  stepRate,
+	const int32_t *__restrict stepLimit,
+	float					  smoothing
+) {
+	for (size_t i = 0u; i < sensors; i++) {
+		const int32_t  compared	 = fresh[i] & seen[i];
+		const int32_t  step		 = staged[i] - last[i];
+		const int32_t  magnitude = step < 0 ? -step : step;
+		const int32_t  jump		 = compared & static_cast<int32_t>(magnitude > stepLimit[i]);
+		const uint32_t repeated	 = static_cast<uint32_t>(compared & static_cast<int32_t>(step == 0));
+
+		// Runs are extended by repeated values, restarted by changed values and kept by sensors without a sample.
+		run[i] = (run[i] + repeated) * (repeated | static_cast<uint32_t>(compared ^ 1));
+		stepRate[i] += static_cast<float>(compared) * smoothing * (static_cast<float>(jump) - stepRate[i]);
+		last[i] += fresh[i] * step;
+		seen[i] |= fresh[i];
+		fresh[i] = 0;
+	}
+}
+
+/**
+ * @brief Score each sensor, from 1.0 when healthy to 0.0, without branches so as to be vectorised.
+ */
+static void scoreSensors(
+	size_t					   sensors,
+	const uint32_t *__restrict run,
+	const float *__restrict	   runLimit,
+	const float *__restrict	   stepRate,
+	const float *__restrict	   verifiedScore,
+	float *__restrict		   score,
+	float					   noisyRate
+) {
+	for (size_t i = 0u; i < sensors; i++) {
+		const float unstuck = 1.0f - static_cast<float>(run[i]) / runLimit[i];
+		const float quiet	= 1.0f - stepRate[i] / noisyRate;
+		score[i]			= (unstuck > 0.0f ? unstuck : 0.0f) * (quiet > 0.0f ? quiet : 0.0f) * verifiedScore[i];
+	}
+}
+
+void HealthMonitor::tick() {
+	compareSamples(
+		this->size(),
+		this->staged.data(),
+		this->fresh.data(),
+		this->last.data(),
+		this->seen.data(),
+		this->run.data(),
+		this->stepRate.data(),
+		this->stepLimit.data(),
+		this->options.smoothing
+	);
+	scoreSensors(
+		this->size(),
+		this->run.data(),
+		this->runLimit.data(),
+		this->stepRate.data(),
+		this->verifiedScore.data(),
+		this->score.data(),
+		this->options.noisyRate
+	);
+}
+
+std::optional<HealthMonitor::Health> HealthMonitor::getHealth(SensorId sensorId) const {
+	if (sensorId >= this->size()) return std::nullopt;
+
+	Health health{};
+	health.score	  = this->score[sensorId];
+	health.run		  = this->run[sensorId];
+	health.stepRate	  = this->stepRate[sensorId];
+	health.failures	  = static_cast<uint32_t>(std::bitset<8>(this->verifications[sensorId]).count());
+	health.noiseFloor = this->noiseFloor[sensorId];
+
+	if (this->verified[sensorId] > 0u && (this->verifications[sensorId] & 1u)) health.status = Status::UNVERIFIED;
+	else if (static_cast<float>(health.run) >= this->runLimit[sensorId]) health.status = Status::STUCK;
+	else if (health.stepRate >= this->options.noisyRate) health.status = Status::NOISY;
+	else if (!this->seen[sensorId]) health.status = Status::UNKNOWN;
+	else health.status = Status::HEALTHY;
+	return health;
+}
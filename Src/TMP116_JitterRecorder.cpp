@@ -0,0 +1,57 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_JitterRecorder.cpp
+ * @brief			: Source for TMP116_JitterRecorder.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_JitterRecorder.hpp"
+
+using JitterRecorder = TMP116::JitterRecorder;
+using Duration		 = TMP116::Duration;
+using Timestamp		 = TMP116::Timestamp;
+
+/**
+ * @brief Get the histogram bucket of a lateness.
+ *
+ * @param lateness The lateness of a read.
+ * @return size_t The bucket index.
+ */
+static size_t getBucketIndex(Duration lateness) {
+	if (lateness.count() < 1) return 0u;
+
+	auto   value  = static_cast<uint64_t>(lateness.count());
+	size_t bucket = 1u;
+	while (value > 1u && bucket < JitterRecorder::BUCKETS - 1u) {
+		value >>= 1u;
+		bucket++;
+	}
+	return bucket;
+}
+
+void JitterRecorder::record(Timestamp planned, Timestamp actual) {
+	const Duration lateness = actual - planned;
+
+	this->buckets[getBucketIndex(lateness)]++;
+	this->count++;
+	this->sum += lateness;
+	if (lateness < this->min) this->min = lateness;
+	if (lateness > this->max) this->max = lateness;
+}
+
+Duration JitterRecorder::getPercentile(float fraction) const {
+	if (this->count == 0u) return Duration::zero();
+
+	const auto target	  = static_cast<uint64_t>(fraction * static_cast<float>(this->count));
+	uint64_t   cumulative = 0u;
+	for (size_t bucket = 0u; bucket < BUCKETS; bucket++) {
+		cumulative += this->buckets[bucket];
+		if (cumulative >= target && cumulative > 0u) return Duration{bucket == 0u ? 1 : (1ll << bucket)};
+	}
+	return this->max;
+}
+
+Duration JitterRecorder::getMean() const { return this->count ? this->sum / this->count : Duration::zero(); }
+
+void JitterRecorder::reset() { *this = JitterRecorder{}; }
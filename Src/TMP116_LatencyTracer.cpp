@@ -0,0 +1,83 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_LatencyTracer.cpp
+ * @brief			: Source for TMP116_LatencyTracer.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_LatencyTracer.hpp"
+
+#include <cstdio>
+
+using LatencyTracer  = TMP116::LatencyTracer;
+using JitterRecorder = TMP116::JitterRecorder;
+using Hop			 = TMP116::Trace::Hop;
+using Sample		 = TMP116::Sample;
+using Timestamp		 = TMP116::Timestamp;
+
+void LatencyTracer::receive(Sample &sample, Timestamp now) {
+	sample.stamp(Hop::RECEIPT, now);
+	this->record(sample);
+}
+
+void LatencyTracer::record(const Sample &sample) {
+	const auto conversion = sample.getStamp(Hop::CONVERSION);
+	if (conversion) this->hops[static_cast<size_t>(Hop::CONVERSION)].record(conversion.value(), sample.timestamp);
+
+	Timestamp previous = sample.timestamp;
+	for (size_t hop = static_cast<size_t>(Hop::READ); hop < Trace::HOPS; hop++) {
+		const auto stamp = sample.getStamp(static_cast<Hop>(hop));
+		if (!stamp) continue;
+
+		this->hops[hop].record(previous, stamp.value());
+		previous = stamp.value();
+	}
+
+	this->age.record(conversion.value_or(sample.timestamp), previous);
+}
+
+std::string LatencyTracer::report() const {
+	std::string report{};
+	char		line[128];
+
+	const auto append = [&report, &line](const char *name, const JitterRecorder &recorder) {
+		if (recorder.getCount() == 0u) return;
+		std::snprintf(
+			line,
+			sizeof(line),
+			"%-10s %10u %10lld %10lld %10lld %10lld\n",
+			name,
+			recorder.getCount(),
+			static_cast<long long>(recorder.getMean().count()),
+			static_cast<long long>(recorder.getPercentile(0.5f).count()),
+			static_cast<long long>(recorder.getPercentile(0.99f).count()),
+			static_cast<long long>(recorder.getMax().count())
+		);
+		report += line;
+	};
+
+	report += "hop             count    mean_us     p50_us     p99_us     max_us\n";
+	for (size_t hop = 0u; hop < Trace::HOPS; hop++) append(getName(static_cast<Hop>(hop)), this->hops[hop]);
+	append("age", this->age);
+	return report;
+}
+
+void LatencyTracer::reset() {
+	for (auto &hop : this->hops) hop.reset();
+	this->age.reset();
+}
+
+const char *LatencyTracer::getName(Hop hop) {
+	switch (hop) {
+	case Hop::CONVERSION: return "conversion";
+	case Hop::READ: return "read";
+	case Hop::ENQUEUE: return "enqueue";
+	case Hop::STAGE_0: return "stage 0";
+	case Hop::STAGE_1: return "stage 1";
+	case Hop::STAGE_2: return "stage 2";
+	case Hop::STAGE_3: return "stage 3";
+	case Hop::RECEIPT: return "receipt";
+	}
+	return "unknown";
+}
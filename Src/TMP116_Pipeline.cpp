@@ -0,0 +1,181 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Pipeline.cpp
+ * @brief			: Source for TMP116_Pipeline.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Pipeline.hpp"
+
+using Pipeline	   = TMP116::Pipeline;
+using Backpressure = TMP116::Pipeline::Backpressure;
+using Duration	   = TMP116::Duration;
+using Timestamp	   = TMP116::Timestamp;
+using Sample	   = TMP116::Sample;
+using Trace	   = TMP116::Trace;
+
+Pipeline::Pipeline(ThreadPool &pool) : pool{pool} {}
+
+Pipeline::~Pipeline() { this->flush(); }
+
+size_t Pipeline::addStage(Function function, StageOptions options) {
+	this->stages.push_back(std::make_unique<Stage>(std::move(function), options));
+	return this->stages.size() - 1u;
+}
+
+size_t Pipeline::addStage(Function function) { return this->addStage(std::move(function), StageOptions{}); }
+
+bool Pipeline::push(const Sample &sample) {
+	if (this->stages.empty()) return false;
+
+	Item item{sample, now()};
+	item.sample.stamp(Trace::Hop::ENQUEUE, item.queued);
+	switch (this->offer(0u, item)) {
+	case Offer::QUEUED:
+		return true;
+	case Offer::FULL:
+		this->stages.front()->dropped.fetch_add(1u, std::memory_order_relaxed);
+		return false;
+	default:
+		return false;
+	}
+}
+
+void Pipeline::flush() {
+	while (this->isBusy()) std::this_thread::sleep_for(std::chrono::microseconds{100});
+}
+
+std::optional<Pipeline::Statistics> Pipeline::getStatistics(size_t stage) const {
+	if (stage >= this->stages.size()) return std::nullopt;
+
+	const Stage &source = *this->stages[stage];
+	Statistics	 statistics{};
+	statistics.processed  = source.processed.load(std::memory_order_relaxed);
+	statistics.emitted	  = source.emitted.load(std::memory_order_relaxed);
+	statistics.dropped	  = source.dropped.load(std::memory_order_relaxed);
+	statistics.maxLatency = Duration{static_cast<Duration::rep>(source.latencyMax.load(std::memory_order_relaxed))};
+	if (statistics.processed) {
+		const auto latencySum  = source.latencySum.load(std::memory_order_relaxed);
+		statistics.meanLatency = Duration{static_cast<Duration::rep>(latencySum / statistics.processed)};
+	}
+	return statistics;
+}
+
+Pipeline::Offer Pipeline::offer(size_t stage, const Item &item) {
+	Stage &target = *this->stages[stage];
+
+	switch (target.options.backpressure) {
+	case Backpressure::DROP_OLDEST:
+		while (!target.queue.push(item)) {
+			if (target.queue.pop()) target.dropped.fetch_add(1u, std::memory_order_relaxed);
+		}
+		break;
+	case Backpressure::SAMPLE_DOWN:
+		if (target.queue.size() * 2u >= target.queue.capacity()) {
+			const uint32_t count = target.sampleDownCount.fetch_add(1u, std::memory_order_relaxed);
+			if (target.options.sampleDown > 1u && count % target.options.sampleDown != 0u) {
+				target.dropped.fetch_add(1u, std::memory_order_relaxed);
+				return Offer::DROPPED;
+			}
+		}
+		if (!target.queue.push(item)) {
+			target.dropped.fetch_add(1u, std::memory_order_relaxed);
+			return Offer::DROPPED; // Full, so already scheduled.
+		}
+		break;
+	case Backpressure::BLOCK:
+		if (!target.queue.push(item)) return Offer::FULL;
+		break;
+	}
+
+	this->schedule(stage);
+	return Offer::QUEUED;
+}
+
+void Pipeline::schedule(size_t stage) {
+	if (!this->stages[stage]->scheduled.exchange(true, std::memory_order_acq_rel)) this->submit(stage);
+}
+
+void Pipeline::submit(size_t stage) {
+	// Counted until the task returns, so that flush() cannot return while a task still refers to the pipeline.
+	this->tasks.fetch_add(1u, std::memory_order_acq_rel);
+	this->pool.submit([this, stage]() {
+		this->drain(stage);
+		this->tasks.fetch_sub(1u, std::memory_order_acq_rel);
+	});
+}
+
+void Pipeline::drain(size_t stage) {
+	Stage &source = *this->stages[stage];
+
+	while (this->process(stage)) {
+		// Stalled on the next stage, so wait without a task until it frees space and resumes this stage. Space freed
+		// before the flag was raised would not resume it, so check once after, continuing if the flag is reclaimed.
+		const Stage &next = *this->stages[stage + 1u];
+		source.blocked.store(true, std::memory_order_seq_cst);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (next.queue.size() >= next.queue.capacity()) return;
+		if (!source.blocked.exchange(false, std::memory_order_acq_rel)) return; // Resumed by the next stage instead.
+	}
+
+	source.scheduled.store(false, std::memory_order_release);
+	if (source.queue.size() > 0u) this->schedule(stage);
+}
+
+bool Pipeline::process(size_t stage) {
+	Stage	  &source = *this->stages[stage];
+	const bool last	  = stage + 1u == this->stages.size();
+	size_t	   popped = 0u;
+
+	if (source.stalled) {
+		const Offer offered = this->offer(stage + 1u, source.stalled.value());
+		if (offered == Offer::QUEUED) source.emitted.fetch_add(1u, std::memory_order_relaxed);
+		if (offered != Offer::FULL) source.stalled.reset();
+	}
+
+	for (; popped < source.options.batch && !source.stalled; popped++) {
+		const auto item = source.queue.pop();
+		if (!item) break;
+
+		auto			output	 = source.function(item->sample);
+		const Timestamp complete = now();
+		if (output && stage < Trace::STAGES)
+			output->stamp(static_cast<Trace::Hop>(static_cast<size_t>(Trace::Hop::STAGE_0) + stage), complete);
+
+		const auto latency = static_cast<uint64_t>((complete - item->queued).count());
+		source.processed.fetch_add(1u, std::memory_order_relaxed);
+		source.latencySum.fetch_add(latency, std::memory_order_relaxed);
+		uint64_t latencyMax = source.latencyMax.load(std::memory_order_relaxed);
+		while (latency > latencyMax && !source.latencyMax.compare_exchange_weak(latencyMax, latency)) {}
+
+		if (!output) continue;
+		if (last) {
+			source.emitted.fetch_add(1u, std::memory_order_relaxed);
+			continue;
+		}
+
+		const Offer offered = this->offer(stage + 1u, Item{output.value(), complete});
+		if (offered == Offer::QUEUED) source.emitted.fetch_add(1u, std::memory_order_relaxed);
+		else if (offered == Offer::FULL) source.stalled = Item{output.value(), complete};
+	}
+
+	// Space was freed, so resume the previous stage if it stalled on this one.
+	if (popped > 0u && stage > 0u) {
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (this->stages[stage - 1u]->blocked.exchange(false, std::memory_order_acq_rel)) this->submit(stage - 1u);
+	}
+
+	return source.stalled.has_value();
+}
+
+bool Pipeline::isBusy() const {
+	for (const auto &stage : this->stages) {
+		if (stage->scheduled.load(std::memory_order_acquire) || stage->queue.size() > 0u) return true;
+	}
+	return this->tasks.load(std::memory_order_acquire) > 0u;
+}
+
+Timestamp Pipeline::now() {
+	return std::chrono::duration_cast<Timestamp>(std::chrono::steady_clock::now().time_since_epoch());
+}
@@ -0,0 +1,218 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Predictor.cpp
+ * @brief			: Source for TMP116_Predictor.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Predictor.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using Predictor = TMP116::Predictor;
+using Duration	= TMP116::Duration;
+using Timestamp = TMP116::Timestamp;
+
+using Seconds = std::chrono::duration<double>;
+
+// Normal equations with a determinant this small relative to the scale of their terms are taken as singular, such as
+// when the samples fitted share too few distinct times.
+static constexpr double SINGULAR = 1e-9;
+
+static double toSeconds(Duration duration) { return std::chrono::duration_cast<Seconds>(duration).count(); }
+
+/**
+ * @brief Find the earliest time from now at which a quadratic meets a limit it is below or has just reached.
+ *
+ * @param value The value now.
+ * @param slope The first derivative now.
+ * @param half Half the second derivative.
+ * @param limit The limit, above the value.
+ * @return std::optional<double> The time in seconds, or std::nullopt if never met.
+ */
+static std::optional<double> timeTo(double value, double slope, double half, double limit) {
+	if (!std::isfinite(limit)) return std::nullopt;
+	if (value >= limit) return 0.0;
+
+	const double gap = limit - value;
+	if (half == 0.0) {
+		if (slope <= 0.0) return std::nullopt;
+		return gap / slope;
+	}
+
+	const double discriminant = slope * slope + 4.0 * half * gap;
+	if (discriminant < 0.0) return std::nullopt; // A downward curve peaking below the limit.
+
+	// Roots of half t^2 + slope t - gap, by the form avoiding cancellation when the curvature is slight.
+	const double root  = std::sqrt(discriminant);
+	const double q	   = -0.5 * (slope + std::copysign(root, slope));
+	const double first = q / half;
+	const double other = -gap / q;
+
+	// The quadratic is below the limit now, so of its roots the earliest ahead is where it first meets it.
+	std::optional<double> time{};
+	for (const double candidate : {first, other})
+		if (candidate >= 0.0 && (!time.has_value() || candidate < *time)) time = candidate;
+	return time;
+}
+
+static std::optional<Duration> toDuration(std::optional<double> seconds) {
+	if (!seconds.has_value() || *seconds >= std::chrono::duration_cast<Seconds>(Duration::max()).count())
+		return std::nullopt;
+	return std::chrono::duration_cast<Duration>(Seconds{*seconds});
+}
+
+void Predictor::Sums::add(double t, double y, double sign) {
+	const double t2 = t * t;
+	this->n += sign;
+	this->t += sign * t;
+	this->t2 += sign * t2;
+	this->t3 += sign * t2 * t;
+	this->t4 += sign * t2 * t2;
+	this->y += sign * y;
+	this->ty += sign * t * y;
+	this->t2y += sign * t2 * y;
+}
+
+Predictor::Predictor(size_t sensors, Options options) : options{options}, channels(sensors) {
+	const size_t terms	 = this->options.fit == Fit::QUADRATIC ? 3u : 2u;
+	this->options.window = std::max(this->options.window, terms);
+	this->times.assign(sensors * this->options.window, Timestamp{0});
+	this->values.assign(sensors * this->options.window, 0.0f);
+}
+
+Predictor::Predictor(size_t sensors) : Predictor(sensors, Options{}) {}
+
+bool Predictor::setLimits(SensorId sensorId, float low, float high) {
+	if (sensorId >= this->channels.size() || !(low < high)) return false;
+
+	this->channels[sensorId].low  = low;
+	this->channels[sensorId].high = high;
+	return true;
+}
+
+bool Predictor::reset(SensorId sensorId) {
+	if (sensorId >= this->channels.size()) return false;
+
+	Channel &channel	= this->channels[sensorId];
+	channel.sums		= Sums{};
+	channel.count		= 0u;
+	channel.next		= 0u;
+	channel.alerting[0] = false;
+	channel.alerting[1] = false;
+	return true;
+}
+
+void Predictor::rebase(SensorId sensorId) {
+	Channel		&channel = this->channels[sensorId];
+	const size_t window	 = this->options.window;
+	const size_t base	 = sensorId * window;
+	const size_t oldest	 = (channel.next + window - channel.count) % window;
+
+	channel.origin = this->times[base + oldest];
+	channel.sums   = Sums{};
+	for (size_t i = 0u; i < channel.count; i++) {
+		const size_t slot = base + (oldest + i) % window;
+		channel.sums.add(toSeconds(this->times[slot] - channel.origin), this->values[slot], 1.0);
+	}
+}
+
+std::optional<Predictor::Alert> Predictor::offer(const Sample &sample) {
+	if (sample.sensorId >= this->channels.size()) return std::nullopt;
+
+	Channel		&channel = this->channels[sample.sensorId];
+	const size_t window	 = this->options.window;
+	const size_t base	 = sample.sensorId * window;
+
+	if (channel.count > 0u && sample.timestamp <= this->times[base + (channel.next + window - 1u) % window])
+		return std::nullopt;
+
+	if (channel.count == 0u) channel.origin = sample.timestamp;
+	if (channel.count == window) {
+		const size_t slot = base + channel.next;
+		channel.sums.add(toSeconds(this->times[slot] - channel.origin), this->values[slot], -1.0);
+	}
+
+	const float value				  = sample.getTemperature();
+	this->times[base + channel.next]  = sample.timestamp;
+	this->values[base + channel.next] = value;
+	channel.next					  = (channel.next + 1u) % window;
+	channel.count					  = std::min(channel.count + 1u, window);
+	channel.sums.add(toSeconds(sample.timestamp - channel.origin), value, 1.0);
+
+	// Once per window, take the origin to the oldest sample and recompute the sums, discarding their rounding.
+	if (channel.next == 0u && channel.count == window) this->rebase(sample.sensorId);
+
+	const auto forecast = this->getForecast(sample.sensorId);
+	if (!forecast.has_value()) return std::nullopt;
+
+	const Limit					  limits[]	  = {Limit::HIGH, Limit::LOW};
+	const std::optional<Duration> remaining[] = {forecast->timeToHigh, forecast->timeToLow};
+
+	std::optional<Alert> alert{};
+	for (size_t i = 0u; i < 2u; i++) {
+		bool	  &alerting = channel.alerting[i];
+		const bool within	= remaining[i].has_value() && *remaining[i] < this->options.horizon;
+		if (within && !alerting && !alert.has_value()) {
+			alerting = true;
+			alert	 = Alert{
+				   sample.sensorId, sample.timestamp, limits[i], *remaining[i], forecast->value, forecast->slope
+			   };
+		}
+		if (!within) alerting = false;
+	}
+	return alert;
+}
+
+std::optional<Predictor::Forecast> Predictor::getForecast(SensorId sensorId) const {
+	if (sensorId >= this->channels.size()) return std::nullopt;
+
+	const Channel &channel = this->channels[sensorId];
+	const Sums	  &s	   = channel.sums;
+	const size_t   window  = this->options.window;
+	if (channel.count < (this->options.fit == Fit::QUADRATIC ? 3u : 2u)) return std::nullopt;
+
+	const Timestamp latest = this->times[sensorId * window + (channel.next + window - 1u) % window];
+	const double	now	   = toSeconds(latest - channel.origin);
+
+	double a, b, c = 0.0;
+	if (this->options.fit == Fit::QUADRATIC) {
+		// Cramer's rule on [n t t2; t t2 t3; t2 t3 t4] [a b c] = [y ty t2y].
+		const double m00 = s.t2 * s.t4 - s.t3 * s.t3;
+		const double m01 = s.t * s.t4 - s.t3 * s.t2;
+		const double m02 = s.t * s.t3 - s.t2 * s.t2;
+		const double det = s.n * m00 - s.t * m01 + s.t2 * m02;
+		if (!(std::fabs(det) > SINGULAR * s.n * s.t2 * s.t4)) return std::nullopt;
+
+		a = (s.y * m00 - s.t * (s.ty * s.t4 - s.t3 * s.t2y) + s.t2 * (s.ty * s.t3 - s.t2 * s.t2y)) / det;
+		b = (s.n * (s.ty * s.t4 - s.t3 * s.t2y) - s.y * m01 + s.t2 * (s.t * s.t2y - s.ty * s.t2)) / det;
+		c = (s.n * (s.t2 * s.t2y - s.ty * s.t3) - s.t * (s.t * s.t2y - s.ty * s.t2) + s.y * m02) / det;
+	} else {
+		const double det = s.n * s.t2 - s.t * s.t;
+		if (!(det > SINGULAR * s.n * s.t2)) return std::nullopt;
+
+		b = (s.n * s.ty - s.t * s.y) / det;
+		a = (s.y - b * s.t) / s.n;
+	}
+
+	const double value = a + b * now + c * now * now;
+	const double slope = b + 2.0 * c * now;
+
+	// The low limit is met where the negated quadratic meets the negated limit.
+	return Forecast{
+		latest,
+		static_cast<float>(value),
+		static_cast<float>(slope),
+		static_cast<float>(2.0 * c),
+		toDuration(timeTo(value, slope, c, channel.high)),
+		toDuration(timeTo(-value, -slope, -c, -static_cast<double>(channel.low))),
+	};
+}
+
+bool Predictor::isAlerting(SensorId sensorId, Limit limit) const {
+	if (sensorId >= this->channels.size()) return false;
+
+	return this->channels[sensorId].alerting[static_cast<size_t>(limit)];
+}
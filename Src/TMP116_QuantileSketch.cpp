@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_QuantileSketch.cpp
+ * @brief			: Source for TMP116_QuantileSketch.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_QuantileSketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using QuantileSketch		= TMP116::QuantileSketch;
+using SlidingQuantileSketch = TMP116::SlidingQuantileSketch;
+using Duration				= TMP116::Duration;
+using Register				= TMP116::Register;
+using Timestamp				= TMP116::Timestamp;
+
+static constexpr uint8_t MAX_SHIFT = 15u; // Two buckets, of the negative and other register values, cover the domain.
+
+/**
+ * @brief Divide, rounding towards negative infinity.
+ *
+ * @param value The dividend.
+ * @param width The divisor. Must be positive.
+ * @return int32_t floor(value / width).
+ */
+static constexpr int32_t floorDivide(int32_t value, int32_t width) {
+	return value >= 0 ? value / width : -((-value + width - 1) / width);
+}
+
+/**
+ * @brief Remainder of a division rounding towards negative infinity, so never negative.
+ *
+ * @param value The dividend.
+ * @param modulus The divisor. Must be positive.
+ * @return Duration::rep value - modulus * floor(value / modulus).
+ */
+static constexpr Duration::rep floorModulo(Duration::rep value, Duration::rep modulus) {
+	const Duration::rep remainder = value % modulus;
+	return remainder < 0 ? remainder + modulus : remainder;
+}
+
+/**
+ * @brief Get the bucket of a register value.
+ *
+ * @param raw The Temperature Register value.
+ * @param shift The bucket width as a power of two of LSBs.
+ * @return int32_t The bucket.
+ */
+static constexpr int32_t getBucket(Register raw, uint8_t shift) {
+	return floorDivide(static_cast<int16_t>(raw), 1 << shift);
+}
+
+QuantileSketch::QuantileSketch(uint8_t shift, size_t maxBuckets)
+	: shift{shift < MAX_SHIFT ? shift : MAX_SHIFT}, maxBuckets{maxBuckets ? maxBuckets : 1u} {}
+
+void QuantileSketch::add(Register raw, uint32_t count) {
+	if (count == 0u) return;
+
+	const int32_t bucket   = getBucket(raw, this->shift);
+	auto		  position = std::lower_bound(
+		 this->buckets.begin(),
+		 this->buckets.end(),
+		 bucket,
+		 [](const std::pair<int32_t, uint64_t> &entry, int32_t key) { return entry.first < key; }
+	 );
+
+	if (position != this->buckets.end() && position->first == bucket) position->second += count;
+	else this->buckets.insert(position, {bucket, count});
+	this->count += count;
+
+	if (this->buckets.size() > this->maxBuckets && this->shift < MAX_SHIFT) this->coarsen(this->shift + 1u);
+}
+
+void QuantileSketch::merge(const QuantileSketch &other) {
+	if (other.shift > this->shift) this->coarsen(other.shift);
+
+	const uint8_t difference = this->shift - other.shift;
+	const int32_t width		 = 1 << difference;
+
+	std::vector<std::pair<int32_t, uint64_t>> merged{};
+	merged.reserve(this->buckets.size() + other.buckets.size());
+
+	auto mine = this->buckets.begin();
+	for (const auto &entry : other.buckets) {
+		const int32_t bucket = floorDivide(entry.first, width);
+		while (mine != this->buckets.end() && mine->first < bucket) merged.push_back(*mine++);
+
+		if (!merged.empty() && merged.back().first == bucket) merged.back().second += entry.second;
+		else if (mine != this->buckets.end() && mine->first == bucket) {
+			merged.push_back({bucket, mine->second + entry.second});
+			mine++;
+		} else merged.push_back({bucket, entry.second});
+	}
+	while (mine != this->buckets.end()) merged.push_back(*mine++);
+
+	this->buckets = std::move(merged);
+	this->count += other.count;
+
+	while (this->buckets.size() > this->maxBuckets && this->shift < MAX_SHIFT) this->coarsen(this->shift + 1u);
+}
+
+std::optional<Register> QuantileSketch::getQuantile(float fraction) const {
+	if (this->count == 0u) return std::nullopt;
+
+	if (fraction < 0.0f) fraction = 0.0f;
+	if (fraction > 1.0f) fraction = 1.0f;
+
+	// Rank of the quantile, being at least the first value. The tolerance absorbs the float error of the fraction.
+	const double count = static_cast<double>(this->count);
+	uint64_t	 rank  = static_cast<uint64_t>(std::ceil(static_cast<double>(fraction) * count - 1e-7 * count));
+	if (rank == 0u) rank = 1u;
+
+	uint64_t cumulative = 0u;
+	for (const auto &entry : this->buckets) {
+		cumulative += entry.second;
+		if (cumulative >= rank) return static_cast<Register>(static_cast<int16_t>(entry.first * (1 << this->shift)));
+	}
+	return static_cast<Register>(static_cast<int16_t>(this->buckets.back().first * (1 << this->shift)));
+}
+
+void QuantileSketch::clear() {
+	this->buckets.clear();
+	this->count = 0u;
+}
+
+void QuantileSketch::coarsen(uint8_t shift) {
+	if (shift <= this->shift) return;
+
+	const int32_t width = 1 << (shift - this->shift);
+	size_t		  size	= 0u;
+	for (const auto &entry : this->buckets) {
+		const int32_t bucket = floorDivide(entry.first, width);
+		if (size > 0u && this->buckets[size - 1u].first == bucket) this->buckets[size - 1u].second += entry.second;
+		else this->buckets[size++] = {bucket, entry.second};
+	}
+	this->buckets.resize(size);
+	this->shift = shift;
+}
+
+SlidingQuantileSketch::SlidingQuantileSketch(Duration interval, size_t windows, uint8_t shift, size_t maxBuckets)
+	: interval{interval > Duration::zero() ? interval : Duration{1}},
+	  sketches(windows ? windows : 1u, QuantileSketch{shift, maxBuckets}),
+	  starts(windows ? windows : 1u, Timestamp::min()) {}
+
+size_t SlidingQuantileSketch::slot(Timestamp start) const {
+	const auto windows = static_cast<Duration::rep>(this->sketches.size());
+	return static_cast<size_t>(floorModulo(start / this->interval, windows));
+}
+
+void SlidingQuantileSketch::add(const Sample &sample) {
+	const Timestamp start = sample.timestamp - Duration{floorModulo(sample.timestamp.count(), this->interval.count())};
+	const size_t	index = this->slot(start);
+
+	if (start < this->starts[index]) return; // Older than the window.
+	if (start > this->starts[index]) {
+		this->sketches[index].clear();
+		this->starts[index] = start;
+	}
+	this->sketches[index].add(sample.raw);
+}
+
+QuantileSketch SlidingQuantileSketch::getWindow(Timestamp now) const {
+	const Duration length = this->interval * static_cast<Duration::rep>(this->sketches.size());
+	QuantileSketch window{this->sketches.front().getShift()};
+
+	for (size_t i = 0u; i < this->sketches.size(); i++) {
+		if (this->starts[i] == Timestamp::min() || this->starts[i] > now) continue;
+		if (this->starts[i] <= now - length) continue;
+		window.merge(this->sketches[i]);
+	}
+	return window;
+}
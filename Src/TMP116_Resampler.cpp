@@ -0,0 +1,145 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Resampler.cpp
+ * @brief			: Source for TMP116_Resampler.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Resampler.hpp"
+#include "TMP116_Vector.hpp"
+
+#include <algorithm>
+
+using Resampler = TMP116::Resampler;
+using Timestamp = TMP116::Timestamp;
+
+Resampler::Resampler(size_t sensors, Options options) : options{options}, channels(sensors) {
+	if (this->options.interval <= Duration::zero()) this->options.interval = Duration{1};
+	if (this->options.lookahead < Duration::zero()) this->options.lookahead = Duration::zero();
+	if (this->options.maxAhead < Duration::zero()) this->options.maxAhead = Duration::zero();
+
+	// Samples may run ahead of the oldest pending row by up to the lookahead, which spans this many rows inclusive.
+	this->capacity = static_cast<size_t>(this->options.lookahead / this->options.interval) + 1u;
+	this->rows.assign(this->capacity * sensors, MISSING);
+	this->filled.assign(this->capacity, 0u);
+	this->ready.sensors = sensors;
+}
+
+Resampler::Resampler(size_t sensors) : Resampler(sensors, Options{}) {}
+
+Timestamp Resampler::getTime(int64_t row) const { return this->options.origin + this->options.interval * row; }
+
+size_t Resampler::getSlot(int64_t row) const {
+	const auto capacity = static_cast<int64_t>(this->capacity);
+	return static_cast<size_t>((row % capacity + capacity) % capacity); // Rows before the origin are negative.
+}
+
+float Resampler::hold(const Channel &channel, Timestamp time) const {
+	return channel.seen && time - channel.time <= this->options.maxGap ? channel.value : MISSING;
+}
+
+bool Resampler::offer(const Sample &sample) {
+	if (sample.sensorId >= this->channels.size()) return false;
+
+	// A sample completes a row for each row it runs ahead of the ring, so how far ahead it may run is bounded.
+	const Timestamp newest	= this->getTime(this->first + static_cast<int64_t>(this->capacity) - 1);
+	Channel		   &channel = this->channels[sample.sensorId];
+	if ((channel.seen && sample.timestamp <= channel.time) ||
+		(this->started && sample.timestamp > newest + this->options.maxAhead)) {
+		this->dropped++;
+		return false;
+	}
+
+	if (!this->started) {
+		// The first row at or after the first sample.
+		const auto offset = (sample.timestamp - this->options.origin).count();
+		const auto step	  = this->options.interval.count();
+		this->first		  = offset / step + (offset % step > 0 ? 1 : 0);
+		this->started	  = true;
+		for (auto &other : this->channels) other.next = this->first;
+	}
+
+	const float value = sample.getTemperature();
+	const auto	gap	  = sample.timestamp - channel.time;
+	int64_t		row	  = std::max(channel.next, this->first);
+
+	for (Timestamp time = this->getTime(row); time <= sample.timestamp; time = this->getTime(++row)) {
+		// A sample beyond the lookahead of the oldest pending row completes it, as its other samples are overdue.
+		while (row >= this->first + static_cast<int64_t>(this->capacity)) this->complete();
+
+		float cell;
+		if (time == sample.timestamp) cell = value;
+		else if (!channel.seen || gap > this->options.maxGap) cell = this->hold(channel, time);
+		else if (this->options.interpolation == Interpolation::HOLD) cell = channel.value;
+		else {
+			const float fraction = static_cast<float>((time - channel.time).count()) / static_cast<float>(gap.count());
+			cell				 = channel.value + (value - channel.value) * fraction;
+		}
+
+		const size_t slot = this->getSlot(row);
+		this->rows[slot * this->channels.size() + sample.sensorId] = cell;
+		this->filled[slot]++;
+		channel.next = row + 1;
+	}
+
+	channel.time  = sample.timestamp;
+	channel.value = value;
+	channel.seen  = true;
+
+	while (this->filled[this->getSlot(this->first)] == this->channels.size()) this->complete();
+	return true;
+}
+
+size_t Resampler::advance(Timestamp now) {
+	size_t completed = 0u;
+	while (this->started && this->getTime(this->first) + this->options.lookahead <= now) {
+		this->complete();
+		completed++;
+	}
+	return completed;
+}
+
+size_t Resampler::flush() {
+	size_t	   completed = 0u;
+	const auto isFilled	 = [this]() {
+		return std::any_of(this->channels.begin(), this->channels.end(), [this](const Channel &channel) {
+			return channel.next > this->first;
+		});
+	};
+
+	while (this->started && isFilled()) {
+		this->complete();
+		completed++;
+	}
+	return completed;
+}
+
+Resampler::Matrix Resampler::drain() {
+	Matrix matrix{};
+	matrix.sensors = this->channels.size();
+	std::swap(matrix, this->ready);
+	return matrix;
+}
+
+void Resampler::complete() {
+	const size_t sensors = this->channels.size();
+	const size_t slot	 = this->getSlot(this->first);
+	float *const cells	 = this->rows.data() + slot * sensors;
+	const auto	 time	 = this->getTime(this->first);
+
+	// Sensors without a sample since the row hold their last value, and never fill the row later.
+	for (size_t sensor = 0u; sensor < sensors; sensor++) {
+		Channel &channel = this->channels[sensor];
+		if (channel.next > this->first) continue;
+		cells[sensor] = this->hold(channel, time);
+		channel.next  = this->first + 1;
+	}
+
+	this->ready.times.push_back(time);
+	this->ready.values.insert(this->ready.values.end(), cells, cells + sensors);
+
+	std::fill(cells, cells + sensors, MISSING);
+	this->filled[slot] = 0u;
+	this->first++;
+}
@@ -0,0 +1,120 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Rollup.cpp
+ * @brief			: Source for TMP116_Rollup.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Rollup.hpp"
+
+using Rollup	= TMP116::Rollup;
+using Bucket	= TMP116::Rollup::Bucket;
+using Duration	= TMP116::Duration;
+using Timestamp = TMP116::Timestamp;
+
+float Bucket::getMean() const {
+	if (this->count == 0u) return 0.0f;
+	const float mean = static_cast<float>(this->sum) / static_cast<float>(this->count);
+	return mean * TMP116::TEMPERATURE_RESOLUTION;
+}
+
+Rollup::Rollup(size_t sensors, std::vector<Resolution> resolutions)
+	: sensors{sensors}, resolutions{std::move(resolutions)}, stride{0u} {
+	for (auto &resolution : this->resolutions) {
+		if (resolution.buckets == 0u) resolution.buckets = 1u;
+		if (resolution.interval <= Duration::zero()) resolution.interval = Duration{1};
+		this->offsets.push_back(this->stride);
+		this->stride += resolution.buckets;
+	}
+	this->buckets.resize(this->sensors * this->stride);
+	this->latest.resize(this->sensors * this->resolutions.size(), Timestamp::min());
+}
+
+size_t Rollup::slot(size_t resolution, Timestamp start) const {
+	const auto &parameters = this->resolutions[resolution];
+	const auto	buckets	   = static_cast<Duration::rep>(parameters.buckets);
+	const auto	index	   = (start / parameters.interval) % buckets;
+	return static_cast<size_t>(index < 0 ? index + buckets : index);
+}
+
+Timestamp Rollup::align(size_t resolution, Timestamp time) const {
+	const auto interval = this->resolutions[resolution].interval;
+	auto	   index	= time.count() / interval.count();
+	if (time.count() < 0 && time.count() % interval.count() != 0) index--; // Floor for negative times.
+	return Timestamp{index * interval.count()};
+}
+
+bool Rollup::ingest(const Sample &sample) {
+	if (sample.sensorId >= this->sensors) return false;
+
+	const auto raw		  = static_cast<int16_t>(sample.raw);
+	bool	   aggregated = false;
+
+	for (size_t resolution = 0u; resolution < this->resolutions.size(); resolution++) {
+		const auto &parameters = this->resolutions[resolution];
+		const auto	start	   = this->align(resolution, sample.timestamp);
+		const auto	index  = sample.sensorId * this->stride + this->offsets[resolution] + this->slot(resolution, start);
+		Bucket	   &bucket = this->buckets[index];
+		Timestamp  &latest = this->latest[sample.sensorId * this->resolutions.size() + resolution];
+
+		// Skip samples older than the retained intervals.
+		if (latest != Timestamp::min() &&
+			start <= latest - parameters.interval * static_cast<Duration::rep>(parameters.buckets))
+			continue;
+		if (start < bucket.start) continue;
+		if (start > latest) latest = start;
+
+		if (start > bucket.start) bucket = Bucket{start, raw, raw, raw, 0u, 0};
+		if (raw < bucket.min) bucket.min = raw;
+		if (raw > bucket.max) bucket.max = raw;
+		bucket.last = raw;
+		bucket.count++;
+		bucket.sum += raw;
+		aggregated = true;
+	}
+
+	return aggregated;
+}
+
+const Bucket *Rollup::locate(SensorId sensorId, size_t resolution, Timestamp start) const {
+	const auto	index  = sensorId * this->stride + this->offsets[resolution] + this->slot(resolution, start);
+	const auto &bucket = this->buckets[index];
+
+	if (bucket.start != start || bucket.count == 0u) return nullptr;
+	return &bucket;
+}
+
+std::optional<Bucket> Rollup::getBucket(SensorId sensorId, size_t resolution, Timestamp time) const {
+	if (sensorId >= this->sensors || resolution >= this->resolutions.size()) return std::nullopt;
+
+	const Bucket *bucket = this->locate(sensorId, resolution, this->align(resolution, time));
+	if (bucket == nullptr) return std::nullopt;
+	return *bucket;
+}
+
+size_t Rollup::getBuckets(
+	SensorId  sensorId,
+	size_t	  resolution,
+	Timestamp from,
+	Timestamp to,
+	Bucket	 *buckets,
+	size_t	  count
+) const {
+	if (sensorId >= this->sensors || resolution >= this->resolutions.size() || from > to) return 0u;
+
+	const auto interval = this->resolutions[resolution].interval;
+	const auto retained = interval * static_cast<Duration::rep>(this->resolutions[resolution].buckets);
+
+	// Only the most recent intervals can be retained, so skip directly to them.
+	Timestamp start = this->align(resolution, from);
+	Timestamp end	= this->align(resolution, to);
+	if (end - start >= retained) start = end - retained + interval;
+
+	size_t written = 0u;
+	for (; start <= end && written < count; start += interval) {
+		const Bucket *bucket = this->locate(sensorId, resolution, start);
+		if (bucket != nullptr) buckets[written++] = *bucket;
+	}
+	return written;
+}
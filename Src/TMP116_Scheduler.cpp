@@ -0,0 +1,107 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Scheduler.cpp
+ * @brief			: Source for TMP116_Scheduler.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Scheduler.hpp"
+
+using Scheduler	 = TMP116::Scheduler;
+using PollPolicy = TMP116::BusModel::PollPolicy;
+using Duration	 = TMP116::Duration;
+using Timestamp	 = TMP116::Timestamp;
+using Sample	 = TMP116::Sample;
+using Trace	 = TMP116::Trace;
+using SensorId	 = TMP116::SensorId;
+
+Scheduler::Scheduler(BusModel &model) : model{model} {}
+
+std::optional<PollPolicy> Scheduler::addSensor(
+	SensorId				sensorId,
+	TMP116				   &sensor,
+	PollPolicy				policy,
+	std::optional<Duration> deadline,
+	Timestamp				start
+) {
+	auto fitted = this->model.fit(policy);
+	if (!fitted) return std::nullopt;
+
+	if (!sensor.setConfig(fitted->config)) return std::nullopt;
+
+	auto admitted = this->model.admit(fitted.value());
+	if (!admitted) return std::nullopt;
+
+	const Duration period = admitted->getPeriod();
+	this->entries.push_back(Entry{
+		sensorId,
+		&sensor,
+		period,
+		deadline.value_or(period),
+		admitted->pollDataReady,
+		start,
+		Statistics{},
+	});
+	return admitted;
+}
+
+std::optional<Sample> Scheduler::poll(Timestamp now) {
+	// Expire jobs which were not read before their deadline.
+	for (auto &entry : this->entries) {
+		const Timestamp absoluteDeadline = entry.release + entry.deadline;
+		if (now > absoluteDeadline) {
+			const auto missed = (now - absoluteDeadline + entry.period - Duration{1}) / entry.period;
+			entry.statistics.misses += static_cast<uint32_t>(missed);
+			entry.release += entry.period * missed;
+		}
+	}
+
+	Entry *next = nullptr;
+	for (auto &entry : this->entries) {
+		if (entry.release > now) continue;
+		if (next == nullptr || entry.release + entry.deadline < next->release + next->deadline) next = &entry;
+	}
+
+	if (next == nullptr) return std::nullopt;
+
+	if (next->pollDataReady) {
+		const auto ready = next->sensor->dataReady();
+		if (!ready) {
+			next->statistics.failures++;
+			return std::nullopt;
+		} else if (!ready.value()) return std::nullopt;
+	}
+
+	const auto raw = next->sensor->getTemperatureRegister();
+	if (!raw) {
+		next->statistics.failures++;
+		return std::nullopt;
+	}
+
+	const Duration slack = next->release + next->deadline - now;
+	next->statistics.reads++;
+	next->statistics.sumSlack += slack;
+	if (slack < next->statistics.minSlack) next->statistics.minSlack = slack;
+	this->lastRelease = next->release;
+	next->release += next->period;
+
+	Sample sample{next->sensorId, now, raw.value()};
+	sample.stamp(Trace::Hop::CONVERSION, this->lastRelease);
+	return sample;
+}
+
+std::optional<Timestamp> Scheduler::getNextRelease() const {
+	std::optional<Timestamp> nextRelease = std::nullopt;
+	for (const auto &entry : this->entries) {
+		if (!nextRelease || entry.release < nextRelease.value()) nextRelease = entry.release;
+	}
+	return nextRelease;
+}
+
+std::optional<Scheduler::Statistics> Scheduler::getStatistics(SensorId sensorId) const {
+	for (const auto &entry : this->entries) {
+		if (entry.sensorId == sensorId) return entry.statistics;
+	}
+	return std::nullopt;
+}
@@ -0,0 +1,343 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Segment.cpp
+ * @brief			: Source for TMP116_Segment.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Segment.hpp"
+#include "TMP116_ThreadPool.hpp"
+
+#include <algorithm>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using Segment		= TMP116::Segment;
+using SegmentWriter = TMP116::SegmentWriter;
+using SegmentReader = TMP116::SegmentReader;
+using Block			= TMP116::Segment::Block;
+using IndexEntry	= TMP116::Segment::IndexEntry;
+using Query			= TMP116::Segment::Query;
+using Record		= TMP116::Segment::Record;
+using Sample		= TMP116::Sample;
+using Timestamp		= TMP116::Timestamp;
+
+bool Query::matches(const Sample &sample) const {
+	const auto raw = static_cast<int16_t>(sample.raw);
+	return sample.sensorId >= this->first && sample.sensorId <= this->last && sample.timestamp >= this->from &&
+		   sample.timestamp <= this->to && raw >= this->minRaw && raw <= this->maxRaw;
+}
+
+bool Query::mayMatch(const Block &block) const {
+	return block.lastSensor >= this->first && block.firstSensor <= this->last &&
+		   block.maxTimestamp >= this->from.count() && block.minTimestamp <= this->to.count() &&
+		   block.maxRaw >= this->minRaw && block.minRaw <= this->maxRaw;
+}
+
+uint32_t Segment::checksum(const Record *records, size_t count) {
+	const auto *bytes = reinterpret_cast<const uint8_t *>(records);
+	uint32_t	hash  = 2166136261u;
+	for (size_t i = 0u; i < count * sizeof(Record); i++) hash = (hash ^ bytes[i]) * 16777619u;
+	return hash;
+}
+
+/**
+ * @brief Read exactly a number of bytes at an offset.
+ *
+ * @param file The file descriptor.
+ * @param data The buffer to read into.
+ * @param size The number of bytes.
+ * @param offset The file offset.
+ * @return bool True if all bytes were read.
+ */
+static bool readAll(int file, void *data, size_t size, uint64_t offset) {
+	auto *bytes = static_cast<uint8_t *>(data);
+	while (size > 0u) {
+		const ssize_t count = pread(file, bytes, size, static_cast<off_t>(offset));
+		if (count < 0 && errno == EINTR) continue;
+		if (count <= 0) return false;
+		bytes += count;
+		size -= static_cast<size_t>(count);
+		offset += static_cast<uint64_t>(count);
+	}
+	return true;
+}
+
+/**
+ * @brief Convert a record to a sample.
+ */
+static Sample toSample(const Record &record) {
+	return Sample{record.sensorId, Timestamp{record.timestamp}, record.raw};
+}
+
+SegmentWriter::SegmentWriter(std::string path, size_t blockCapacity, uint16_t flags)
+	: path{std::move(path)}, blockCapacity{std::max<size_t>(blockCapacity, 1u)}, flags{flags} {
+	this->pending.reserve(this->blockCapacity);
+}
+
+SegmentWriter::~SegmentWriter() {
+	if (this->isOpen()) this->seal();
+}
+
+bool SegmentWriter::open() {
+	if (this->isOpen()) return false;
+
+	this->file = ::open(this->path.c_str(), O_CREAT | O_TRUNC | O_WRONLY | O_CLOEXEC, 0644);
+	if (this->file < 0) return false;
+
+	this->offset  = 0u;
+	this->samples = 0u;
+	this->failed  = false;
+	this->pending.clear();
+	this->index.clear();
+
+	const Segment::Header header{
+		Segment::MAGIC, Segment::VERSION, this->flags, static_cast<uint32_t>(this->blockCapacity), 0u
+	};
+	return this->write(&header, sizeof(header));
+}
+
+bool SegmentWriter::write(const void *data, size_t size) {
+	const auto *bytes = static_cast<const uint8_t *>(data);
+	while (size > 0u) {
+		const ssize_t count = ::write(this->file, bytes, size);
+		if (count < 0 && errno == EINTR) continue;
+		if (count <= 0) {
+			this->failed = true; // Part may have been written, so no later block or trailer may follow.
+			return false;
+		}
+		bytes += count;
+		size -= static_cast<size_t>(count);
+		this->offset += static_cast<uint64_t>(count);
+	}
+	return true;
+}
+
+bool SegmentWriter::append(const Sample &sample, uint32_t count) {
+	if (!this->isOpen() || this->failed) return false;
+
+	this->pending.push_back(Record{sample.timestamp.count(), sample.sensorId, sample.raw, count});
+	this->samples++;
+	return this->pending.size() < this->blockCapacity || this->flush();
+}
+
+bool SegmentWriter::flush() {
+	if (!this->isOpen() || this->failed) return false;
+	if (this->pending.empty()) return true;
+
+	Block block{};
+	block.magic = Segment::BLOCK_MAGIC;
+	block.count = static_cast<uint32_t>(this->pending.size());
+	block.minTimestamp = block.maxTimestamp = this->pending.front().timestamp;
+	block.minRaw = block.maxRaw = static_cast<int16_t>(this->pending.front().raw);
+	block.firstSensor = block.lastSensor = this->pending.front().sensorId;
+	for (const auto &record : this->pending) {
+		const auto raw	   = static_cast<int16_t>(record.raw);
+		block.minTimestamp = std::min(block.minTimestamp, record.timestamp);
+		block.maxTimestamp = std::max(block.maxTimestamp, record.timestamp);
+		block.minRaw	   = std::min(block.minRaw, raw);
+		block.maxRaw	   = std::max(block.maxRaw, raw);
+		block.firstSensor  = std::min(block.firstSensor, record.sensorId);
+		block.lastSensor   = std::max(block.lastSensor, record.sensorId);
+	}
+	block.checksum = Segment::checksum(this->pending.data(), this->pending.size());
+
+	const uint64_t offset  = this->offset;
+	const bool	   written = this->write(&block, sizeof(block)) &&
+						 this->write(this->pending.data(), this->pending.size() * sizeof(Record));
+	this->pending.clear();
+	if (written) this->index.push_back(IndexEntry{block, offset});
+	return written;
+}
+
+bool SegmentWriter::sync() {
+	if (!this->flush()) return false;
+#ifdef __APPLE__
+	return fsync(this->file) == 0;
+#else
+	return fdatasync(this->file) == 0;
+#endif
+}
+
+bool SegmentWriter::seal() {
+	if (!this->isOpen()) return false;
+
+	// A failed writer is closed without a trailer, so that readers recover the blocks written whole.
+	bool written = this->flush();
+	if (written) {
+		const Segment::Trailer trailer{this->offset, static_cast<uint32_t>(this->index.size()), Segment::MAGIC};
+		written = this->write(this->index.data(), this->index.size() * sizeof(IndexEntry)) &&
+				  this->write(&trailer, sizeof(trailer)) && this->sync();
+	}
+
+	::close(this->file);
+	this->file = -1;
+	return written;
+}
+
+SegmentReader::SegmentReader(std::string path) : path{std::move(path)} {}
+
+SegmentReader::~SegmentReader() { this->close(); }
+
+bool SegmentReader::open() {
+	if (this->file >= 0) return false;
+
+	this->file = ::open(this->path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (this->file < 0) return false;
+
+	struct stat status {};
+	Segment::Header header{};
+	if (fstat(this->file, &status) != 0 || !readAll(this->file, &header, sizeof(header), 0u) ||
+		header.magic != Segment::MAGIC || header.version != Segment::VERSION) {
+		this->close();
+		return false;
+	}
+	this->blockCapacity = header.blockCapacity;
+	this->flags			= header.flags;
+
+	const auto size = static_cast<uint64_t>(status.st_size);
+	this->sealed	= this->loadIndex(size);
+	if (!this->sealed && !this->recoverIndex(size)) {
+		this->close();
+		return false;
+	}
+
+	this->samples = 0u;
+	this->runningMax.clear();
+	for (const auto &entry : this->index) {
+		this->samples += entry.block.count;
+		const int64_t previous = this->runningMax.empty() ? entry.block.maxTimestamp : this->runningMax.back();
+		this->runningMax.push_back(std::max(previous, entry.block.maxTimestamp));
+	}
+	return true;
+}
+
+void SegmentReader::close() {
+	if (this->file >= 0) ::close(this->file);
+	this->file = -1;
+	this->index.clear();
+	this->runningMax.clear();
+	this->samples = 0u;
+	this->sealed  = false;
+}
+
+bool SegmentReader::loadIndex(uint64_t size) {
+	Segment::Trailer trailer{};
+	if (size < sizeof(Segment::Header) + sizeof(trailer)) return false;
+	if (!readAll(this->file, &trailer, sizeof(trailer), size - sizeof(trailer))) return false;
+	if (trailer.magic != Segment::MAGIC) return false;
+	if (trailer.indexOffset + uint64_t{trailer.blocks} * sizeof(IndexEntry) + sizeof(trailer) != size) return false;
+
+	this->index.resize(trailer.blocks);
+	return readAll(this->file, this->index.data(), this->index.size() * sizeof(IndexEntry), trailer.indexOffset);
+}
+
+bool SegmentReader::recoverIndex(uint64_t size) {
+	this->index.clear();
+
+	std::vector<Record> records{};
+	uint64_t			offset = sizeof(Segment::Header);
+	while (offset + sizeof(Block) <= size) {
+		Block block{};
+		if (!readAll(this->file, &block, sizeof(block), offset) || block.magic != Segment::BLOCK_MAGIC) break;
+
+		const uint64_t length = uint64_t{block.count} * sizeof(Record);
+		if (offset + sizeof(Block) + length > size) break;
+
+		records.resize(block.count);
+		if (!readAll(this->file, records.data(), length, offset + sizeof(Block))) break;
+		if (Segment::checksum(records.data(), records.size()) != block.checksum) break;
+
+		this->index.push_back(IndexEntry{block, offset});
+		offset += sizeof(Block) + length;
+	}
+	return true;
+}
+
+bool SegmentReader::readRecords(size_t block, std::vector<Record> &records) const {
+	if (block >= this->index.size()) return false;
+
+	const IndexEntry &entry = this->index[block];
+	records.resize(entry.block.count);
+	return readAll(this->file, records.data(), records.size() * sizeof(Record), entry.offset + sizeof(Block)) &&
+		   Segment::checksum(records.data(), records.size()) == entry.block.checksum;
+}
+
+std::vector<Sample> SegmentReader::readBlock(size_t block) const {
+	std::vector<Record> records{};
+	std::vector<Sample> samples{};
+	if (!this->readRecords(block, records)) return samples;
+
+	samples.reserve(records.size());
+	for (const auto &record : records) samples.push_back(toSample(record));
+	return samples;
+}
+
+SegmentReader::Statistics SegmentReader::scan(const Query &query, const Visitor &visitor) const {
+	Statistics statistics{};
+
+	// Blocks before the first whose running maximum reaches the start of the query hold no sample late enough.
+	const auto first = std::lower_bound(this->runningMax.begin(), this->runningMax.end(), query.from.count());
+	statistics.blocksSkipped = static_cast<uint64_t>(first - this->runningMax.begin());
+
+	std::vector<Record> records{};
+	records.reserve(this->blockCapacity);
+	for (size_t block = statistics.blocksSkipped; block < this->index.size(); block++) {
+		if (!query.mayMatch(this->index[block].block)) {
+			statistics.blocksSkipped++;
+			continue;
+		}
+		if (!this->readRecords(block, records)) {
+			statistics.errors++;
+			continue;
+		}
+
+		statistics.blocksRead++;
+		statistics.samplesRead += records.size();
+		for (const auto &record : records) {
+			const Sample sample = toSample(record);
+			if (!query.matches(sample)) continue;
+
+			statistics.matched++;
+			if (!visitor(sample)) return statistics;
+		}
+	}
+	return statistics;
+}
+
+std::vector<Sample> SegmentReader::query(const Query &query) const {
+	std::vector<Sample> samples{};
+	this->scan(query, [&samples](const Sample &sample) {
+		samples.push_back(sample);
+		return true;
+	});
+	return samples;
+}
+
+std::vector<Sample>
+SegmentReader::query(const std::vector<std::string> &paths, const Query &query, ThreadPool &pool) {
+	std::vector<std::vector<Sample>> results(paths.size());
+	ThreadPool::Group				 group{};
+	for (size_t i = 0u; i < paths.size(); i++) {
+		pool.submit(
+			[&paths, &query, &results, i]() {
+				SegmentReader reader{paths[i]};
+				if (reader.open()) results[i] = reader.query(query);
+			},
+			group
+		);
+	}
+	pool.wait(group);
+
+	size_t total = 0u;
+	for (const auto &result : results) total += result.size();
+
+	std::vector<Sample> samples{};
+	samples.reserve(total);
+	for (const auto &result : results) samples.insert(samples.end(), result.begin(), result.end());
+	return samples;
+}
@@ -0,0 +1,268 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_StreamServer.cpp
+ * @brief			: Source for TMP116_StreamServer.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_StreamServer.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using StreamServer = TMP116::StreamServer;
+using Sample	   = TMP116::Sample;
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0 // Where unavailable, SIGPIPE is suppressed with SO_NOSIGPIPE instead.
+#endif
+
+/**
+ * @brief Make a socket non-blocking.
+ *
+ * @param socket The socket.
+ * @return bool True if successful.
+ */
+static bool setNonBlocking(int socket) {
+	const int flags = fcntl(socket, F_GETFL, 0);
+	return flags >= 0 && fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+/**
+ * @brief Get the most records sent in a frame to a socket, such that a frame never exceeds its send buffer.
+ *
+ * @param socket The socket.
+ * @param maxRecords The most records in a frame, by the options of the server.
+ * @return uint16_t The most records in a frame, being at least 1.
+ */
+static uint16_t getMaxRecords(int socket, size_t maxRecords) {
+	using FrameHeader = StreamServer::FrameHeader;
+	using Record	  = StreamServer::Record;
+
+	int		  buffer = 0;
+	socklen_t length = sizeof(buffer);
+	if (getsockopt(socket, SOL_SOCKET, SO_SNDBUF, &buffer, &length) == 0 && buffer > 0) {
+		// Linux reports double the buffer set, the rest being for overheads, so only half is taken for frames.
+		const size_t frame = std::max(static_cast<size_t>(buffer) / 2u, sizeof(FrameHeader) + sizeof(Record));
+		maxRecords		   = std::min(maxRecords, (frame - sizeof(FrameHeader)) / sizeof(Record));
+	}
+	return static_cast<uint16_t>(std::clamp<size_t>(maxRecords, 1u, UINT16_MAX));
+}
+
+/**
+ * @brief Remove a socket left at an address by a server which is no longer running.
+ *
+ * @param address The address.
+ * @return bool False if a server is still listening at the address.
+ */
+static bool removeStale(const sockaddr_un &address) {
+	struct stat status {};
+	if (lstat(address.sun_path, &status) != 0 || !S_ISSOCK(status.st_mode)) return true; // Left for bind() to judge.
+
+	const int probe = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+	if (probe < 0) return true;
+	const bool live = connect(probe, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0;
+	const bool stale = !live && errno == ECONNREFUSED;
+	::close(probe);
+
+	if (stale) unlink(address.sun_path);
+	return !live;
+}
+
+StreamServer::StreamServer(std::string path, Options options) : path{std::move(path)}, options{options} {
+	this->options.maxRuns = std::max<size_t>(this->options.maxRuns, 1u);
+	this->iovecs.resize(this->options.maxRuns + 1u);
+}
+
+StreamServer::StreamServer(std::string path) : StreamServer(std::move(path), Options{}) {}
+
+StreamServer::~StreamServer() { this->close(); }
+
+bool StreamServer::open() {
+	if (this->listener >= 0) return false;
+
+	sockaddr_un address{};
+	if (this->path.size() >= sizeof(address.sun_path)) return false;
+	address.sun_family = AF_UNIX;
+	std::memcpy(address.sun_path, this->path.c_str(), this->path.size() + 1u);
+
+	if (!removeStale(address)) return false;
+
+	this->listener = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+	if (this->listener < 0) return false;
+
+	if (bind(this->listener, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0 ||
+		listen(this->listener, SOMAXCONN) != 0 || !setNonBlocking(this->listener)) {
+		::close(this->listener);
+		this->listener = -1;
+		return false;
+	}
+	return true;
+}
+
+void StreamServer::close() {
+	for (const auto &subscriber : this->subscribers) ::close(subscriber.socket);
+	this->subscribers.clear();
+	if (this->listener >= 0) {
+		::close(this->listener);
+		unlink(this->path.c_str());
+		this->listener = -1;
+	}
+}
+
+void StreamServer::poll() {
+	if (this->listener < 0) return;
+
+	for (;;) {
+		const int socket = accept(this->listener, nullptr, nullptr);
+		if (socket < 0) break;
+		if (!setNonBlocking(socket)) {
+			::close(socket);
+			continue;
+		}
+#ifdef SO_NOSIGPIPE
+		const int enable = 1;
+		setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+#endif
+		Subscriber subscriber{socket};
+		subscriber.maxRecords = getMaxRecords(socket, this->options.maxRecords);
+		this->subscribers.push_back(subscriber);
+	}
+
+	for (size_t i = this->subscribers.size(); i-- > 0u;) {
+		Subscriber &subscriber = this->subscribers[i];
+		for (;;) {
+			Subscription  subscription{};
+			const ssize_t received = recv(subscriber.socket, &subscription, sizeof(subscription), MSG_DONTWAIT);
+			if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+				this->disconnect(i); // Hung up.
+				break;
+			} else if (received < 0) break;
+
+			if (received == sizeof(subscription) && subscription.magic == MAGIC) {
+				subscriber.first	  = subscription.first;
+				subscriber.last		  = subscription.last;
+				subscriber.decimation = std::max<uint16_t>(subscription.decimation, 1u);
+				subscriber.count	  = 0u;
+			}
+		}
+	}
+}
+
+void StreamServer::publish(const Sample *samples, size_t count) {
+	// Split the batch into runs of samples whose offsets from the earliest of the run fit a record.
+	for (size_t start = 0u; start < count && !this->subscribers.empty();) {
+		int64_t first = samples[start].timestamp.count();
+		int64_t last  = first;
+		size_t	end	  = start + 1u;
+		for (; end < count; end++) {
+			const int64_t timestamp = samples[end].timestamp.count();
+			const int64_t earliest	= std::min(first, timestamp);
+			const int64_t latest	= std::max(last, timestamp);
+			if (static_cast<uint64_t>(latest) - static_cast<uint64_t>(earliest) > UINT32_MAX) break;
+			first = earliest;
+			last  = latest;
+		}
+		this->broadcast(samples + start, end - start, first);
+		start = end;
+	}
+}
+
+/**
+ * @brief Encode samples once and send them to all subscribers.
+ *
+ * @param samples The samples, each no more than UINT32_MAX microseconds after the timestamp.
+ * @param count The number of samples.
+ * @param timestamp The base timestamp of the frames, being the earliest of the samples.
+ */
+void StreamServer::broadcast(const Sample *samples, size_t count, int64_t timestamp) {
+	this->records.resize(count);
+	for (size_t i = 0u; i < count; i++) {
+		this->records[i] = Record{
+			static_cast<uint32_t>(samples[i].timestamp.count() - timestamp),
+			samples[i].sensorId,
+			samples[i].raw,
+		};
+	}
+
+	for (size_t i = this->subscribers.size(); i-- > 0u;) {
+		if (!this->send(this->subscribers[i], samples, count, timestamp)) this->disconnect(i);
+	}
+}
+
+/**
+ * @brief Send the records of a batch matching the filter of a subscriber, in as many frames as needed.
+ *
+ * @param subscriber The subscriber.
+ * @param samples The samples of the batch, already encoded into records.
+ * @param count The number of samples.
+ * @param timestamp The base timestamp of the batch.
+ * @return bool False if the subscriber should be disconnected.
+ */
+bool StreamServer::send(Subscriber &subscriber, const Sample *samples, size_t count, int64_t timestamp) {
+	FrameHeader header{MAGIC, 1u, 0u, timestamp};
+	size_t		runs  = 0u;
+	size_t		end	  = 0u; // Index following the last record of the current run.
+
+	this->iovecs[0] = iovec{&header, sizeof(header)};
+
+	// Send the frame gathered, returning false if the subscriber is to be disconnected.
+	const auto flush = [&]() {
+		if (header.count == 0u) return true;
+
+		msghdr message{};
+		message.msg_iov	   = this->iovecs.data();
+		message.msg_iovlen = runs + 1u;
+
+		const ssize_t sent = sendmsg(subscriber.socket, &message, MSG_DONTWAIT | MSG_NOSIGNAL);
+		const uint16_t frameCount = header.count;
+		header.count			  = 0u;
+		runs					  = 0u;
+
+		if (sent >= 0) {
+			this->statistics.frames++;
+			this->statistics.records += frameCount;
+			if (subscriber.congestion > 1u) subscriber.congestion >>= 1u;
+			return true;
+		} else if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+			// Disconnected rather than halving the rate below the limit, which also keeps congestion from overflowing.
+			this->statistics.missed++;
+			const uint32_t reduced = static_cast<uint32_t>(subscriber.decimation) * subscriber.congestion * 2u;
+			if (reduced > this->options.maxDecimation) return false;
+			subscriber.congestion <<= 1u;
+			return true;
+		} else return false;
+	};
+
+	for (size_t i = 0u; i < count; i++) {
+		const Sample &sample = samples[i];
+		if (sample.sensorId < subscriber.first || sample.sensorId > subscriber.last) continue;
+		if (subscriber.count++ % (static_cast<uint32_t>(subscriber.decimation) * subscriber.congestion) != 0u) continue;
+
+		if (runs > 0u && end == i) {
+			this->iovecs[runs].iov_len += sizeof(Record);
+		} else {
+			if (runs == this->options.maxRuns && !flush()) return false;
+			runs++;
+			this->iovecs[runs] = iovec{&this->records[i], sizeof(Record)};
+		}
+		end = i + 1u;
+
+		if (++header.count == subscriber.maxRecords && !flush()) return false;
+	}
+	return flush();
+}
+
+void StreamServer::disconnect(size_t subscriber) {
+	::close(this->subscribers[subscriber].socket);
+	this->subscribers.erase(this->subscribers.begin() + static_cast<ptrdiff_t>(subscriber));
+	this->statistics.disconnected++;
+}
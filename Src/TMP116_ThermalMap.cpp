@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ThermalMap.cpp
+ * @brief			: Source for TMP116_ThermalMap.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_ThermalMap.hpp"
+#include "TMP116_Vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+using ThermalMap = TMP116::ThermalMap;
+using Sample	 = TMP116::Sample;
+
+/**
+ * @brief Accumulate the weighted readings of one neighbour rank into every cell.
+ */
+static void accumulate(
+	size_t					   cells,
+	const uint32_t *__restrict indices,
+	const float *__restrict	   weights,
+	const float *__restrict	   readings,
+	const float *__restrict	   present,
+	float *__restrict		   sums,
+	float *__restrict		   norms
+) {
+	for (size_t i = 0u; i < cells; i++) {
+		sums[i] += weights[i] * readings[indices[i]];
+		norms[i] += weights[i] * present[indices[i]];
+	}
+}
+
+/**
+ * @brief Divide the weighted sum of each cell by the sum of its weights, being 0 / 0 and so NaN without readings.
+ */
+static void normalise(size_t cells, const float *__restrict norms, float *__restrict sums) {
+	for (size_t i = 0u; i < cells; i++) sums[i] /= norms[i];
+}
+
+ThermalMap::ThermalMap(std::vector<Position> positions, Grid grid, Options options)
+	: grid{grid}, neighbours{std::min(options.neighbours, positions.size())}, readings(positions.size(), MISSING),
+	  values(positions.size(), 0.0f), present(positions.size(), 0.0f), cells(grid.width * grid.height, MISSING),
+	  norms(grid.width * grid.height, 0.0f) {
+	const size_t cellCount = this->cells.size();
+	this->indices.assign(this->neighbours * cellCount, 0u);
+	this->weights.assign(this->neighbours * cellCount, 0.0f);
+
+	// Distances are floored at a fraction of the spacing, so that a sensor on a cell centre dominates it without an
+	// infinite weight, and the cell still falls back to the other neighbours when that sensor has no reading.
+	const float			  floor = 1e-3f * std::max(grid.spacing, std::numeric_limits<float>::min());
+	std::vector<float>	  distances(positions.size());
+	std::vector<uint32_t> order(positions.size());
+
+	for (size_t cell = 0u; cell < cellCount; cell++) {
+		const float x = grid.x + grid.spacing * static_cast<float>(cell % grid.width);
+		const float y = grid.y + grid.spacing * static_cast<float>(cell / grid.width);
+		for (size_t sensor = 0u; sensor < positions.size(); sensor++)
+			distances[sensor] = std::hypot(positions[sensor].x - x, positions[sensor].y - y);
+
+		std::iota(order.begin(), order.end(), 0u);
+		std::partial_sort(
+			order.begin(),
+			order.begin() + static_cast<std::ptrdiff_t>(this->neighbours),
+			order.end(),
+			[&distances](uint32_t a, uint32_t b) { return distances[a] < distances[b]; }
+		);
+
+		for (size_t rank = 0u; rank < this->neighbours; rank++) {
+			const uint32_t sensor				   = order[rank];
+			this->indices[rank * cellCount + cell] = sensor;
+			this->weights[rank * cellCount + cell] = std::pow(std::max(distances[sensor], floor), -options.power);
+		}
+	}
+}
+
+ThermalMap::ThermalMap(std::vector<Position> positions, Grid grid) : ThermalMap(std::move(positions), grid, Options{}) {}
+
+bool ThermalMap::update(const Sample &sample) {
+	if (sample.sensorId >= this->readings.size()) return false;
+
+	this->readings[sample.sensorId] = sample.getTemperature();
+	return true;
+}
+
+void ThermalMap::update(const float *temperatures) {
+	std::copy(temperatures, temperatures + this->readings.size(), this->readings.begin());
+}
+
+void ThermalMap::refresh() {
+	const size_t cellCount = this->cells.size();
+	std::fill(this->cells.begin(), this->cells.end(), 0.0f);
+	std::fill(this->norms.begin(), this->norms.end(), 0.0f);
+
+	// Sensors without a reading contribute zero to both the weighted sum and the weights of each cell.
+	for (size_t sensor = 0u; sensor < this->readings.size(); sensor++) {
+		const bool valid	  = !std::isnan(this->readings[sensor]);
+		this->values[sensor]  = valid ? this->readings[sensor] : 0.0f;
+		this->present[sensor] = valid ? 1.0f : 0.0f;
+	}
+
+	for (size_t rank = 0u; rank < this->neighbours; rank++) {
+		accumulate(
+			cellCount,
+			this->indices.data() + rank * cellCount,
+			this->weights.data() + rank * cellCount,
+			this->values.data(),
+			this->present.data(),
+			this->cells.data(),
+			this->norms.data()
+		);
+	}
+	normalise(cellCount, this->norms.data(), this->cells.data());
+}
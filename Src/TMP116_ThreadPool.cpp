@@ -0,0 +1,143 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ThreadPool.cpp
+ * @brief			: Source for TMP116_ThreadPool.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_ThreadPool.hpp"
+
+using ThreadPool = TMP116::ThreadPool;
+
+// The pool and lane of the current thread, if a pool thread, so that tasks submitted by tasks stay local.
+static thread_local const ThreadPool *currentPool = nullptr;
+static thread_local size_t			  currentLane = 0u;
+
+ThreadPool::ThreadPool(size_t threads) {
+	if (threads == 0u) threads = 1u;
+	for (size_t i = 0u; i < threads; i++) this->lanes.push_back(std::make_unique<Lane>());
+
+	this->threads.reserve(threads);
+	for (size_t i = 0u; i < threads; i++) this->threads.emplace_back([this, i]() { this->run(i); });
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->stopping = true;
+	}
+	this->available.notify_all();
+	for (auto &thread : this->threads) thread.join();
+}
+
+void ThreadPool::submit(Task task) {
+	const size_t lane = currentPool == this ? currentLane
+											: this->next.fetch_add(1u, std::memory_order_relaxed) % this->lanes.size();
+	{
+		// Counted before the task is published, so that a thread taking it cannot count it down first.
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->queued++;
+		std::lock_guard<std::mutex> laneLock{this->lanes[lane]->mutex};
+		this->lanes[lane]->tasks.push_back(std::move(task));
+	}
+	this->available.notify_one();
+}
+
+void ThreadPool::submit(Task task, Group &group) {
+	group.pending.fetch_add(1u, std::memory_order_relaxed);
+	this->submit([this, &group, task = std::move(task)]() {
+		task();
+		if (group.pending.fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+			std::lock_guard<std::mutex> lock{this->mutex};
+			this->available.notify_all();
+		}
+	});
+}
+
+void ThreadPool::wait() {
+	std::unique_lock<std::mutex> lock{this->mutex};
+	this->idle.wait(lock, [this]() { return this->queued == 0u && this->active == 0u; });
+}
+
+void ThreadPool::wait(Group &group) {
+	const size_t lane = currentPool == this ? currentLane : 0u;
+
+	// Helping with queued tasks, so that a task waiting on its group does not hold a thread the group may need.
+	while (group.pending.load(std::memory_order_acquire) > 0u) {
+		Task task;
+		if (this->take(lane, task)) {
+			this->execute(task);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock{this->mutex};
+		this->available.wait(lock, [this, &group]() {
+			return group.pending.load(std::memory_order_acquire) == 0u || this->queued > 0u;
+		});
+	}
+}
+
+/**
+ * @brief Take the oldest task of a lane, or else steal the oldest task of another lane.
+ *
+ * @param lane The lane of the calling thread.
+ * @param task The task taken.
+ * @return bool True if a task was taken.
+ */
+bool ThreadPool::take(size_t lane, Task &task) {
+	{
+		Lane						&own = *this->lanes[lane];
+		std::lock_guard<std::mutex> lock{own.mutex};
+		if (!own.tasks.empty()) {
+			task = std::move(own.tasks.front());
+			own.tasks.pop_front();
+			return true;
+		}
+	}
+
+	for (size_t i = 1u; i < this->lanes.size(); i++) {
+		Lane					   &victim = *this->lanes[(lane + i) % this->lanes.size()];
+		std::lock_guard<std::mutex> lock{victim.mutex};
+		if (!victim.tasks.empty()) {
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			this->steals.fetch_add(1u, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::run(size_t lane) {
+	currentPool = this;
+	currentLane = lane;
+
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock{this->mutex};
+			this->available.wait(lock, [this]() { return this->stopping || this->queued > 0u; });
+			if (this->queued == 0u) return; // Stopping, with all tasks complete.
+		}
+
+		// A task counted as queued may already have been taken by a thread yet to account for it, so retry if none.
+		Task task;
+		if (this->take(lane, task)) this->execute(task);
+	}
+}
+
+void ThreadPool::execute(Task &task) {
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->queued--;
+		this->active++;
+	}
+
+	task();
+
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		this->active--;
+		if (this->queued == 0u && this->active == 0u) this->idle.notify_all();
+	}
+}
@@ -0,0 +1,20 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Vector.hpp
+ * @brief			: Internal Conventions of Loops Vectorised Across Sensors
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <limits>
+
+/**
+ * Extensions processing every sensor at once hold their state as arrays, one per field, and run each step as a static
+ * function looping over these. Arrays are passed as __restrict pointers, sparing compilers the checks for overlap
+ * which otherwise prevent vectorisation, and loop bodies select with masks and arithmetic rather than branches.
+ */
+
+// Reading of a sensor without a value, propagating through the arithmetic of the loops.
+inline constexpr float MISSING = std::numeric_limits<float>::quiet_NaN();
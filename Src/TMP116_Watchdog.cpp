@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Watchdog.cpp
+ * @brief			: Source for TMP116_Watchdog.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Watchdog.hpp"
+
+#include <algorithm>
+
+using Watchdog	= TMP116::Watchdog;
+using Duration	= TMP116::Duration;
+using Timestamp = TMP116::Timestamp;
+
+Watchdog::Watchdog(size_t sensors, Timestamp start, Options options)
+	: options{options}, start{start}, timers(sensors) {
+	if (this->options.resolution <= Duration::zero()) this->options.resolution = Duration{1};
+	this->heads.fill(NONE);
+}
+
+Watchdog::Watchdog(size_t sensors, Timestamp start) : Watchdog(sensors, start, Options{}) {}
+
+uint64_t Watchdog::toTick(Timestamp time) const {
+	if (time <= this->start) return 0u;
+	return static_cast<uint64_t>((time - this->start) / this->options.resolution);
+}
+
+void Watchdog::link(uint32_t index) {
+	Timer &timer = this->timers[index];
+
+	// The level is the lowest whose span covers the remaining ticks, and the slot that of the expiry within the level.
+	uint64_t delta = timer.expiry - this->tick;
+	size_t	 level = 0u;
+	while (level + 1u < LEVELS && delta >= (uint64_t{1} << (BITS * (level + 1u)))) level++;
+	if (delta >= (uint64_t{1} << (BITS * LEVELS))) { // Beyond the wheel, so expired at its furthest slot instead.
+		delta		 = (uint64_t{1} << (BITS * LEVELS)) - 1u;
+		timer.expiry = this->tick + delta;
+	}
+
+	timer.slot	   = static_cast<uint32_t>(level * SLOTS + ((timer.expiry >> (BITS * level)) & (SLOTS - 1u)));
+	timer.previous = NONE;
+	timer.next	   = this->heads[timer.slot];
+	if (timer.next != NONE) this->timers[timer.next].previous = index;
+	this->heads[timer.slot] = index;
+}
+
+void Watchdog::unlink(uint32_t index) {
+	Timer &timer = this->timers[index];
+	if (timer.slot == NONE) return;
+
+	if (timer.previous != NONE) this->timers[timer.previous].next = timer.next;
+	else this->heads[timer.slot] = timer.next;
+	if (timer.next != NONE) this->timers[timer.next].previous = timer.previous;
+
+	timer.previous = timer.next = timer.slot = NONE;
+}
+
+void Watchdog::schedule(uint32_t index, Timestamp now) {
+	Timer &timer = this->timers[index];
+	this->unlink(index);
+	if (timer.state != State::ARMED) this->armed++;
+
+	// Rounded up to a whole tick, so that a timer never expires early, and at least to the next tick.
+	const auto deadline	  = now + timer.timeout - this->start;
+	const auto resolution = this->options.resolution.count();
+	const auto ticks	  = deadline.count() <= 0 ? 0 : (deadline.count() + resolution - 1) / resolution;
+	timer.expiry		  = std::max(static_cast<uint64_t>(ticks), this->tick + 1u);
+	timer.reset			  = now;
+	timer.state			  = State::ARMED;
+	this->link(index);
+}
+
+bool Watchdog::arm(SensorId sensorId, Duration timeout, Timestamp now) {
+	if (sensorId >= this->timers.size()) return false;
+
+	this->timers[sensorId].timeout = std::max(timeout, Duration::zero());
+	this->schedule(sensorId, now);
+	return true;
+}
+
+bool Watchdog::arm(SensorId sensorId, const Config &config, Timestamp now) {
+	return this->arm(sensorId, config.getConversionPeriod() + this->options.grace, now);
+}
+
+bool Watchdog::reset(SensorId sensorId, Timestamp now) {
+	if (sensorId >= this->timers.size() || this->timers[sensorId].state == State::DISARMED) return false;
+
+	this->schedule(sensorId, now);
+	return true;
+}
+
+bool Watchdog::disarm(SensorId sensorId) {
+	if (sensorId >= this->timers.size()) return false;
+
+	Timer &timer = this->timers[sensorId];
+	this->unlink(sensorId);
+	if (timer.state == State::ARMED) this->armed--;
+	timer.state = State::DISARMED;
+	return true;
+}
+
+bool Watchdog::isStale(SensorId sensorId) const {
+	return sensorId < this->timers.size() && this->timers[sensorId].state == State::EXPIRED;
+}
+
+void Watchdog::cascade(size_t level) {
+	if (level >= LEVELS) return;
+
+	const size_t index = (this->tick >> (BITS * level)) & (SLOTS - 1u);
+	uint32_t	&head  = this->heads[level * SLOTS + index];
+
+	// Each timer is relinked by its remaining ticks, which now fall within a lower level.
+	while (head != NONE) {
+		const uint32_t timer = head;
+		this->unlink(timer);
+		this->link(timer);
+	}
+	if (index == 0u) this->cascade(level + 1u);
+}
+
+size_t Watchdog::advance(Timestamp now, const Handler &handler) {
+	const uint64_t target  = this->toTick(now);
+	size_t		   expired = 0u;
+
+	while (this->tick < target) {
+		this->tick++;
+		const size_t index = this->tick & (SLOTS - 1u);
+		if (index == 0u) this->cascade(1u);
+
+		// Timers are taken one at a time, so that the handler may arm, reset or disarm any timer.
+		uint32_t &head = this->heads[index];
+		while (head != NONE) {
+			const uint32_t sensorId = head;
+			Timer		  &timer	= this->timers[sensorId];
+			this->unlink(sensorId);
+			timer.state = State::EXPIRED;
+			this->armed--;
+			expired++;
+
+			if (handler) handler(Event{static_cast<SensorId>(sensorId), timer.reset, timer.reset + timer.timeout});
+		}
+	}
+	return expired;
+}
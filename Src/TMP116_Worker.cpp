@@ -0,0 +1,147 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Worker.cpp
+ * @brief			: Source for TMP116_Worker.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Worker.hpp"
+
+#include <cerrno>
+#include <future>
+#include <mutex>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <time.h>
+
+using Worker	= TMP116::Worker;
+using Duration	= TMP116::Duration;
+using Timestamp = TMP116::Timestamp;
+using Trace	= TMP116::Trace;
+
+/**
+ * @brief Sleep until an absolute CLOCK_MONOTONIC time.
+ *
+ * @param wakeup The time to wake at.
+ */
+static void sleepUntil(Timestamp wakeup) {
+	timespec time{};
+	time.tv_sec	 = static_cast<time_t>(wakeup.count() / 1'000'000);
+	time.tv_nsec = static_cast<long>((wakeup.count() % 1'000'000) * 1'000);
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR) {} // Resume if interrupted.
+}
+
+// Workers holding the process memory locked. Memory is locked process wide, so is unlocked with the last of them.
+static std::mutex lockMutex{};
+static size_t	  lockHolders = 0u;
+
+static bool lockMemory() {
+	std::lock_guard<std::mutex> lock{lockMutex};
+	if (lockHolders == 0u && mlockall(MCL_CURRENT | MCL_FUTURE) != 0) return false;
+	lockHolders++;
+	return true;
+}
+
+static void unlockMemory() {
+	std::lock_guard<std::mutex> lock{lockMutex};
+	if (--lockHolders == 0u) munlockall();
+}
+
+Worker::Worker(Scheduler &scheduler, Options options)
+	: scheduler{scheduler}, options{options}, samples{options.capacity} {}
+
+Worker::Worker(Scheduler &scheduler) : Worker(scheduler, Options{}) {}
+
+Worker::~Worker() { this->stop(); }
+
+Timestamp Worker::now() {
+	timespec time{};
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return Timestamp{static_cast<Timestamp::rep>(time.tv_sec) * 1'000'000 + time.tv_nsec / 1'000};
+}
+
+bool Worker::start() {
+	if (this->running.exchange(true)) return false;
+
+	if (this->options.realTime && this->options.lockMemory) {
+		if (!lockMemory()) {
+			this->running.store(false);
+			return false;
+		}
+		this->memoryLocked = true;
+	}
+
+	std::promise<bool> started{};
+	auto			   result = started.get_future();
+
+	this->thread = std::thread([this, &started]() {
+		const bool applied = this->applyRealTime();
+		started.set_value(applied);
+		if (applied) this->run();
+	});
+
+	if (!result.get()) {
+		this->stop();
+		return false;
+	}
+	return true;
+}
+
+void Worker::stop() {
+	this->running.store(false, std::memory_order_release);
+	if (this->thread.joinable()) this->thread.join();
+
+	if (this->memoryLocked) {
+		unlockMemory();
+		this->memoryLocked = false;
+	}
+}
+
+bool Worker::applyRealTime() {
+	if (this->options.cpu) {
+		cpu_set_t cpus;
+		CPU_ZERO(&cpus);
+		CPU_SET(this->options.cpu.value(), &cpus);
+		if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) return false;
+	}
+
+	if (this->options.realTime) {
+		sched_param parameters{};
+		parameters.sched_priority = this->options.priority;
+		if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters) != 0) return false;
+	}
+
+	return true;
+}
+
+void Worker::run() {
+	while (this->running.load(std::memory_order_acquire)) {
+		const auto release = this->scheduler.getNextRelease();
+		Timestamp  current = now();
+
+		if (!release) {
+			sleepUntil(current + this->options.maxSleep);
+			continue;
+		} else if (release.value() > current) {
+			const Timestamp limit = current + this->options.maxSleep;
+			sleepUntil(release.value() < limit ? release.value() : limit);
+			if (release.value() > limit) continue;
+			current = now();
+		}
+
+		auto sample = this->scheduler.poll(current);
+		if (!sample) {
+			sleepUntil(current + this->options.retryInterval);
+			continue;
+		}
+
+		sample->stamp(Trace::Hop::READ, now());
+		this->jitter.record(this->scheduler.getLastRelease(), sample->timestamp);
+		if (!this->options.sink) sample->stamp(Trace::Hop::ENQUEUE, now());
+		const bool delivered = this->options.sink ? this->options.sink(sample.value()) : this->samples.push(sample.value());
+		if (!delivered) this->overruns.fetch_add(1u, std::memory_order_relaxed);
+	}
+}
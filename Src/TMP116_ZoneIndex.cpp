@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ZoneIndex.cpp
+ * @brief			: Source for TMP116_ZoneIndex.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_ZoneIndex.hpp"
+
+#include <queue>
+
+using ZoneIndex = TMP116::ZoneIndex;
+using Aggregate = TMP116::ZoneIndex::Aggregate;
+using ZoneId	= TMP116::ZoneIndex::ZoneId;
+using SensorId	= TMP116::SensorId;
+
+float Aggregate::getMean() const {
+	if (this->count == 0u) return 0.0f;
+	return static_cast<float>(this->sum) / static_cast<float>(this->count) * TMP116::TEMPERATURE_RESOLUTION;
+}
+
+ZoneIndex::ZoneIndex(size_t sensors) : sensors{sensors}, leaves{1u} {
+	while (this->leaves < sensors) this->leaves <<= 1u;
+	this->nodes.resize(this->leaves * 2u);
+}
+
+Aggregate ZoneIndex::combine(const Aggregate &left, const Aggregate &right) {
+	if (left.count == 0u) return right;
+	if (right.count == 0u) return left;
+
+	Aggregate result{};
+	result.min	  = left.min <= right.min ? left.min : right.min;
+	result.argMin = left.min <= right.min ? left.argMin : right.argMin;
+	result.max	  = left.max >= right.max ? left.max : right.max;
+	result.argMax = left.max >= right.max ? left.argMax : right.argMax;
+	result.count  = left.count + right.count;
+	result.sum	  = left.sum + right.sum;
+	return result;
+}
+
+void ZoneIndex::set(size_t sensor, const Aggregate &leaf) {
+	size_t node		  = this->leaves + sensor;
+	this->nodes[node] = leaf;
+	for (node >>= 1u; node > 0u; node >>= 1u) {
+		this->nodes[node] = combine(this->nodes[node * 2u], this->nodes[node * 2u + 1u]);
+	}
+}
+
+bool ZoneIndex::update(const Sample &sample) {
+	if (sample.sensorId >= this->sensors) return false;
+
+	const auto raw = static_cast<int16_t>(sample.raw);
+	this->set(sample.sensorId, Aggregate{raw, raw, sample.sensorId, sample.sensorId, 1u, raw});
+	return true;
+}
+
+bool ZoneIndex::invalidate(SensorId sensorId) {
+	if (sensorId >= this->sensors) return false;
+
+	this->set(sensorId, Aggregate{});
+	return true;
+}
+
+std::optional<ZoneId> ZoneIndex::addZone(SensorId first, SensorId last) {
+	if (first > last || last >= this->sensors) return std::nullopt;
+
+	this->zones.push_back(Zone{first, last});
+	return static_cast<ZoneId>(this->zones.size() - 1u);
+}
+
+std::optional<Aggregate> ZoneIndex::getZone(ZoneId zone) const {
+	if (zone >= this->zones.size()) return std::nullopt;
+	return this->getRange(this->zones[zone].first, this->zones[zone].last);
+}
+
+std::optional<Aggregate> ZoneIndex::getRange(SensorId first, SensorId last) const {
+	if (first > last || last >= this->sensors) return std::nullopt;
+
+	// Bottom-up traversal, combining the left and right boundaries in order.
+	Aggregate left{};
+	Aggregate right{};
+	for (size_t lower = first + this->leaves, upper = last + this->leaves + 1u; lower < upper;
+		 lower >>= 1u, upper >>= 1u) {
+		if (lower & 1u) left = combine(left, this->nodes[lower++]);
+		if (upper & 1u) right = combine(this->nodes[--upper], right);
+	}
+
+	const Aggregate result = combine(left, right);
+	if (result.count == 0u) return std::nullopt;
+	return result;
+}
+
+size_t ZoneIndex::getHottest(SensorId *sensors, size_t count) const {
+	const auto hotter = [this](size_t a, size_t b) { return this->nodes[a].max < this->nodes[b].max; };
+	std::priority_queue<size_t, std::vector<size_t>, decltype(hotter)> frontier{hotter};
+
+	if (this->nodes[1].count > 0u) frontier.push(1u);
+
+	size_t written = 0u;
+	while (written < count && !frontier.empty()) {
+		const size_t node = frontier.top();
+		frontier.pop();
+
+		if (node >= this->leaves) {
+			sensors[written++] = static_cast<SensorId>(node - this->leaves);
+			continue;
+		}
+		if (this->nodes[node * 2u].count > 0u) frontier.push(node * 2u);
+		if (this->nodes[node * 2u + 1u].count > 0u) frontier.push(node * 2u + 1u);
+	}
+	return written;
+}
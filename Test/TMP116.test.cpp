@@ -271,3 +271,22 @@ TEST_F(TMP116_Test, setLowLimitReturnsNulloptWhenI2CWriteFails) {
 	this->disableI2C();
 	EXPECT_EQ(this->tmp116.setLowLimit(0.0f), nullopt);
 }
+
+TEST_F(TMP116_Test, getTemperatureRegisterNormallyReturnsValue) {
+	const MemoryAddress temperatureAddress = 0x00u;
+	const Register		temperatureValue   = 0xFB00u;
+	EXPECT_CALL(mockedI2C, read(Eq(this->tmp116.getDeviceAddress()), Eq(temperatureAddress)))
+		.WillOnce(Return(temperatureValue));
+
+	EXPECT_EQ(this->tmp116.getTemperatureRegister(), temperatureValue);
+}
+
+TEST_F(TMP116_Test, getTemperatureRegisterReturnsNulloptWhenI2CReadFails) {
+	this->disableI2C();
+	EXPECT_EQ(this->tmp116.getTemperatureRegister(), nullopt);
+}
+
+TEST(TMP116_TestSample, getTemperatureConvertsRawRegister) {
+	EXPECT_FLOAT_EQ((TMP116::Sample{0u, TMP116::Timestamp::zero(), 0x15D2u}.getTemperature()), 43.640625f);
+	EXPECT_FLOAT_EQ((TMP116::Sample{0u, TMP116::Timestamp::zero(), 0xFB00u}.getTemperature()), -10.0f);
+}
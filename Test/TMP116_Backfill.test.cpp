@@ -0,0 +1,176 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Backfill.test.cpp
+ * @brief			: TMP116::Backfill Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Backfill.hpp"
+#include "TMP116_ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+#include <unistd.h>
+
+using Backfill		= TMP116::Backfill;
+using Level			= TMP116::Backfill::Level;
+using Sample		= TMP116::Sample;
+using SegmentWriter = TMP116::SegmentWriter;
+using ThreadPool	= TMP116::ThreadPool;
+using std::chrono::microseconds;
+
+class TMP116_TestBackfill : public ::testing::Test {
+public:
+	std::vector<std::string> paths{};
+
+	void TearDown() override {
+		for (const auto &path : paths) unlink(path.c_str());
+	}
+
+	/**
+	 * @brief Write a segment of samples of 16 sensors every 10us, each ramping between raw 0 and 199.
+	 */
+	void writeSegment(int64_t start, size_t count) {
+		paths.push_back(
+			"/tmp/TMP116_TestBackfill." + std::to_string(getpid()) + "." + std::to_string(paths.size()) + ".seg"
+		);
+		SegmentWriter writer{paths.back(), 128u};
+		ASSERT_TRUE(writer.open());
+		for (size_t i = 0u; i < count; i++) {
+			const auto time = start + static_cast<int64_t>(i / 16u) * 10;
+			const auto raw	= static_cast<TMP116::Register>((time / 10 + static_cast<int64_t>(i % 16u)) % 200);
+			ASSERT_TRUE(writer.append(Sample{static_cast<TMP116::SensorId>(i % 16u), microseconds{time}, raw}));
+		}
+		ASSERT_TRUE(writer.seal());
+	}
+
+	Backfill::Options makeOptions() const {
+		Backfill::Options options{};
+		options.sensorsPerShard = 4u;
+		options.shardDuration	= microseconds{1000};
+		options.rollupInterval	= microseconds{300}; // Not dividing the shard duration, so spanning shards.
+		options.lowLimit		= 20;
+		options.highLimit		= 180;
+		return options;
+	}
+};
+
+TEST_F(TMP116_TestBackfill, plansShardsBySensorRangeAndTimeWindow) {
+	writeSegment(500, 16u * 100u); // Sensors 0 to 15, from 500us to 1490us.
+
+	Backfill backfill{paths, makeOptions()};
+	ASSERT_TRUE(backfill.open());
+
+	const auto shards = backfill.plan();
+	ASSERT_EQ(shards.size(), 4u * 2u);
+	EXPECT_EQ(shards[0].first, 0u);
+	EXPECT_EQ(shards[0].last, 3u);
+	EXPECT_EQ(shards[0].from, microseconds{0});
+	EXPECT_EQ(shards[0].to, microseconds{999});
+	EXPECT_EQ(shards[1].from, microseconds{1000});
+	EXPECT_EQ(shards[1].to, microseconds{1490});
+	EXPECT_EQ(shards[7].first, 12u);
+	EXPECT_EQ(shards[7].last, 15u);
+}
+
+TEST_F(TMP116_TestBackfill, aggregatesAndAlertsMatchSequentialEvaluation) {
+	writeSegment(0, 16u * 500u);
+	writeSegment(5000, 16u * 500u);
+
+	const auto options = makeOptions();
+	Backfill   backfill{paths, options};
+	ASSERT_TRUE(backfill.open());
+
+	ThreadPool pool{4u};
+	const auto result = backfill.run(pool);
+	EXPECT_EQ(result.samples, 16u * 1000u);
+	EXPECT_EQ(result.dropped, 0u);
+
+	// Evaluate sensor 5 sequentially over all of its samples.
+	std::vector<Backfill::Alert> alerts{};
+	Level						 level = Level::NORMAL;
+	uint32_t					 count = 0u;
+	int64_t						 sum   = 0;
+	for (int64_t time = 0; time < 10000; time += 10) {
+		const auto raw	   = static_cast<TMP116::Register>((time / 10 + 5) % 200);
+		const auto current = backfill.classify(raw);
+		if (current != level) alerts.push_back(Backfill::Alert{5u, microseconds{time}, raw, current});
+		level = current;
+		if (time >= 600 && time < 900) {
+			count++;
+			sum += raw;
+		}
+	}
+
+	std::vector<Backfill::Alert> actual{};
+	for (const auto &alert : result.alerts)
+		if (alert.sensorId == 5u) actual.push_back(alert);
+	ASSERT_EQ(actual.size(), alerts.size());
+	for (size_t i = 0u; i < alerts.size(); i++) {
+		EXPECT_EQ(actual[i].timestamp, alerts[i].timestamp);
+		EXPECT_EQ(actual[i].level, alerts[i].level);
+	}
+
+	// The interval from 900us to 1200us spans two shards and is aggregated once.
+	size_t buckets = 0u;
+	for (const auto &aggregate : result.aggregates) {
+		if (aggregate.sensorId != 5u) continue;
+		buckets++;
+		if (aggregate.bucket.start == microseconds{600}) {
+			EXPECT_EQ(aggregate.bucket.count, count);
+			EXPECT_EQ(aggregate.bucket.sum, sum);
+		}
+		if (aggregate.bucket.start == microseconds{900}) {
+			EXPECT_EQ(aggregate.bucket.count, 30u);
+		}
+	}
+	EXPECT_EQ(buckets, (10000u + 299u) / 300u);
+}
+
+TEST_F(TMP116_TestBackfill, resultIsIndependentOfThreadCount) {
+	writeSegment(0, 16u * 700u);
+	writeSegment(3000, 16u * 700u); // Overlapping the first segment in time.
+
+	Backfill backfill{paths, makeOptions()};
+	ASSERT_TRUE(backfill.open());
+
+	ThreadPool single{1u};
+	const auto expected = backfill.run(single);
+	ASSERT_FALSE(expected.alerts.empty());
+
+	for (size_t threads : {2u, 3u, 8u}) {
+		ThreadPool pool{threads};
+		const auto result = backfill.run(pool);
+
+		ASSERT_EQ(result.alerts.size(), expected.alerts.size());
+		for (size_t i = 0u; i < result.alerts.size(); i++) {
+			EXPECT_EQ(result.alerts[i].sensorId, expected.alerts[i].sensorId);
+			EXPECT_EQ(result.alerts[i].timestamp, expected.alerts[i].timestamp);
+			EXPECT_EQ(result.alerts[i].raw, expected.alerts[i].raw);
+			EXPECT_EQ(result.alerts[i].level, expected.alerts[i].level);
+		}
+		ASSERT_EQ(result.aggregates.size(), expected.aggregates.size());
+		for (size_t i = 0u; i < result.aggregates.size(); i++) {
+			EXPECT_EQ(result.aggregates[i].sensorId, expected.aggregates[i].sensorId);
+			EXPECT_EQ(result.aggregates[i].bucket.start, expected.aggregates[i].bucket.start);
+			EXPECT_EQ(result.aggregates[i].bucket.sum, expected.aggregates[i].bucket.sum);
+			EXPECT_EQ(result.aggregates[i].bucket.last, expected.aggregates[i].bucket.last);
+		}
+	}
+}
+
+TEST_F(TMP116_TestBackfill, filterDropsSamples) {
+	writeSegment(0, 16u * 100u);
+
+	auto options   = makeOptions();
+	options.filter = [](Sample &sample) { return sample.sensorId % 2u == 0u; };
+	Backfill backfill{paths, options};
+	ASSERT_TRUE(backfill.open());
+
+	ThreadPool pool{2u};
+	const auto result = backfill.run(pool);
+	EXPECT_EQ(result.samples, 16u * 100u);
+	EXPECT_EQ(result.dropped, 8u * 100u);
+	for (const auto &aggregate : result.aggregates) EXPECT_EQ(aggregate.sensorId % 2u, 0u);
+}
@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_BusModel.test.cpp
+ * @brief			: TMP116::BusModel and TMP116::BusMonitor Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_BusModel.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using ::testing::_;
+using ::testing::Return;
+
+using BusModel	 = TMP116::BusModel;
+using BusMonitor = TMP116::BusMonitor;
+using Config	 = TMP116::Config;
+using Operation	 = TMP116::BusModel::Operation;
+using PollPolicy = TMP116::BusModel::PollPolicy;
+using Register	 = TMP116::Register;
+using std::chrono::microseconds;
+
+class BusMonitorMockedI2C : public TMP116::I2C {
+public:
+	MOCK_METHOD(
+		std::optional<Register>, //
+		read,
+		(DeviceAddress deviceAddress, MemoryAddress memoryAddress),
+		(override)
+	);
+	MOCK_METHOD(
+		std::optional<Register>,
+		write,
+		(DeviceAddress deviceAddress, MemoryAddress memoryAddress, Register registerValue),
+		(override)
+	);
+};
+
+static PollPolicy fastPolicy(void) {
+	PollPolicy policy{};
+	policy.config.conversionCycleTime = Config::ConversionCycleTime::CONV_15_5MS;
+	policy.config.averages			  = Config::Averages::AVG_1;
+	return policy;
+}
+
+TEST(TMP116_TestBusModel, getClockCyclesReturnsTransactionShapes) {
+	EXPECT_EQ(BusModel::getClockCycles(Operation::GET_TEMPERATURE), 48u);
+	EXPECT_EQ(BusModel::getClockCycles(Operation::DATA_READY), 48u);
+	EXPECT_EQ(BusModel::getClockCycles(Operation::SET_CONFIG), 38u);
+	EXPECT_EQ(BusModel::getClockCycles(Operation::SET_CONFIG_PARTIAL), 86u);
+}
+
+TEST(TMP116_TestBusModel, getTransactionTimeScalesWithClockFrequency) {
+	EXPECT_EQ(BusModel{100'000u}.getTransactionTime(Operation::GET_TEMPERATURE), microseconds{480});
+	EXPECT_EQ(BusModel{400'000u}.getTransactionTime(Operation::GET_TEMPERATURE), microseconds{120});
+	EXPECT_EQ(BusModel{400'000u}.getTransactionTime(Operation::SET_CONFIG), microseconds{95});
+}
+
+TEST(TMP116_TestBusModel, zeroClockFrequencyIsClamped) {
+	const BusModel model{0u};
+	EXPECT_EQ(model.getClockFrequency(), 1u);
+	EXPECT_EQ(model.getTransactionTime(Operation::GET_TEMPERATURE), microseconds{48'000'000});
+	EXPECT_EQ(model.fit(PollPolicy{}), std::nullopt);
+}
+
+TEST(TMP116_TestBusModel, pollPolicyPeriodIsNeverFasterThanConversionPeriod) {
+	PollPolicy policy = fastPolicy();
+	EXPECT_EQ(policy.getPeriod(), microseconds{15'500});
+
+	policy.period = microseconds{1'000};
+	EXPECT_EQ(policy.getPeriod(), microseconds{15'500});
+
+	policy.period = microseconds{100'000};
+	EXPECT_EQ(policy.getPeriod(), microseconds{100'000});
+}
+
+TEST(TMP116_TestBusModel, getOccupancyIncludesDataReadyPolling) {
+	BusModel   model{100'000u};
+	PollPolicy policy = fastPolicy();
+	EXPECT_FLOAT_EQ(model.getOccupancy(policy), 0.00048f / 0.0155f);
+
+	policy.pollDataReady = true;
+	EXPECT_FLOAT_EQ(model.getOccupancy(policy), 0.00096f / 0.0155f);
+}
+
+TEST(TMP116_TestBusModel, admitAcceptsPolicyWithinBudget) {
+	BusModel model{100'000u, 0.05f};
+
+	const auto admitted = model.admit(fastPolicy());
+	ASSERT_TRUE(admitted.has_value());
+	EXPECT_EQ(admitted->config, fastPolicy().config);
+	EXPECT_EQ(model.getPolicies().size(), 1u);
+	EXPECT_FLOAT_EQ(model.getOccupancy(), 0.00048f / 0.0155f);
+}
+
+TEST(TMP116_TestBusModel, admitDegradesPolicyExceedingBudget) {
+	BusModel model{100'000u, 0.05f};
+	ASSERT_TRUE(model.admit(fastPolicy()).has_value());
+
+	const auto admitted = model.admit(fastPolicy());
+	ASSERT_TRUE(admitted.has_value());
+	EXPECT_EQ(admitted->config.conversionCycleTime, Config::ConversionCycleTime::CONV_125MS);
+	EXPECT_LE(model.getOccupancy(), 0.05f);
+}
+
+TEST(TMP116_TestBusModel, admitRejectsPolicyWhenBudgetExhausted) {
+	BusModel model{100'000u, 0.0f};
+	EXPECT_EQ(model.admit(fastPolicy()), std::nullopt);
+	EXPECT_TRUE(model.getPolicies().empty());
+}
+
+TEST(TMP116_TestBusMonitor, countsAndForwardsTransactions) {
+	BusMonitorMockedI2C mockedI2C{};
+	BusModel			model{100'000u};
+	BusMonitor			monitor{mockedI2C, model};
+	TMP116				tmp116{monitor, TMP116::DeviceAddress::ADD0_GND};
+
+	EXPECT_CALL(mockedI2C, read).WillOnce(Return(0x0080u)).WillOnce(Return(std::nullopt));
+	EXPECT_CALL(mockedI2C, write).WillOnce(Return(0x0220u));
+
+	EXPECT_FLOAT_EQ(tmp116.getTemperature(), 1.0f);
+	EXPECT_EQ(tmp116.getDeviceId(), std::nullopt);
+	EXPECT_EQ(tmp116.setConfig(Config{}), Register{0x0220u});
+
+	EXPECT_EQ(monitor.getReads(), 2u);
+	EXPECT_EQ(monitor.getWrites(), 1u);
+	EXPECT_EQ(monitor.getFailures(), 1u);
+
+	monitor.reset();
+	EXPECT_EQ(monitor.getReads(), 0u);
+}
+
+TEST(TMP116_TestBusMonitor, getOccupancyErrorComparesAgainstModel) {
+	BusMonitorMockedI2C mockedI2C{};
+	BusModel			model{100'000u};
+	BusMonitor			monitor{mockedI2C, model};
+	TMP116				tmp116{monitor, TMP116::DeviceAddress::ADD0_GND};
+
+	ASSERT_TRUE(model.admit(PollPolicy{}).has_value()); // One read per second.
+
+	EXPECT_CALL(mockedI2C, read).WillRepeatedly(Return(0x0000u));
+	for (int i = 0; i < 4; i++) tmp116.getTemperature();
+
+	EXPECT_FLOAT_EQ(monitor.getOccupancy(microseconds{2'000'000}), 0.00096f);
+	EXPECT_FLOAT_EQ(monitor.getOccupancyError(microseconds{2'000'000}), 0.00048f);
+}
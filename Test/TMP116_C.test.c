@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_C.test.c
+ * @brief			: TMP116 C API Tests, compiled as C against the shared library
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_C.h"
+
+#include <math.h>
+#include <stdio.h>
+
+static int failures = 0;
+
+#define EXPECT(condition)                                                                                          \
+	do {                                                                                                           \
+		if (!(condition)) {                                                                                        \
+			fprintf(stderr, "%s:%d: Expected %s\n", __FILE__, __LINE__, #condition);                               \
+			failures++;                                                                                            \
+		}                                                                                                          \
+	} while (0)
+
+/**
+ * @brief Temperature Registers of four devices on a simulated bus, the last of which fails.
+ */
+typedef struct FakeBus {
+	uint16_t temperatures[4];
+	size_t	 reads;
+} FakeBus;
+
+static int fakeRead(void *context, uint8_t deviceAddress, uint8_t memoryAddress, uint16_t *data) {
+	FakeBus *bus = (FakeBus *)context;
+	bus->reads++;
+	if (deviceAddress == 0x4Bu || memoryAddress != 0x00u) return -1;
+	*data = bus->temperatures[deviceAddress - 0x48u];
+	return 0;
+}
+
+static int fakeWrite(void *context, uint8_t deviceAddress, uint8_t memoryAddress, uint16_t data) {
+	(void)context;
+	(void)deviceAddress;
+	(void)memoryAddress;
+	(void)data;
+	return -1;
+}
+
+int main(void) {
+	FakeBus			 fake = {{0x0C80u, 0xFF00u, 0x0000u, 0x0000u}, 0u};
+	const TMP116_Bus bus  = {&fake, fakeRead, fakeWrite};
+
+	EXPECT(TMP116_getAbiVersion() == TMP116_C_ABI_VERSION);
+	EXPECT(sizeof(TMP116_Sample) == 16u);
+
+	TMP116_Fleet *fleet = TMP116_Fleet_create();
+	EXPECT(fleet != NULL);
+	if (fleet == NULL) return 1;
+
+	for (uint8_t address = 0x48u; address <= 0x4Bu; address++)
+		EXPECT(TMP116_Fleet_addSensor(fleet, &bus, address) == address - 0x48);
+	EXPECT(TMP116_Fleet_addSensor(fleet, &bus, 0x4Cu) == -1);
+	EXPECT(TMP116_Fleet_getSensors(fleet) == 4u);
+
+	const TMP116_SensorId sensors[] = {1u, 0u, 3u};
+	float				  temperatures[3];
+	EXPECT(TMP116_Fleet_readTemperatures(fleet, sensors, 3u, temperatures) == 2u);
+	EXPECT(temperatures[0] == -2.0f);
+	EXPECT(temperatures[1] == 25.0f);
+	EXPECT(isnan(temperatures[2]));
+
+	TMP116_Sample samples[3];
+	EXPECT(TMP116_Fleet_sample(fleet, sensors, 3u, 1000000, samples) == 2u);
+	EXPECT(samples[0].sensorId == 1u && samples[0].raw == 0xFF00u && samples[0].timestamp == 1000000);
+	EXPECT(samples[0].reserved == 0u);
+	EXPECT(samples[1].sensorId == 0u && samples[1].raw == 0x0C80u);
+	EXPECT(fake.reads == 6u);
+
+	// A NULL handle, such as from a failed create, is refused rather than dereferenced.
+	EXPECT(TMP116_Fleet_readTemperatures(NULL, sensors, 3u, temperatures) == 0u);
+	EXPECT(TMP116_Fleet_sample(fleet, sensors, 3u, 0, NULL) == 0u);
+	EXPECT(TMP116_SampleRing_size(NULL) == 0u);
+
+	TMP116_Fleet_destroy(fleet);
+
+	if (failures > 0) fprintf(stderr, "%d failures\n", failures);
+	return failures > 0;
+}
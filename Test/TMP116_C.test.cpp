@@ -0,0 +1,203 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_C.test.cpp
+ * @brief			: TMP116 C API Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_C.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <map>
+
+using std::chrono::microseconds;
+
+/**
+ * @brief Registers of the devices on a simulated bus, by device and memory address, with failing devices.
+ */
+struct FakeBus {
+	std::map<std::pair<uint8_t, uint8_t>, uint16_t> registers{};
+	std::map<uint8_t, bool>							failing{};
+	size_t											reads  = 0u;
+	size_t											writes = 0u;
+
+	static int read(void *context, uint8_t deviceAddress, uint8_t memoryAddress, uint16_t *data) {
+		auto &bus = *static_cast<FakeBus *>(context);
+		bus.reads++;
+		if (bus.failing[deviceAddress]) return -1;
+		*data = bus.registers[{deviceAddress, memoryAddress}];
+		return 0;
+	}
+
+	static int write(void *context, uint8_t deviceAddress, uint8_t memoryAddress, uint16_t data) {
+		auto &bus = *static_cast<FakeBus *>(context);
+		bus.writes++;
+		if (bus.failing[deviceAddress]) return -1;
+		bus.registers[{deviceAddress, memoryAddress}] = data;
+		return 0;
+	}
+
+	TMP116_Bus getBus() { return TMP116_Bus{this, &FakeBus::read, &FakeBus::write}; }
+};
+
+class TMP116_TestC : public ::testing::Test {
+public:
+	FakeBus		  first{};
+	FakeBus		  second{};
+	TMP116_Fleet *fleet = nullptr;
+
+	void SetUp() override {
+		fleet					 = TMP116_Fleet_create();
+		const TMP116_Bus buses[] = {first.getBus(), second.getBus()};
+
+		// Sensors 0 to 3 on the first bus, 4 to 5 on the second.
+		for (uint8_t address = 0x48u; address <= 0x4Bu; address++)
+			ASSERT_EQ(TMP116_Fleet_addSensor(fleet, &buses[0], address), address - 0x48);
+		ASSERT_EQ(TMP116_Fleet_addSensor(fleet, &buses[1], 0x48u), 4);
+		ASSERT_EQ(TMP116_Fleet_addSensor(fleet, &buses[1], 0x49u), 5);
+
+		for (uint8_t address = 0x48u; address <= 0x4Bu; address++)
+			first.registers[{address, 0x00u}] = static_cast<uint16_t>(0x0C80u + address); // About 25 degrees.
+		second.registers[{0x48u, 0x00u}] = 0xFF00u;										// -2 degrees.
+		second.failing[0x49u]			 = true;
+	}
+
+	void TearDown() override { TMP116_Fleet_destroy(fleet); }
+};
+
+TEST_F(TMP116_TestC, addSensorRejectsInvalidArguments) {
+	const TMP116_Bus bus	 = first.getBus();
+	TMP116_Bus		 invalid = bus;
+	invalid.read			 = nullptr;
+
+	EXPECT_EQ(TMP116_Fleet_addSensor(fleet, &bus, 0x47u), -1);
+	EXPECT_EQ(TMP116_Fleet_addSensor(fleet, &bus, 0x4Cu), -1);
+	EXPECT_EQ(TMP116_Fleet_addSensor(fleet, &invalid, 0x48u), -1);
+	EXPECT_EQ(TMP116_Fleet_addSensor(fleet, nullptr, 0x48u), -1);
+	EXPECT_EQ(TMP116_Fleet_addSensor(nullptr, &bus, 0x48u), -1);
+	EXPECT_EQ(TMP116_Fleet_getSensors(fleet), 6u);
+	EXPECT_EQ(TMP116_Fleet_getSensors(nullptr), 0u);
+}
+
+TEST_F(TMP116_TestC, readTemperaturesReadsEachSensorOnce) {
+	const TMP116_SensorId sensors[] = {4u, 0u, 5u, 3u, 9u};
+	float				  temperatures[5];
+
+	EXPECT_EQ(TMP116_Fleet_readTemperatures(fleet, sensors, 5u, temperatures), 3u);
+	EXPECT_FLOAT_EQ(temperatures[0], -2.0f);
+	EXPECT_FLOAT_EQ(temperatures[1], static_cast<float>(0x0C80u + 0x48u) * 0.0078125f);
+	EXPECT_TRUE(std::isnan(temperatures[2])); // Failing.
+	EXPECT_FLOAT_EQ(temperatures[3], static_cast<float>(0x0C80u + 0x4Bu) * 0.0078125f);
+	EXPECT_TRUE(std::isnan(temperatures[4])); // Unknown.
+	EXPECT_EQ(first.reads + second.reads, 4u);
+}
+
+TEST_F(TMP116_TestC, sampleSkipsFailedSensors) {
+	const TMP116_SensorId sensors[] = {0u, 5u, 4u};
+	TMP116_Sample		  samples[3];
+
+	ASSERT_EQ(TMP116_Fleet_sample(fleet, sensors, 3u, 1'000'000, samples), 2u);
+	EXPECT_EQ(samples[0].sensorId, 0u);
+	EXPECT_EQ(samples[0].raw, 0x0C80u + 0x48u);
+	EXPECT_EQ(samples[0].timestamp, 1'000'000);
+	EXPECT_EQ(samples[1].sensorId, 4u);
+	EXPECT_EQ(samples[1].raw, 0xFF00u);
+}
+
+TEST_F(TMP116_TestC, appliesAndReadsConfigsInBulk) {
+	TMP116::Config config{};
+	config.averages		   = TMP116::Config::Averages::AVG_64;
+	const uint16_t written = static_cast<TMP116::Register>(config);
+
+	const TMP116_SensorId sensors[] = {0u, 1u, 5u, 4u};
+	const uint16_t		  configs[] = {written, static_cast<uint16_t>(written | 0x2000u), written, 0x0000u};
+	uint8_t				  succeeded[4];
+
+	EXPECT_EQ(TMP116_Fleet_applyConfigs(fleet, sensors, 4u, configs, succeeded), 3u);
+	EXPECT_EQ(succeeded[0], 1u);
+	EXPECT_EQ(succeeded[1], 1u);
+	EXPECT_EQ(succeeded[2], 0u);
+	EXPECT_EQ(succeeded[3], 1u);
+	EXPECT_EQ((first.registers[{0x49u, 0x01u}]), written); // The read-only Data Ready flag is not written.
+
+	uint16_t read[4];
+	EXPECT_EQ(TMP116_Fleet_readConfigs(fleet, sensors, 4u, read, nullptr), 3u);
+	EXPECT_EQ(read[0], written);
+	EXPECT_EQ(read[1], written);
+	EXPECT_EQ(read[2], 0u);
+	EXPECT_EQ(read[3], 0x0000u);
+}
+
+TEST_F(TMP116_TestC, setsLimitsInBulk) {
+	const TMP116_SensorId sensors[] = {2u, 5u};
+	const float			  low[]		= {-10.0f, 0.0f};
+	const float			  high[]	= {85.0f, 50.0f};
+	uint8_t				  succeeded[2];
+
+	EXPECT_EQ(TMP116_Fleet_setLimits(fleet, sensors, 2u, low, high, succeeded), 1u);
+	EXPECT_EQ(succeeded[0], 1u);
+	EXPECT_EQ(succeeded[1], 0u);
+	EXPECT_EQ((first.registers[{0x4Au, 0x02u}]), static_cast<uint16_t>(85.0f / 0.0078125f));
+	EXPECT_EQ((first.registers[{0x4Au, 0x03u}]), static_cast<uint16_t>(static_cast<int16_t>(-10.0f / 0.0078125f)));
+	EXPECT_EQ(second.writes, 1u); // Stops at the first failed write.
+}
+
+TEST(TMP116_TestCRing, drainsRingsInBulk) {
+	TMP116::Ring<TMP116::Sample> rings[2]{TMP116::Ring<TMP116::Sample>{256u}, TMP116::Ring<TMP116::Sample>{256u}};
+	for (uint16_t i = 0u; i < 200u; i++) {
+		rings[0].push(TMP116::Sample{0u, microseconds{i}, i});
+		if (i < 30u) rings[1].push(TMP116::Sample{1u, microseconds{i}, static_cast<uint16_t>(i + 1000u)});
+	}
+
+	TMP116_SampleRing *const handles[] = {TMP116_SampleRing_handle(rings[0]), TMP116_SampleRing_handle(rings[1])};
+	EXPECT_EQ(TMP116_SampleRing_size(handles[0]), 200u);
+
+	TMP116_Sample samples[256];
+	ASSERT_EQ(TMP116_SampleRing_drain(handles[0], samples, 150u), 150u);
+	for (uint16_t i = 0u; i < 150u; i++) {
+		EXPECT_EQ(samples[i].raw, i);
+		EXPECT_EQ(samples[i].timestamp, i);
+	}
+
+	// The rest of the first ring, then the second, up to the capacity.
+	ASSERT_EQ(TMP116_SampleRing_drainAll(handles, 2u, samples, 70u), 70u);
+	EXPECT_EQ(samples[0].raw, 150u);
+	EXPECT_EQ(samples[49].raw, 199u);
+	EXPECT_EQ(samples[50].sensorId, 1u);
+	EXPECT_EQ(samples[50].raw, 1000u);
+	EXPECT_EQ(TMP116_SampleRing_size(handles[1]), 10u);
+
+	EXPECT_EQ(TMP116_SampleRing_drainAll(handles, 2u, samples, 256u), 10u);
+	EXPECT_EQ(samples[9].raw, 1029u);
+	EXPECT_EQ(TMP116_SampleRing_drain(handles[0], samples, 256u), 0u);
+}
+
+TEST_F(TMP116_TestC, nullHandlesAndArraysReturnZero) {
+	const TMP116_SensorId sensors[] = {0u};
+	float				  temperatures[1];
+	TMP116_Sample		  samples[1];
+	uint16_t			  configs[1] = {0u};
+	const float			  limits[]	 = {0.0f};
+
+	EXPECT_EQ(TMP116_Fleet_readTemperatures(nullptr, sensors, 1u, temperatures), 0u);
+	EXPECT_EQ(TMP116_Fleet_readTemperatures(fleet, nullptr, 1u, temperatures), 0u);
+	EXPECT_EQ(TMP116_Fleet_readTemperatures(fleet, sensors, 1u, nullptr), 0u);
+	EXPECT_EQ(TMP116_Fleet_sample(nullptr, sensors, 1u, 0, samples), 0u);
+	EXPECT_EQ(TMP116_Fleet_sample(fleet, sensors, 1u, 0, nullptr), 0u);
+	EXPECT_EQ(TMP116_Fleet_readConfigs(nullptr, sensors, 1u, configs, nullptr), 0u);
+	EXPECT_EQ(TMP116_Fleet_readConfigs(fleet, sensors, 1u, nullptr, nullptr), 0u);
+	EXPECT_EQ(TMP116_Fleet_applyConfigs(nullptr, sensors, 1u, configs, nullptr), 0u);
+	EXPECT_EQ(TMP116_Fleet_applyConfigs(fleet, sensors, 1u, nullptr, nullptr), 0u);
+	EXPECT_EQ(TMP116_Fleet_setLimits(nullptr, sensors, 1u, limits, limits, nullptr), 0u);
+	EXPECT_EQ(TMP116_Fleet_setLimits(fleet, sensors, 1u, limits, nullptr, nullptr), 0u);
+	EXPECT_EQ(TMP116_Fleet_readTemperatures(fleet, nullptr, 0u, nullptr), 0u); // Nothing to read.
+	EXPECT_EQ(first.reads + first.writes, 0u);
+
+	EXPECT_EQ(TMP116_SampleRing_drain(nullptr, samples, 1u), 0u);
+	EXPECT_EQ(TMP116_SampleRing_drainAll(nullptr, 2u, samples, 1u), 0u);
+	EXPECT_EQ(TMP116_SampleRing_size(nullptr), 0u);
+	TMP116_Fleet_destroy(nullptr);
+}
@@ -0,0 +1,67 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ChangePublisher.test.cpp
+ * @brief			: TMP116::ChangePublisher Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_ChangePublisher.hpp"
+
+#include "gtest/gtest.h"
+
+using ChangePublisher = TMP116::ChangePublisher;
+using Register		  = TMP116::Register;
+using Sample		  = TMP116::Sample;
+using std::chrono::seconds;
+
+class TMP116_TestChangePublisher : public ::testing::Test {
+public:
+	ChangePublisher publisher{2u, 4u, seconds{60}};
+
+	bool offer(TMP116::SensorId sensorId, int time, int16_t raw) {
+		return publisher.offer(Sample{sensorId, seconds{time}, static_cast<Register>(raw)}).has_value();
+	}
+};
+
+TEST_F(TMP116_TestChangePublisher, publishesFirstSampleAndChangesBeyondDeadband) {
+	EXPECT_TRUE(offer(0u, 0, 100));
+	EXPECT_FALSE(offer(0u, 1, 104));
+	EXPECT_FALSE(offer(0u, 2, 96));
+	EXPECT_TRUE(offer(0u, 3, 105));
+	EXPECT_FALSE(offer(0u, 4, 102)); // Within the deadband of the last published value, 105.
+	EXPECT_TRUE(offer(0u, 5, -20));
+
+	const auto statistics = publisher.getStatistics(0u);
+	ASSERT_TRUE(statistics.has_value());
+	EXPECT_EQ(statistics->received, 6u);
+	EXPECT_EQ(statistics->published, 3u);
+	EXPECT_EQ(statistics->suppressed, 3u);
+	EXPECT_FLOAT_EQ(statistics->getSuppression(), 0.5f);
+}
+
+TEST_F(TMP116_TestChangePublisher, publishesHeartbeatWhenIntervalExpires) {
+	EXPECT_TRUE(offer(1u, 0, 100));
+	EXPECT_FALSE(offer(1u, 59, 100));
+	EXPECT_TRUE(offer(1u, 60, 100));
+	EXPECT_FALSE(offer(1u, 119, 100));
+	EXPECT_TRUE(offer(1u, 120, 100));
+
+	EXPECT_EQ(publisher.getStatistics(1u)->heartbeats, 2u);
+	EXPECT_EQ(publisher.getStatistics().published, 3u);
+}
+
+TEST_F(TMP116_TestChangePublisher, deadbandIsPerSensor) {
+	EXPECT_TRUE(publisher.setDeadband(1u, 0u));
+	EXPECT_FALSE(publisher.setDeadband(2u, 0u));
+
+	EXPECT_TRUE(offer(0u, 0, 100));
+	EXPECT_TRUE(offer(1u, 0, 100));
+	EXPECT_FALSE(offer(0u, 1, 101));
+	EXPECT_TRUE(offer(1u, 1, 101));
+	EXPECT_FALSE(offer(1u, 2, 101));
+
+	EXPECT_FALSE(offer(2u, 0, 100));
+	EXPECT_EQ(publisher.getStatistics(2u), std::nullopt);
+	EXPECT_EQ(publisher.getStatistics().received, 5u);
+}
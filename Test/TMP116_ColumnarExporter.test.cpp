@@ -0,0 +1,126 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ColumnarExporter.test.cpp
+ * @brief			: TMP116::ColumnarExporter Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_ColumnarExporter.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using ColumnarExporter = TMP116::ColumnarExporter;
+using Sample		   = TMP116::Sample;
+using std::chrono::microseconds;
+
+static Sample makeSample(TMP116::SensorId sensorId, int64_t timestamp, TMP116::Register raw) {
+	return Sample{sensorId, microseconds{timestamp}, raw};
+}
+
+TEST(TMP116_TestColumnarExporter, appendsIntoColumns) {
+	ColumnarExporter exporter{4u};
+
+	EXPECT_TRUE(exporter.append(makeSample(7u, 100, 0x0C80u)));
+	EXPECT_TRUE(exporter.appendMissing(3u, microseconds{200}));
+	EXPECT_TRUE(exporter.append(makeSample(7u, 300, 0xFB00u)));
+	EXPECT_EQ(exporter.size(), 3u);
+	EXPECT_EQ(exporter.getNullCount(), 1u);
+
+	EXPECT_EQ(exporter.getTimestamps()[0], 100);
+	EXPECT_EQ(exporter.getTimestamps()[2], 300);
+	EXPECT_EQ(exporter.getRaw()[0], 0x0C80);
+	EXPECT_EQ(exporter.getRaw()[2], -1280);
+	EXPECT_EQ(exporter.getValidity()[0], 0b101u);
+
+	ASSERT_EQ(exporter.getDictionarySize(), 2u);
+	EXPECT_EQ(exporter.getDictionary()[0], 7u);
+	EXPECT_EQ(exporter.getDictionary()[1], 3u);
+	EXPECT_EQ(exporter.getIndices()[0], 0);
+	EXPECT_EQ(exporter.getIndices()[1], 1);
+	EXPECT_EQ(exporter.getIndices()[2], 0);
+}
+
+TEST(TMP116_TestColumnarExporter, appendStopsWhenFull) {
+	ColumnarExporter	exporter{3u};
+	std::vector<Sample> samples{};
+	for (int64_t i = 0; i < 5; i++) samples.push_back(makeSample(1u, i, 0u));
+
+	EXPECT_EQ(exporter.append(samples.data(), samples.size()), 3u);
+	EXPECT_TRUE(exporter.isFull());
+	EXPECT_FALSE(exporter.appendMissing(1u, microseconds{10}));
+}
+
+TEST(TMP116_TestColumnarExporter, buffersAreAligned) {
+	ColumnarExporter exporter{100u};
+	for (const void *buffer : {static_cast<const void *>(exporter.getTimestamps()),
+							   static_cast<const void *>(exporter.getIndices()),
+							   static_cast<const void *>(exporter.getRaw()),
+							   static_cast<const void *>(exporter.getValidity()),
+							   static_cast<const void *>(exporter.getDictionary())}) {
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer) % ColumnarExporter::ALIGNMENT, 0u);
+	}
+}
+
+TEST(TMP116_TestColumnarExporter, exportsSchema) {
+	ArrowSchema schema{};
+	ColumnarExporter::exportSchema(&schema);
+
+	EXPECT_STREQ(schema.format, "+s");
+	ASSERT_EQ(schema.n_children, 3);
+	EXPECT_STREQ(schema.children[0]->format, "tsu:");
+	EXPECT_STREQ(schema.children[0]->name, "timestamp");
+	EXPECT_STREQ(schema.children[1]->format, "i");
+	ASSERT_NE(schema.children[1]->dictionary, nullptr);
+	EXPECT_STREQ(schema.children[1]->dictionary->format, "S");
+	EXPECT_STREQ(schema.children[2]->format, "s");
+	EXPECT_EQ(schema.children[2]->flags, ARROW_FLAG_NULLABLE);
+
+	schema.release(&schema);
+	EXPECT_EQ(schema.release, nullptr);
+}
+
+TEST(TMP116_TestColumnarExporter, exportsBatchWithoutCopying) {
+	ColumnarExporter exporter{8u};
+	ArrowArray		 array{};
+	EXPECT_FALSE(exporter.exportBatch(&array));
+
+	exporter.append(makeSample(5u, 1'000, 0x0100u));
+	exporter.appendMissing(6u, microseconds{2'000});
+	const int64_t *timestamps = exporter.getTimestamps();
+
+	ASSERT_TRUE(exporter.exportBatch(&array));
+	EXPECT_EQ(exporter.size(), 0u);
+	EXPECT_NE(exporter.getTimestamps(), timestamps);
+
+	EXPECT_EQ(array.length, 2);
+	ASSERT_EQ(array.n_children, 3);
+	EXPECT_EQ(array.children[0]->buffers[1], timestamps);
+	EXPECT_EQ(static_cast<const int64_t *>(array.children[0]->buffers[1])[1], 2'000);
+
+	const ArrowArray *raw = array.children[2];
+	EXPECT_EQ(raw->null_count, 1);
+	EXPECT_EQ(static_cast<const uint8_t *>(raw->buffers[0])[0], 0b01u);
+	EXPECT_EQ(static_cast<const int16_t *>(raw->buffers[1])[0], 0x0100);
+
+	const ArrowArray *dictionary = array.children[1]->dictionary;
+	ASSERT_NE(dictionary, nullptr);
+	EXPECT_EQ(dictionary->length, 2);
+	EXPECT_EQ(static_cast<const uint16_t *>(dictionary->buffers[1])[1], 6u);
+
+	// A consumer may move a child out of the batch and release it independently.
+	ArrowArray moved = *array.children[0];
+	array.children[0]->release = nullptr;
+	array.release(&array);
+	EXPECT_EQ(array.release, nullptr);
+	EXPECT_EQ(static_cast<const int64_t *>(moved.buffers[1])[0], 1'000);
+	moved.release(&moved);
+
+	// The next batch starts with an empty dictionary.
+	exporter.append(makeSample(6u, 3'000, 0u));
+	EXPECT_EQ(exporter.getDictionarySize(), 1u);
+	EXPECT_EQ(exporter.getIndices()[0], 0);
+	EXPECT_EQ(exporter.getValidity()[0], 0b1u);
+}
@@ -0,0 +1,324 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Compactor.test.cpp
+ * @brief			: TMP116::Compactor Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Compactor.hpp"
+#include "TMP116_Segment.hpp"
+
+#include "gtest/gtest.h"
+
+#include <dirent.h>
+#include <unistd.h>
+
+using Compactor		= TMP116::Compactor;
+using Query			= TMP116::Segment::Query;
+using Sample		= TMP116::Sample;
+using Segment		= TMP116::Segment;
+using SegmentReader = TMP116::SegmentReader;
+using SegmentWriter = TMP116::SegmentWriter;
+using std::chrono::microseconds;
+
+class TMP116_TestCompactor : public ::testing::Test {
+public:
+	std::string directory{};
+
+	void SetUp() override {
+		char name[] = "/tmp/TMP116_TestCompactor.XXXXXX";
+		ASSERT_NE(mkdtemp(name), nullptr);
+		directory = name;
+	}
+
+	void TearDown() override {
+		for (const auto &path : list(true)) unlink(path.c_str());
+		rmdir(directory.c_str());
+	}
+
+	std::vector<std::string> list(bool all = false) const {
+		std::vector<std::string> paths{};
+		DIR						*handle = opendir(directory.c_str());
+		while (const dirent *entry = readdir(handle)) {
+			const std::string name{entry->d_name};
+			if (name == "." || name == "..") continue;
+			if (all || (name.size() > 4u && name.compare(name.size() - 4u, 4u, ".seg") == 0))
+				paths.push_back(directory + "/" + name);
+		}
+		closedir(handle);
+		std::sort(paths.begin(), paths.end());
+		return paths;
+	}
+
+	/**
+	 * @brief Write a segment of 4 sensors sampled every 10us from a start time, with raw values of the time / 10.
+	 */
+	std::string writeSegment(const std::string &name, int64_t start, size_t count) {
+		const std::string path = directory + "/" + name + ".seg";
+		SegmentWriter	  writer{path, 64u};
+		EXPECT_TRUE(writer.open());
+		for (size_t i = 0u; i < count; i++) {
+			const int64_t time = start + static_cast<int64_t>(i / 4u) * 10;
+			EXPECT_TRUE(writer.append(makeSample(static_cast<TMP116::SensorId>(i % 4u), time)));
+		}
+		EXPECT_TRUE(writer.seal());
+		return path;
+	}
+
+	static Sample makeSample(TMP116::SensorId sensorId, int64_t time) {
+		return Sample{sensorId, microseconds{time}, static_cast<TMP116::Register>(time / 10)};
+	}
+
+	std::vector<Sample> readAll() const {
+		std::vector<Sample> samples{};
+		for (const auto &path : list()) {
+			SegmentReader reader{path};
+			EXPECT_TRUE(reader.open());
+			for (const auto &sample : reader.query(Query{})) samples.push_back(sample);
+		}
+		std::stable_sort(samples.begin(), samples.end(), [](const Sample &a, const Sample &b) {
+			return a.sensorId != b.sensorId ? a.sensorId < b.sensorId : a.timestamp < b.timestamp;
+		});
+		return samples;
+	}
+
+	Compactor::Policy makePolicy(int64_t now) const {
+		Compactor::Policy policy{};
+		policy.bytesPerSecond = 0u;
+		policy.clock		  = [now]() { return microseconds{now}; };
+		return policy;
+	}
+};
+
+TEST_F(TMP116_TestCompactor, mergesSmallSegmentsPreservingSamples) {
+	writeSegment("a", 0, 400u);
+	writeSegment("b", 1000, 400u);
+	writeSegment("c", 2000, 400u);
+	const auto expected = readAll();
+
+	Compactor  compactor{directory, makePolicy(10'000)};
+	const auto pass = compactor.compact();
+
+	EXPECT_EQ(pass.segmentsRewritten, 3u);
+	EXPECT_EQ(pass.segmentsWritten, 1u);
+	ASSERT_EQ(list().size(), 1u);
+
+	const auto samples = readAll();
+	ASSERT_EQ(samples.size(), expected.size());
+	for (size_t i = 0u; i < samples.size(); i++) {
+		EXPECT_EQ(samples[i].sensorId, expected[i].sensorId);
+		EXPECT_EQ(samples[i].timestamp, expected[i].timestamp);
+		EXPECT_EQ(samples[i].raw, expected[i].raw);
+	}
+
+	// A single small segment has nothing to merge with.
+	EXPECT_EQ(compactor.compact().segmentsRewritten, 0u);
+	EXPECT_EQ(compactor.getStatistics().passes, 2u);
+}
+
+TEST_F(TMP116_TestCompactor, leavesUnsealedSegmentsUntouched) {
+	writeSegment("a", 0, 400u);
+	writeSegment("b", 1000, 400u);
+
+	const std::string active = directory + "/c.seg";
+	SegmentWriter	  writer{active, 64u};
+	ASSERT_TRUE(writer.open());
+	for (int64_t i = 0; i < 200; i++) ASSERT_TRUE(writer.append(makeSample(0u, 5000 + i)));
+	ASSERT_TRUE(writer.flush());
+
+	Compactor compactor{directory, makePolicy(10'000)};
+	EXPECT_EQ(compactor.compact().segmentsRewritten, 2u);
+
+	// The writer appends and seals undisturbed.
+	for (int64_t i = 200; i < 300; i++) ASSERT_TRUE(writer.append(makeSample(0u, 5000 + i)));
+	ASSERT_TRUE(writer.seal());
+
+	SegmentReader reader{active};
+	ASSERT_TRUE(reader.open());
+	EXPECT_EQ(reader.getSamples(), 300u);
+}
+
+TEST_F(TMP116_TestCompactor, downsamplesOldSamplesToMeans) {
+	writeSegment("a", 0, 4u * 200u); // 0us to 1990us.
+
+	auto policy			   = makePolicy(2'000);
+	policy.downsampleAfter = microseconds{1'000}; // Samples before 1000us are downsampled.
+	policy.rollupInterval  = microseconds{100};
+	policy.smallSegment	   = 0u;
+	Compactor compactor{directory, policy};
+
+	const auto pass = compactor.compact();
+	EXPECT_EQ(pass.samplesDownsampled, 4u * 100u);
+	EXPECT_EQ(pass.segmentsWritten, 2u);
+
+	size_t downsampled = 0u, raw = 0u;
+	for (const auto &path : list()) {
+		SegmentReader reader{path};
+		ASSERT_TRUE(reader.open());
+		const auto samples = reader.query(Query{});
+		if (reader.getFlags() & Segment::DOWNSAMPLED) {
+			downsampled += samples.size();
+			for (const auto &sample : samples) {
+				EXPECT_LT(sample.timestamp, microseconds{1'000});
+				EXPECT_EQ(sample.timestamp.count() % 100, 0);
+				// Each interval holds raw values from its start / 10 to 9 more, averaging 4.5 more, rounded up.
+				EXPECT_EQ(sample.raw, sample.timestamp.count() / 10 + 5);
+			}
+		} else raw += samples.size();
+	}
+	EXPECT_EQ(downsampled, 4u * 10u);
+	EXPECT_EQ(raw, 4u * 100u);
+
+	// Already downsampled, so nothing remains to do.
+	EXPECT_EQ(compactor.compact().segmentsRewritten, 0u);
+}
+
+TEST_F(TMP116_TestCompactor, mergesDownsampledSegmentsWithNewMeansInOrder) {
+	writeSegment("a", 0, 4u * 300u); // 0us to 2990us.
+
+	int64_t now			   = 2'000;
+	auto	policy		   = makePolicy(0);
+	policy.clock		   = [&now]() { return microseconds{now}; };
+	policy.downsampleAfter = microseconds{1'000};
+	policy.rollupInterval  = microseconds{100};
+	policy.smallSegment	   = 1u << 20u;
+	Compactor compactor{directory, policy};
+
+	EXPECT_EQ(compactor.compact().samplesDownsampled, 4u * 100u); // 0us to 990us.
+	now = 3'000;
+	EXPECT_EQ(compactor.compact().samplesDownsampled, 4u * 100u); // 1000us to 1990us.
+
+	std::vector<Sample> downsampled{};
+	for (const auto &path : list()) {
+		SegmentReader reader{path};
+		ASSERT_TRUE(reader.open());
+		if (!(reader.getFlags() & Segment::DOWNSAMPLED)) continue;
+		for (const auto &sample : reader.query(Query{})) downsampled.push_back(sample);
+	}
+
+	// Merged into one segment, in order of time and then sensor.
+	ASSERT_EQ(downsampled.size(), 4u * 20u);
+	for (size_t i = 0u; i < downsampled.size(); i++) {
+		EXPECT_EQ(downsampled[i].timestamp, microseconds{static_cast<int64_t>(i / 4u) * 100});
+		EXPECT_EQ(downsampled[i].sensorId, i % 4u);
+		EXPECT_EQ(downsampled[i].raw, downsampled[i].timestamp.count() / 10 + 5);
+	}
+}
+
+TEST_F(TMP116_TestCompactor, foldsLateSamplesIntoDownsampledMeans) {
+	writeSegment("a", 0, 4u * 100u); // 0us to 990us.
+
+	auto policy			   = makePolicy(2'000);
+	policy.downsampleAfter = microseconds{1'000};
+	policy.rollupInterval  = microseconds{100};
+	policy.smallSegment	   = 1u << 20u;
+	Compactor compactor{directory, policy};
+	EXPECT_EQ(compactor.compact().samplesDownsampled, 4u * 100u);
+
+	// 10 samples of sensor 0 arriving late for the interval at 0us, with a raw value of 100.
+	{
+		SegmentWriter writer{directory + "/late.seg", 64u};
+		ASSERT_TRUE(writer.open());
+		for (int64_t time = 0; time < 100; time += 10)
+			EXPECT_TRUE(writer.append(Sample{0u, microseconds{time}, TMP116::Register{100u}}));
+		ASSERT_TRUE(writer.seal());
+	}
+	EXPECT_EQ(compactor.compact().samplesDownsampled, 10u);
+
+	const auto paths = list();
+	ASSERT_EQ(paths.size(), 1u);
+	SegmentReader reader{paths[0]};
+	ASSERT_TRUE(reader.open());
+	const auto samples = reader.query(Query{});
+	ASSERT_EQ(samples.size(), 4u * 10u); // One mean per interval and sensor, without a second for the late samples.
+
+	// The mean of 0 to 9 is 4.5, rounded to 5, of 10 samples, then with 10 samples of 100, giving 52.5 rounded to 53.
+	EXPECT_EQ(samples[0].sensorId, 0u);
+	EXPECT_EQ(samples[0].timestamp, microseconds{0});
+	EXPECT_EQ(samples[0].raw, 53u);
+	EXPECT_EQ(samples[1].raw, 5u);
+
+	std::vector<Segment::Record> records{};
+	ASSERT_TRUE(reader.readRecords(0u, records));
+	EXPECT_EQ(records[0].count, 20u);
+	EXPECT_EQ(records[1].count, 10u);
+}
+
+TEST_F(TMP116_TestCompactor, removesTemporaryOutputsLeftByEarlierPasses) {
+	writeSegment("a", 0, 400u);
+	const std::string temporary = directory + "/compact-1-0.seg.tmp";
+	writeSegment("compact-1-0", 0, 4u);
+	ASSERT_EQ(std::rename((directory + "/compact-1-0.seg").c_str(), temporary.c_str()), 0);
+
+	Compactor compactor{directory, makePolicy(10'000)};
+	compactor.compact();
+	EXPECT_NE(access(temporary.c_str(), F_OK), 0);
+	EXPECT_EQ(readAll().size(), 400u);
+}
+
+TEST_F(TMP116_TestCompactor, deletesExpiredSamples) {
+	writeSegment("a", 0, 400u);		// 0us to 990us, all expired.
+	writeSegment("b", 1000, 4000u); // 1000us to 10990us, partly expired.
+
+	auto policy			= makePolicy(11'000);
+	policy.retention	= microseconds{5'000}; // Samples before 6000us are deleted.
+	policy.smallSegment = 0u;
+	Compactor compactor{directory, policy};
+
+	const auto pass = compactor.compact();
+	EXPECT_EQ(pass.segmentsDeleted, 1u);
+	EXPECT_EQ(pass.samplesExpired, 4u * 500u);
+
+	const auto samples = readAll();
+	EXPECT_EQ(samples.size(), 4u * 500u);
+	for (const auto &sample : samples) EXPECT_GE(sample.timestamp, microseconds{6'000});
+}
+
+TEST_F(TMP116_TestCompactor, openReadersRemainValid) {
+	const auto path = writeSegment("a", 0, 400u);
+	writeSegment("b", 1000, 400u);
+
+	SegmentReader reader{path};
+	ASSERT_TRUE(reader.open());
+
+	Compactor compactor{directory, makePolicy(10'000)};
+	EXPECT_EQ(compactor.compact().segmentsRewritten, 2u);
+
+	EXPECT_EQ(reader.query(Query{}).size(), 400u);
+}
+
+TEST_F(TMP116_TestCompactor, limitsIoRate) {
+	writeSegment("a", 0, 2000u);
+	writeSegment("b", 10000, 2000u);
+
+	auto policy			  = makePolicy(100'000);
+	policy.bytesPerSecond = 1u << 20u;
+	Compactor compactor{directory, policy};
+
+	const auto start = std::chrono::steady_clock::now();
+	const auto pass	 = compactor.compact();
+	const auto taken = std::chrono::steady_clock::now() - start;
+
+	EXPECT_GT(pass.bytesRead, 50'000u);
+	EXPECT_GE(taken, std::chrono::microseconds{(pass.bytesRead * 1'000'000u / (1u << 20u)) * 9u / 10u});
+}
+
+TEST_F(TMP116_TestCompactor, stopsBackgroundThreadDuringThrottledRewrite) {
+	writeSegment("a", 0, 4000u);
+	writeSegment("b", 100000, 4000u);
+
+	auto policy			  = makePolicy(1'000'000);
+	policy.bytesPerSecond = 1024u; // Far too slow to finish.
+	Compactor compactor{directory, policy};
+	ASSERT_TRUE(compactor.start());
+	EXPECT_FALSE(compactor.start());
+
+	std::this_thread::sleep_for(std::chrono::milliseconds{20});
+	compactor.stop();
+	EXPECT_FALSE(compactor.isRunning());
+
+	// Abandoned, leaving the inputs and no outputs.
+	EXPECT_EQ(list().size(), 2u);
+	EXPECT_EQ(list(true).size(), 2u);
+}
@@ -100,3 +100,37 @@ TEST(TMP116_TestConfig, configImplicitTypeCastsToRegister) {
 	registerValue = config;
 	EXPECT_EQ(registerValue, Register{0x0554u});
 }
+
+TEST(TMP116_TestConfig, getConversionPeriodReturnsCycleTimeOrActiveConversionTime) {
+	using std::chrono::microseconds;
+
+	Config config{};
+	EXPECT_EQ(config.getConversionPeriod(), microseconds{1'000'000});
+
+	config.conversionCycleTime = Config::ConversionCycleTime::CONV_15_5MS;
+	config.averages			   = Config::Averages::AVG_1;
+	EXPECT_EQ(config.getConversionPeriod(), microseconds{15'500});
+
+	config.averages = Config::Averages::AVG_8;
+	EXPECT_EQ(config.getConversionPeriod(), microseconds{125'000});
+
+	config.conversionCycleTime = Config::ConversionCycleTime::CONV_250MS;
+	config.averages			   = Config::Averages::AVG_32;
+	EXPECT_EQ(config.getConversionPeriod(), microseconds{500'000});
+
+	config.conversionCycleTime = Config::ConversionCycleTime::CONV_16000MS;
+	config.averages			   = Config::Averages::AVG_64;
+	EXPECT_EQ(config.getConversionPeriod(), microseconds{16'000'000});
+}
+
+TEST(TMP116_TestConfig, getAverageCountDecodesAverages) {
+	Config config{};
+	EXPECT_EQ(config.getAverageCount(), 8u);
+
+	config.averages = Config::Averages::AVG_1;
+	EXPECT_EQ(config.getAverageCount(), 1u);
+	config.averages = Config::Averages::AVG_32;
+	EXPECT_EQ(config.getAverageCount(), 32u);
+	config.averages = Config::Averages::AVG_64;
+	EXPECT_EQ(config.getAverageCount(), 64u);
+}
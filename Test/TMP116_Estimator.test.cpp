@@ -0,0 +1,134 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Estimator.test.cpp
+ * @brief			: TMP116::Estimator Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Estimator.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+
+using Config	= TMP116::Config;
+using Estimator = TMP116::Estimator;
+using Sample	= TMP116::Sample;
+using std::chrono::microseconds;
+using std::chrono::seconds;
+
+static Sample makeSample(TMP116::SensorId sensorId, float celsius) {
+	const auto raw = static_cast<int16_t>(std::lround(celsius / TMP116::TEMPERATURE_RESOLUTION));
+	return Sample{sensorId, microseconds{0}, static_cast<TMP116::Register>(raw)};
+}
+
+// Measurement variance of a sensor averaging the given conversions, by the default noise of 6 LSBs.
+static float measurementVariance(float averages) {
+	const float noise = 6.0f * TMP116::TEMPERATURE_RESOLUTION;
+	return noise * noise / averages + TMP116::TEMPERATURE_RESOLUTION * TMP116::TEMPERATURE_RESOLUTION / 12.0f;
+}
+
+TEST(TMP116_TestEstimator, firstSampleIsTakenWithItsMeasurementVariance) {
+	Estimator::Options options{};
+	options.drift = 0.0f;
+	Estimator estimator{2u, options};
+
+	Config averaged{};
+	averaged.averages = Config::Averages::AVG_64;
+	Config single{};
+	single.averages = Config::Averages::AVG_1;
+	ASSERT_TRUE(estimator.configure(0u, single));
+	ASSERT_TRUE(estimator.configure(1u, averaged));
+
+	estimator.observe(makeSample(0u, 25.0f));
+	estimator.observe(makeSample(1u, 25.0f));
+	estimator.tick();
+
+	for (TMP116::SensorId sensor = 0u; sensor < 2u; sensor++) {
+		const auto estimate = estimator.getEstimate(sensor);
+		ASSERT_TRUE(estimate.has_value());
+		EXPECT_NEAR(estimate->value, 25.0f, 1e-4f);
+		EXPECT_NEAR(estimate->gain, 1.0f, 1e-5f);
+	}
+	EXPECT_NEAR(estimator.getEstimate(0u)->variance, measurementVariance(1.0f), 1e-7f);
+	EXPECT_NEAR(estimator.getEstimate(1u)->variance, measurementVariance(64.0f), 1e-7f);
+
+	// Without drift, n samples of the same variance average to a variance n times smaller.
+	for (int i = 1; i < 10; i++) {
+		estimator.observe(makeSample(0u, 25.0f));
+		estimator.tick();
+	}
+	EXPECT_NEAR(estimator.getVariances()[0], measurementVariance(1.0f) / 10.0f, 1e-7f);
+	EXPECT_NEAR(estimator.getEstimate(0u)->gain, 0.1f, 1e-4f);
+}
+
+TEST(TMP116_TestEstimator, predictsOverSampleIntervalWithoutSamples) {
+	Estimator::Options options{};
+	options.drift = 0.01f;
+	Estimator estimator{2u, options};
+
+	Config config{};
+	config.conversionCycleTime = Config::ConversionCycleTime::CONV_4000MS;
+	estimator.configure(0u, config);
+	estimator.configure(1u, config, seconds{10});
+
+	estimator.observe(makeSample(0u, 30.0f));
+	estimator.observe(makeSample(1u, 30.0f));
+	estimator.tick();
+	const float settled[] = {estimator.getVariances()[0], estimator.getVariances()[1]};
+
+	// Each tick without a sample keeps the value and adds the drift of one interval to the variance.
+	estimator.tick();
+	estimator.tick();
+	EXPECT_NEAR(estimator.getValues()[0], 30.0f, 1e-4f);
+	EXPECT_NEAR(estimator.getVariances()[0] - settled[0], 2.0f * 0.01f * 4.0f, 1e-5f);
+	EXPECT_NEAR(estimator.getVariances()[1] - settled[1], 2.0f * 0.01f * 10.0f, 1e-5f);
+	EXPECT_EQ(estimator.getEstimate(0u)->gain, 0.0f);
+}
+
+TEST(TMP116_TestEstimator, tracksNoisyTemperatureWithinItsVariance) {
+	Estimator::Options options{};
+	options.drift = 1e-7f;
+	Estimator						estimator{64u, options};
+	std::mt19937					random{116u};
+	std::normal_distribution<float> noise{0.0f, 6.0f * TMP116::TEMPERATURE_RESOLUTION / std::sqrt(8.0f)};
+
+	// Each sensor at its own constant temperature, sampled at the default AVG_8.
+	for (int i = 0; i < 200; i++) {
+		for (TMP116::SensorId sensor = 0u; sensor < 64u; sensor++)
+			estimator.observe(makeSample(sensor, 20.0f + 0.25f * static_cast<float>(sensor) + noise(random)));
+		estimator.tick();
+	}
+
+	size_t within = 0u;
+	for (TMP116::SensorId sensor = 0u; sensor < 64u; sensor++) {
+		const auto	estimate = estimator.getEstimate(sensor);
+		const float error	 = estimate->value - (20.0f + 0.25f * static_cast<float>(sensor));
+		EXPECT_LT(estimate->variance, measurementVariance(8.0f) / 20.0f);
+		if (std::fabs(error) < 2.0f * std::sqrt(estimate->variance)) within++;
+	}
+	EXPECT_GE(within, 55u); // About 95% within two standard deviations.
+}
+
+TEST(TMP116_TestEstimator, resetAndRejectsOutOfRange) {
+	Estimator estimator{1u};
+	EXPECT_FALSE(estimator.configure(1u, Config{}));
+	EXPECT_FALSE(estimator.observe(makeSample(1u, 20.0f)));
+	EXPECT_FALSE(estimator.reset(1u));
+	EXPECT_FALSE(estimator.getEstimate(1u).has_value());
+	EXPECT_EQ(estimator.size(), 1u);
+
+	EXPECT_EQ(estimator.getEstimate(0u)->variance, Estimator::Options{}.variance);
+	estimator.observe(makeSample(0u, 20.0f));
+	estimator.tick();
+	EXPECT_LT(estimator.getEstimate(0u)->variance, 1e-3f);
+
+	estimator.observe(makeSample(0u, 21.0f));
+	EXPECT_TRUE(estimator.reset(0u));
+	estimator.tick(); // The sample staged before the reset is discarded.
+	EXPECT_GE(estimator.getEstimate(0u)->variance, Estimator::Options{}.variance);
+	EXPECT_EQ(estimator.getEstimate(0u)->gain, 0.0f);
+	EXPECT_EQ(estimator.getEstimate(0u)->value, 0.0f);
+}
@@ -0,0 +1,109 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_FilterBank.test.cpp
+ * @brief			: TMP116::FilterBank Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_FilterBank.hpp"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+using Biquad	 = TMP116::FilterBank::Biquad;
+using FilterBank = TMP116::FilterBank;
+using Register	 = TMP116::Register;
+
+/**
+ * @brief Random frames of raw samples about 25C, including negative temperatures on odd channels.
+ */
+static std::vector<Register> makeFrames(size_t channels, size_t frames) {
+	std::mt19937		  random{1u};
+	std::vector<Register> raw(channels * frames);
+	for (size_t i = 0u; i < raw.size(); i++) {
+		const int32_t base = (i % channels) % 2u ? -1280 : 3200;
+		raw[i]			   = static_cast<Register>(static_cast<int16_t>(base + static_cast<int32_t>(random() % 201u) - 100));
+	}
+	return raw;
+}
+
+static float toCelsius(Register raw) { return static_cast<int16_t>(raw) * TMP116::TEMPERATURE_RESOLUTION; }
+
+TEST(TMP116_TestFilterBank, firMatchesScalarConvolutionPerChannel) {
+	const size_t			 channels = 37u, frames = 50u; // Channels not a multiple of any SIMD width.
+	const std::vector<float> taps{0.4f, 0.3f, 0.2f, 0.1f};
+	const auto				 raw = makeFrames(channels, frames);
+
+	FilterBank		   bank{channels, taps};
+	std::vector<float> output(channels * frames);
+	bank.process(raw.data(), frames, output.data());
+	EXPECT_FALSE(bank.isRecursive());
+
+	for (size_t frame = 0u; frame < frames; frame++) {
+		for (size_t channel = 0u; channel < channels; channel++) {
+			float expected = 0.0f;
+			for (size_t tap = 0u; tap < taps.size() && tap <= frame; tap++)
+				expected += taps[tap] * toCelsius(raw[(frame - tap) * channels + channel]);
+			EXPECT_NEAR(output[frame * channels + channel], expected, 1e-4f);
+		}
+	}
+}
+
+TEST(TMP116_TestFilterBank, biquadCascadeMatchesScalarDifferenceEquation) {
+	const size_t			  channels = 37u, frames = 200u;
+	const std::vector<Biquad> sections{Biquad::lowPass(0.1f, 1.0f), Biquad::lowPass(0.2f, 1.0f, 1.0f)};
+	const auto				  raw = makeFrames(channels, frames);
+
+	FilterBank		   bank{channels, sections};
+	std::vector<float> output(channels * frames);
+	bank.process(raw.data(), frames, output.data());
+	EXPECT_TRUE(bank.isRecursive());
+
+	for (size_t channel = 0u; channel < channels; channel++) {
+		std::vector<float> signal(frames);
+		for (size_t frame = 0u; frame < frames; frame++) signal[frame] = toCelsius(raw[frame * channels + channel]);
+
+		// Direct form I, independently of the transposed form of the bank.
+		for (const auto &s : sections) {
+			float x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f;
+			for (auto &value : signal) {
+				const float y = s.b0 * value + s.b1 * x1 + s.b2 * x2 - s.a1 * y1 - s.a2 * y2;
+				x2 = x1, x1 = value, y2 = y1, y1 = y;
+				value = y;
+			}
+		}
+		for (size_t frame = 0u; frame < frames; frame++)
+			EXPECT_NEAR(output[frame * channels + channel], signal[frame], 1e-3f);
+	}
+}
+
+TEST(TMP116_TestFilterBank, lowPassHasUnityGainAtDc) {
+	FilterBank bank{1u, std::vector<Biquad>{Biquad::lowPass(1.0f, 64.0f)}};
+	const Register raw = 3200u; // 25C.
+	float		   output = 0.0f;
+	for (int i = 0; i < 1000; i++) bank.process(&raw, &output);
+	EXPECT_NEAR(output, 25.0f, 1e-3f);
+}
+
+TEST(TMP116_TestFilterBank, primeStartsInSteadyState) {
+	const std::vector<Register> raw{3200u, static_cast<Register>(-1280)}; // 25C and -10C.
+	std::vector<float>			output(2u);
+
+	FilterBank iir{2u, std::vector<Biquad>{Biquad::lowPass(0.5f, 8.0f), Biquad::lowPass(1.0f, 8.0f)}};
+	iir.prime(raw.data());
+	iir.process(raw.data(), output.data());
+	EXPECT_NEAR(output[0], 25.0f, 1e-3f);
+	EXPECT_NEAR(output[1], -10.0f, 1e-3f);
+
+	FilterBank fir{2u, std::vector<float>(8u, 0.125f)};
+	fir.prime(raw.data());
+	fir.process(raw.data(), output.data());
+	EXPECT_NEAR(output[0], 25.0f, 1e-4f);
+	EXPECT_NEAR(output[1], -10.0f, 1e-4f);
+
+	fir.reset();
+	fir.process(raw.data(), output.data());
+	EXPECT_NEAR(output[0], 25.0f / 8.0f, 1e-4f);
+}
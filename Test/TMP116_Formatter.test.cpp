@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Formatter.test.cpp
+ * @brief			: TMP116::Formatter Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Formatter.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <string>
+
+using Formatter = TMP116::Formatter;
+using Register	= TMP116::Register;
+
+static std::string format(Register raw, uint8_t decimals = Formatter::EXACT_DECIMALS) {
+	char		 buffer[Formatter::MAX_LENGTH];
+	const size_t length = Formatter::format(raw, buffer, decimals);
+	return std::string{buffer, length};
+}
+
+TEST(TMP116_TestFormatter, formatIsExactWithSevenDecimals) {
+	EXPECT_EQ(format(0x0000u), "0.0000000");
+	EXPECT_EQ(format(0x0001u), "0.0078125");
+	EXPECT_EQ(format(0x15D2u), "43.6406250");
+	EXPECT_EQ(format(0xFFFFu), "-0.0078125");
+	EXPECT_EQ(format(0xFB00u), "-10.0000000");
+	EXPECT_EQ(format(0x7FFFu), "255.9921875");
+	EXPECT_EQ(format(0x8000u), "-256.0000000");
+}
+
+TEST(TMP116_TestFormatter, formatRoundsHalfAwayFromZero) {
+	EXPECT_EQ(format(0x15D2u, 2u), "43.64");
+	EXPECT_EQ(format(0x15D2u, 0u), "44");
+	EXPECT_EQ(format(0x0001u, 2u), "0.01");
+	EXPECT_EQ(format(0xFFFFu, 2u), "-0.01");
+	EXPECT_EQ(format(0xFFFFu, 1u), "0.0"); // Rounded to zero, so unsigned.
+	EXPECT_EQ(format(0x0040u, 0u), "1");   // 0.5
+	EXPECT_EQ(format(0xFFC0u, 0u), "-1");  // -0.5
+	EXPECT_EQ(format(0x7FFFu, 0u), "256");
+	EXPECT_EQ(format(0x0001u, 9u), "0.0078125");
+}
+
+TEST(TMP116_TestFormatter, formatMatchesPrintfForAllRegisterValues) {
+	char expected[32];
+	for (uint32_t raw = 0u; raw <= 0xFFFFu; raw++) {
+		const double temperature = static_cast<int16_t>(raw) * 0.0078125;
+		std::snprintf(expected, sizeof(expected), "%.7f", temperature);
+		ASSERT_EQ(format(static_cast<Register>(raw)), expected);
+	}
+}
+
+TEST(TMP116_TestFormatter, batchFormatStopsAtEndOfBuffer) {
+	const Register raws[] = {0x0C80u, 0xFB00u, 0x0001u};
+
+	char buffer[64];
+	auto result = Formatter::format(raws, 3u, buffer, sizeof(buffer), 1u, ',');
+	EXPECT_EQ(result.values, 3u);
+	EXPECT_EQ(std::string(buffer, result.length), "25.0,-10.0,0.0,");
+
+	result = Formatter::format(raws, 3u, buffer, 10u, 1u, ',');
+	EXPECT_EQ(result.values, 1u);
+	EXPECT_EQ(std::string(buffer, result.length), "25.0,");
+
+	result = Formatter::format(raws, 3u, buffer, 11u, 1u, ',');
+	EXPECT_EQ(result.values, 2u);
+	EXPECT_EQ(result.length, 11u);
+}
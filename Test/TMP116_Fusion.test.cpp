@@ -0,0 +1,161 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Fusion.test.cpp
+ * @brief			: TMP116::Fusion Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Fusion.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using Fusion = TMP116::Fusion;
+using Sample = TMP116::Sample;
+using std::chrono::microseconds;
+
+static Sample makeSample(TMP116::SensorId sensorId, float celsius) {
+	const auto raw = static_cast<int16_t>(std::lround(celsius / TMP116::TEMPERATURE_RESOLUTION));
+	return Sample{sensorId, microseconds{0}, static_cast<TMP116::Register>(raw)};
+}
+
+TEST(TMP116_TestFusion, medianOfThreeOutvotesFaultySensor) {
+	Fusion fusion{3u, {{0u, 1u, 2u}}};
+	fusion.update(makeSample(0u, 20.0f));
+	fusion.update(makeSample(1u, 20.25f));
+	fusion.update(makeSample(2u, 85.0f));
+	fusion.tick();
+
+	const auto result = fusion.getResult(0u);
+	ASSERT_TRUE(result.has_value());
+	EXPECT_FLOAT_EQ(result->value, 20.25f);
+	EXPECT_FLOAT_EQ(result->spread, 65.0f);
+	EXPECT_EQ(result->read, 3u);
+	EXPECT_EQ(result->agreeing, 2u);
+	EXPECT_EQ(result->outliers, 0b100u);
+	EXPECT_FALSE(result->disagreement);
+}
+
+TEST(TMP116_TestFusion, medianOfFourIsTrimmedMean) {
+	Fusion fusion{4u, {{0u, 1u, 2u, 3u}}, 1.0f};
+	const float temperatures[] = {21.0f, -40.0f, 20.0f, 20.5f};
+	for (TMP116::SensorId sensor = 0u; sensor < 4u; sensor++) fusion.update(makeSample(sensor, temperatures[sensor]));
+	fusion.tick();
+
+	auto result = fusion.getResult(0u);
+	EXPECT_FLOAT_EQ(result->value, 20.25f); // Mean of 20.0 and 20.5, trimmed of -40.0 and 21.0.
+	EXPECT_EQ(result->agreeing, 3u);
+	EXPECT_EQ(result->outliers, 0b0010u);
+	EXPECT_FALSE(result->disagreement);
+
+	// Two pairs apart have no majority in agreement.
+	fusion.update(makeSample(0u, 30.0f));
+	fusion.update(makeSample(1u, 30.0f));
+	fusion.tick();
+	result = fusion.getResult(0u);
+	EXPECT_FLOAT_EQ(result->value, 25.25f);
+	EXPECT_EQ(result->agreeing, 0u);
+	EXPECT_EQ(result->outliers, 0b1111u);
+	EXPECT_TRUE(result->disagreement);
+}
+
+TEST(TMP116_TestFusion, membersWithoutReadingsAreExcluded) {
+	Fusion fusion{3u, {{0u, 1u, 2u}, {2u}, {}}};
+	EXPECT_EQ(fusion.getSets(), 3u);
+	EXPECT_EQ(fusion.getSensors(), 3u);
+
+	fusion.tick();
+	for (size_t set = 0u; set < 3u; set++) {
+		const auto result = fusion.getResult(set);
+		EXPECT_TRUE(std::isnan(result->value));
+		EXPECT_TRUE(std::isnan(result->spread));
+		EXPECT_EQ(result->read, 0u);
+		EXPECT_TRUE(result->disagreement);
+	}
+
+	fusion.update(makeSample(0u, 20.0f));
+	fusion.update(makeSample(1u, 21.0f));
+	fusion.tick();
+	auto result = fusion.getResult(0u);
+	EXPECT_FLOAT_EQ(result->value, 20.5f);
+	EXPECT_FLOAT_EQ(result->spread, 1.0f);
+	EXPECT_EQ(result->read, 2u);
+	EXPECT_EQ(result->agreeing, 2u);
+	EXPECT_FALSE(result->disagreement);
+	EXPECT_TRUE(std::isnan(fusion.getValues()[1]));
+
+	fusion.update(makeSample(2u, 35.0f));
+	EXPECT_TRUE(fusion.clear(0u));
+	fusion.tick();
+	result = fusion.getResult(0u);
+	EXPECT_FLOAT_EQ(result->value, 28.0f);
+	EXPECT_EQ(result->agreeing, 0u);
+	EXPECT_EQ(result->outliers, 0b110u);
+	EXPECT_TRUE(result->disagreement);
+	EXPECT_FLOAT_EQ(fusion.getResult(1u)->value, 35.0f);
+	EXPECT_FLOAT_EQ(fusion.getResult(1u)->spread, 0.0f);
+}
+
+TEST(TMP116_TestFusion, rejectsOutOfRange) {
+	Fusion fusion{2u, {{0u, 1u, 7u}}};
+	EXPECT_FALSE(fusion.update(makeSample(2u, 20.0f)));
+	EXPECT_FALSE(fusion.clear(2u));
+	EXPECT_FALSE(fusion.getResult(1u).has_value());
+
+	// Unknown members are never read.
+	fusion.update(makeSample(0u, 20.0f));
+	fusion.update(makeSample(1u, 22.0f));
+	fusion.tick();
+	EXPECT_EQ(fusion.getResult(0u)->read, 2u);
+	EXPECT_FLOAT_EQ(fusion.getResult(0u)->value, 21.0f);
+}
+
+TEST(TMP116_TestFusion, matchesScalarMedianAcrossSets) {
+	constexpr size_t				   sensors = 512u;
+	std::mt19937					   random{116u};
+	std::uniform_int_distribution<int> member(0, sensors - 1);
+	std::uniform_int_distribution<int> size(0, 5);
+	std::uniform_int_distribution<int> raw(-2000, 6000);
+
+	std::vector<Fusion::Set> sets(1000u);
+	for (auto &set : sets) {
+		set.resize(static_cast<size_t>(size(random)));
+		for (auto &sensor : set) sensor = static_cast<TMP116::SensorId>(member(random));
+	}
+
+	Fusion			   fusion{sensors, sets};
+	std::vector<float> readings(sensors);
+	for (TMP116::SensorId sensor = 0u; sensor < sensors; sensor++) {
+		readings[sensor] = static_cast<float>(raw(random)) * TMP116::TEMPERATURE_RESOLUTION;
+		if (sensor % 7u == 0u) readings[sensor] = NAN;
+		else fusion.update(makeSample(sensor, readings[sensor]));
+	}
+	fusion.tick();
+
+	for (size_t set = 0u; set < sets.size(); set++) {
+		std::vector<float> read;
+		for (size_t slot = 0u; slot < std::min(sets[set].size(), Fusion::MEMBERS); slot++)
+			if (!std::isnan(readings[sets[set][slot]])) read.push_back(readings[sets[set][slot]]);
+		std::sort(read.begin(), read.end());
+
+		const auto result = fusion.getResult(set);
+		ASSERT_EQ(result->read, read.size()) << "set " << set;
+		if (read.empty()) {
+			EXPECT_TRUE(std::isnan(result->value));
+			continue;
+		}
+		const size_t n		= read.size();
+		const float	 median = 0.5f * (read[(n - 1u) / 2u] + read[n / 2u]);
+		EXPECT_FLOAT_EQ(result->value, median) << "set " << set;
+		EXPECT_FLOAT_EQ(result->spread, read.back() - read.front()) << "set " << set;
+		const auto agreeing = std::count_if(read.begin(), read.end(), [median](float reading) {
+			return std::fabs(reading - median) <= 0.5f;
+		});
+		EXPECT_EQ(result->agreeing, agreeing) << "set " << set;
+		EXPECT_EQ(result->disagreement, 2 * agreeing <= static_cast<long>(n)) << "set " << set;
+	}
+}
@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_GroupCommit.test.cpp
+ * @brief			: TMP116::GroupCommitWriter Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_GroupCommit.hpp"
+
+#include "gtest/gtest.h"
+
+#include <unistd.h>
+
+using GroupCommitWriter = TMP116::GroupCommitWriter;
+using Query				= TMP116::Segment::Query;
+using Sample			= TMP116::Sample;
+using SegmentReader		= TMP116::SegmentReader;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+class TMP116_TestGroupCommit : public ::testing::Test {
+public:
+	const std::string path = "/tmp/TMP116_TestGroupCommit." + std::to_string(getpid()) + ".seg";
+
+	void TearDown() override { unlink(path.c_str()); }
+
+	static Sample makeSample(uint16_t sensorId, int64_t time) {
+		return Sample{sensorId, microseconds{time}, static_cast<TMP116::Register>(time)};
+	}
+
+	uint64_t readSamples() const {
+		SegmentReader reader{path};
+		EXPECT_TRUE(reader.open());
+		return reader.getSamples();
+	}
+};
+
+TEST_F(TMP116_TestGroupCommit, commitsOnBatchSize) {
+	GroupCommitWriter::Options options{};
+	options.batchSize = 100u;
+	options.maxDelay  = std::chrono::seconds{60};
+	GroupCommitWriter writer{path, options};
+	ASSERT_TRUE(writer.start());
+
+	std::vector<Sample> samples{};
+	for (int64_t i = 0; i < 100; i++) samples.push_back(makeSample(1u, i));
+
+	auto durable = writer.appendDurable(samples.data(), samples.size());
+	ASSERT_EQ(durable.wait_for(std::chrono::seconds{5}), std::future_status::ready);
+	EXPECT_TRUE(durable.get());
+	EXPECT_EQ(writer.getStatistics().commits, 1u);
+	EXPECT_EQ(writer.getStatistics().largest, 100u);
+	EXPECT_EQ(readSamples(), 100u); // Durable, so readable while still open.
+
+	writer.stop();
+	EXPECT_EQ(readSamples(), 100u);
+}
+
+TEST_F(TMP116_TestGroupCommit, commitsOnMaxDelay) {
+	GroupCommitWriter::Options options{};
+	options.batchSize = 1000u;
+	options.maxDelay  = milliseconds{20};
+	GroupCommitWriter writer{path, options};
+	ASSERT_TRUE(writer.start());
+
+	const Sample sample	 = makeSample(1u, 0);
+	const auto	 start	 = std::chrono::steady_clock::now();
+	auto		 durable = writer.appendDurable(&sample, 1u);
+	ASSERT_EQ(durable.wait_for(std::chrono::seconds{5}), std::future_status::ready);
+	EXPECT_TRUE(durable.get());
+	EXPECT_GE(std::chrono::steady_clock::now() - start, milliseconds{20});
+
+	const auto latency = writer.getCommitLatency();
+	EXPECT_EQ(latency.getCount(), 1u);
+	EXPECT_GE(latency.getMax(), milliseconds{20});
+}
+
+TEST_F(TMP116_TestGroupCommit, groupsSamplesOfManyProducers) {
+	GroupCommitWriter::Options options{};
+	options.batchSize = 256u;
+	options.maxDelay  = milliseconds{5};
+	GroupCommitWriter writer{path, options};
+	ASSERT_TRUE(writer.start());
+
+	std::vector<std::thread> producers{};
+	for (uint16_t producer = 0u; producer < 4u; producer++) {
+		producers.emplace_back([&writer, producer]() {
+			for (int64_t i = 0; i < 1000; i++) {
+				const Sample sample = makeSample(producer, i);
+				while (!writer.append(sample)) std::this_thread::yield();
+			}
+		});
+	}
+	for (auto &producer : producers) producer.join();
+
+	EXPECT_TRUE(writer.flush());
+	const auto statistics = writer.getStatistics();
+	EXPECT_EQ(statistics.samples, 4000u);
+	EXPECT_LT(statistics.commits, 4000u); // Syncs are shared between samples.
+	writer.stop();
+
+	SegmentReader reader{path};
+	ASSERT_TRUE(reader.open());
+	ASSERT_TRUE(reader.isSealed());
+	std::vector<int64_t> next(4u, 0);
+	for (const auto &sample : reader.query(Query{})) {
+		EXPECT_EQ(sample.timestamp.count(), next[sample.sensorId]); // Each producer in order.
+		next[sample.sensorId]++;
+	}
+	for (const auto count : next) EXPECT_EQ(count, 1000);
+}
+
+TEST_F(TMP116_TestGroupCommit, refusesWhenFullOrStopped) {
+	GroupCommitWriter::Options options{};
+	options.batchSize = 10u;
+	options.capacity  = 10u;
+	GroupCommitWriter writer{path, options};
+
+	const Sample sample = makeSample(1u, 0);
+	EXPECT_FALSE(writer.append(sample));
+	EXPECT_FALSE(writer.appendDurable(&sample, 1u).get());
+
+	ASSERT_TRUE(writer.start());
+	std::vector<Sample> samples(11u, sample);
+	EXPECT_FALSE(writer.append(samples.data(), samples.size()));
+	EXPECT_EQ(writer.getStatistics().refused, 13u);
+
+	EXPECT_TRUE(writer.append(samples.data(), 5u));
+	EXPECT_TRUE(writer.flush());
+	EXPECT_EQ(writer.getStatistics().samples, 5u);
+}
+
+TEST_F(TMP116_TestGroupCommit, refusesRestartKeepingDurableSamples) {
+	GroupCommitWriter writer{path, GroupCommitWriter::Options{}};
+	ASSERT_TRUE(writer.start());
+
+	std::vector<Sample> samples{};
+	for (int64_t i = 0; i < 100; i++) samples.push_back(makeSample(1u, i));
+	ASSERT_TRUE(writer.append(samples.data(), samples.size()));
+	ASSERT_TRUE(writer.flush());
+	writer.stop();
+
+	EXPECT_FALSE(writer.start()); // Would truncate the segment.
+	EXPECT_FALSE(writer.isRunning());
+	EXPECT_FALSE(writer.append(samples.data(), samples.size()));
+
+	SegmentReader reader{path};
+	ASSERT_TRUE(reader.open());
+	EXPECT_TRUE(reader.isSealed());
+	const auto read = reader.query(Query{});
+	ASSERT_EQ(read.size(), samples.size());
+	for (size_t i = 0u; i < read.size(); i++) EXPECT_EQ(read[i].timestamp, samples[i].timestamp);
+}
@@ -0,0 +1,112 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_HealthMonitor.test.cpp
+ * @brief			: TMP116::HealthMonitor Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_HealthMonitor.hpp"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+using Config		= TMP116::Config;
+using HealthMonitor = TMP116::HealthMonitor;
+using Sample		= TMP116::Sample;
+using Status		= TMP116::HealthMonitor::Status;
+using std::chrono::microseconds;
+
+class TMP116_TestHealthMonitor : public ::testing::Test {
+public:
+	HealthMonitor monitor{4u};
+	std::mt19937  random{1u};
+
+	// A sensor at 25C with the noise of single conversions.
+	TMP116::Register noisy() { return static_cast<TMP116::Register>(3200 + static_cast<int32_t>(random() % 13u) - 6); }
+
+	void feed(TMP116::SensorId sensorId, TMP116::Register raw) {
+		ASSERT_TRUE(monitor.observe(Sample{sensorId, microseconds{0}, raw}));
+	}
+};
+
+TEST_F(TMP116_TestHealthMonitor, unknownUntilSamplesCompared) {
+	EXPECT_EQ(monitor.getHealth(0u)->status, Status::UNKNOWN);
+	feed(0u, 3200u);
+	monitor.tick();
+	EXPECT_EQ(monitor.getHealth(0u)->status, Status::HEALTHY);
+	EXPECT_EQ(monitor.getHealth(4u), std::nullopt);
+	EXPECT_FALSE(monitor.observe(Sample{4u, microseconds{0}, 0u}));
+}
+
+TEST_F(TMP116_TestHealthMonitor, detectsStuckSensor) {
+	Config config{};
+	config.averages = Config::Averages::AVG_1;
+	for (TMP116::SensorId sensor = 0u; sensor < 4u; sensor++) monitor.configure(sensor, config);
+
+	for (int i = 0; i < 300; i++) {
+		feed(0u, noisy());
+		feed(1u, 3200u);
+		monitor.tick();
+	}
+
+	EXPECT_EQ(monitor.getHealth(0u)->status, Status::HEALTHY);
+	EXPECT_GT(monitor.getScores()[0], 0.9f);
+	EXPECT_EQ(monitor.getHealth(1u)->status, Status::STUCK);
+	EXPECT_EQ(monitor.getHealth(1u)->run, 299u);
+	EXPECT_EQ(monitor.getScores()[1], 0.0f);
+
+	// A sensor silent between ticks is neither stuck nor changed.
+	EXPECT_EQ(monitor.getHealth(2u)->status, Status::UNKNOWN);
+	EXPECT_EQ(monitor.getScores()[2], 1.0f);
+}
+
+TEST_F(TMP116_TestHealthMonitor, stuckRunLengthensWithAveraging) {
+	Config config{};
+	config.averages = Config::Averages::AVG_64;
+	monitor.configure(0u, config);
+	EXPECT_NEAR(monitor.getHealth(0u)->noiseFloor, 0.75f, 1e-6f);
+
+	for (int i = 0; i < 300; i++) {
+		feed(0u, 3200u);
+		monitor.tick();
+	}
+	EXPECT_EQ(monitor.getHealth(0u)->status, Status::HEALTHY); // 256 * sqrt(64) identical values are plausible.
+	EXPECT_LT(monitor.getScores()[0], 1.0f);
+}
+
+TEST_F(TMP116_TestHealthMonitor, detectsImplausibleSteps) {
+	for (int i = 0; i < 200; i++) {
+		feed(0u, noisy());
+		feed(1u, static_cast<TMP116::Register>(i % 4 == 0 ? 6400u : noisy())); // Jumps of 25C every fourth sample.
+		monitor.tick();
+	}
+
+	EXPECT_EQ(monitor.getHealth(0u)->status, Status::HEALTHY);
+	EXPECT_EQ(monitor.getHealth(0u)->stepRate, 0.0f);
+	EXPECT_EQ(monitor.getHealth(1u)->status, Status::NOISY);
+	EXPECT_GT(monitor.getHealth(1u)->stepRate, 0.3f);
+	EXPECT_EQ(monitor.getScores()[1], 0.0f);
+}
+
+TEST_F(TMP116_TestHealthMonitor, scoresDeviceIdVerificationHistory) {
+	feed(0u, 3200u);
+	monitor.tick();
+
+	EXPECT_TRUE(monitor.verify(0u, TMP116::Register{0x1116u}));
+	EXPECT_TRUE(monitor.verify(0u, std::nullopt)); // Bus failure.
+	monitor.tick();
+	EXPECT_EQ(monitor.getHealth(0u)->status, Status::UNVERIFIED);
+	EXPECT_EQ(monitor.getScores()[0], 0.0f);
+
+	EXPECT_TRUE(monitor.verify(0u, TMP116::Register{0x1116u}));
+	monitor.tick();
+	EXPECT_EQ(monitor.getHealth(0u)->status, Status::HEALTHY);
+	EXPECT_EQ(monitor.getHealth(0u)->failures, 1u);
+	EXPECT_FLOAT_EQ(monitor.getScores()[0], 7.0f / 8.0f);
+
+	EXPECT_TRUE(monitor.verify(0u, TMP116::Register{0x2117u})); // Another device answering at the address.
+	EXPECT_EQ(monitor.getHealth(0u)->failures, 2u);
+	EXPECT_FALSE(monitor.verify(4u, TMP116::Register{0x1116u}));
+}
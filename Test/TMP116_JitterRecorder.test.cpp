@@ -0,0 +1,54 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_JitterRecorder.test.cpp
+ * @brief			: TMP116::JitterRecorder Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_JitterRecorder.hpp"
+
+#include "gtest/gtest.h"
+
+using JitterRecorder = TMP116::JitterRecorder;
+using std::chrono::microseconds;
+
+TEST(TMP116_TestJitterRecorder, recordsLatenessIntoLogarithmicBuckets) {
+	JitterRecorder jitter{};
+	jitter.record(microseconds{100}, microseconds{90});	 // Early
+	jitter.record(microseconds{100}, microseconds{101}); // 1us
+	jitter.record(microseconds{100}, microseconds{103}); // 3us
+	jitter.record(microseconds{100}, microseconds{200}); // 100us
+
+	EXPECT_EQ(jitter.getCount(), 4u);
+	EXPECT_EQ(jitter.getBucket(0u), 1u);
+	EXPECT_EQ(jitter.getBucket(1u), 1u);
+	EXPECT_EQ(jitter.getBucket(2u), 1u);
+	EXPECT_EQ(jitter.getBucket(7u), 1u);
+
+	EXPECT_EQ(jitter.getMin(), microseconds{-10});
+	EXPECT_EQ(jitter.getMax(), microseconds{100});
+	EXPECT_EQ(jitter.getMean(), microseconds{(-10 + 1 + 3 + 100) / 4});
+}
+
+TEST(TMP116_TestJitterRecorder, getPercentileReturnsBucketUpperBound) {
+	JitterRecorder jitter{};
+	EXPECT_EQ(jitter.getPercentile(0.5f), microseconds{0});
+
+	for (int i = 0; i < 99; i++) jitter.record(microseconds{0}, microseconds{3});
+	jitter.record(microseconds{0}, microseconds{1'000});
+
+	EXPECT_EQ(jitter.getPercentile(0.5f), microseconds{4});
+	EXPECT_EQ(jitter.getPercentile(0.99f), microseconds{4});
+	EXPECT_EQ(jitter.getPercentile(1.0f), microseconds{1'024});
+}
+
+TEST(TMP116_TestJitterRecorder, resetClearsAllReads) {
+	JitterRecorder jitter{};
+	jitter.record(microseconds{0}, microseconds{5});
+	jitter.reset();
+
+	EXPECT_EQ(jitter.getCount(), 0u);
+	EXPECT_EQ(jitter.getBucket(3u), 0u);
+	EXPECT_EQ(jitter.getMean(), microseconds{0});
+}
@@ -0,0 +1,90 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_LatencyTracer.test.cpp
+ * @brief			: TMP116::LatencyTracer and TMP116::Trace Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_LatencyTracer.hpp"
+
+#include "gtest/gtest.h"
+
+using Hop			= TMP116::Trace::Hop;
+using LatencyTracer = TMP116::LatencyTracer;
+using Sample		= TMP116::Sample;
+using std::chrono::microseconds;
+using std::chrono::seconds;
+
+TEST(TMP116_TestTrace, samplesStartUnstamped) {
+	const Sample sample{1u, microseconds{1'000}, 0x0C80u};
+	for (size_t hop = 0u; hop < TMP116::Trace::HOPS; hop++)
+		EXPECT_EQ(sample.getStamp(static_cast<Hop>(hop)), std::nullopt);
+}
+
+TEST(TMP116_TestTrace, stampsAreRelativeToTimestamp) {
+	Sample sample{1u, seconds{1'000'000}, 0x0C80u}; // Far from the epoch, as on a monotonic clock.
+	sample.stamp(Hop::CONVERSION, seconds{1'000'000} - microseconds{40});
+	sample.stamp(Hop::READ, seconds{1'000'000} + microseconds{120});
+
+	EXPECT_EQ(sample.getStamp(Hop::CONVERSION), seconds{1'000'000} - microseconds{40});
+	EXPECT_EQ(sample.getStamp(Hop::READ), seconds{1'000'000} + microseconds{120});
+	EXPECT_EQ(sample.getStamp(Hop::ENQUEUE), std::nullopt);
+
+	// Offsets beyond the range of a stamp saturate rather than wrap.
+	sample.stamp(Hop::RECEIPT, seconds{1'000'000} + seconds{10'000});
+	EXPECT_EQ(sample.getStamp(Hop::RECEIPT), seconds{1'000'000} + microseconds{INT32_MAX});
+}
+
+TEST(TMP116_TestLatencyTracer, recordsTimeBeforeEachHop) {
+	LatencyTracer tracer{};
+
+	for (int64_t i = 0; i < 100; i++) {
+		Sample sample{1u, microseconds{1'000'000 * i + 100}, 0u};
+		sample.stamp(Hop::CONVERSION, microseconds{1'000'000 * i});		  // Waited 100us to be read.
+		sample.stamp(Hop::READ, sample.timestamp + microseconds{200});	  // Read in 200us.
+		sample.stamp(Hop::ENQUEUE, sample.timestamp + microseconds{210}); // Queued 10us later.
+		sample.stamp(Hop::STAGE_0, sample.timestamp + microseconds{5'210});
+		tracer.receive(sample, sample.timestamp + microseconds{5'300});
+	}
+
+	EXPECT_EQ(tracer.getCount(), 100u);
+	EXPECT_EQ(tracer.getHop(Hop::CONVERSION).getMean(), microseconds{100});
+	EXPECT_EQ(tracer.getHop(Hop::READ).getMean(), microseconds{200});
+	EXPECT_EQ(tracer.getHop(Hop::ENQUEUE).getMean(), microseconds{10});
+	EXPECT_EQ(tracer.getHop(Hop::STAGE_0).getMean(), microseconds{5'000});
+	EXPECT_EQ(tracer.getHop(Hop::STAGE_1).getCount(), 0u);
+	EXPECT_EQ(tracer.getHop(Hop::RECEIPT).getMean(), microseconds{90});
+	EXPECT_EQ(tracer.getAge().getMean(), microseconds{5'400});
+	EXPECT_EQ(tracer.getAge().getMax(), microseconds{5'400});
+}
+
+TEST(TMP116_TestLatencyTracer, attributesSkippedHopsToTheNext) {
+	LatencyTracer tracer{};
+	Sample		  sample{1u, microseconds{1'000}, 0u}; // Neither converted nor read stamps, as if synthesised.
+	sample.stamp(Hop::ENQUEUE, microseconds{1'050});
+	tracer.receive(sample, microseconds{1'300});
+
+	EXPECT_EQ(tracer.getHop(Hop::CONVERSION).getCount(), 0u);
+	EXPECT_EQ(tracer.getHop(Hop::READ).getCount(), 0u);
+	EXPECT_EQ(tracer.getHop(Hop::ENQUEUE).getMean(), microseconds{50});
+	EXPECT_EQ(tracer.getHop(Hop::RECEIPT).getMean(), microseconds{250});
+	EXPECT_EQ(tracer.getAge().getMean(), microseconds{300}); // From the timestamp.
+}
+
+TEST(TMP116_TestLatencyTracer, reportsOnlyHopsStamped) {
+	LatencyTracer tracer{};
+	Sample		  sample{1u, microseconds{1'000}, 0u};
+	sample.stamp(Hop::READ, microseconds{1'100});
+	tracer.receive(sample, microseconds{1'500});
+
+	const std::string report = tracer.report();
+	EXPECT_NE(report.find("read"), std::string::npos);
+	EXPECT_NE(report.find("receipt"), std::string::npos);
+	EXPECT_NE(report.find("age"), std::string::npos);
+	EXPECT_EQ(report.find("stage 0"), std::string::npos);
+
+	tracer.reset();
+	EXPECT_EQ(tracer.getCount(), 0u);
+	EXPECT_EQ(tracer.report().find("read"), std::string::npos);
+}
@@ -0,0 +1,295 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Pipeline.test.cpp
+ * @brief			: TMP116::Pipeline and TMP116::ThreadPool Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Pipeline.hpp"
+
+#include "gtest/gtest.h"
+
+#include <mutex>
+
+using Backpressure = TMP116::Pipeline::Backpressure;
+using Pipeline	   = TMP116::Pipeline;
+using Sample	   = TMP116::Sample;
+using ThreadPool   = TMP116::ThreadPool;
+using std::chrono::microseconds;
+
+static Sample makeSample(TMP116::Register raw) { return Sample{1u, microseconds{raw}, raw}; }
+
+TEST(TMP116_TestThreadPool, executesAllSubmittedTasks) {
+	ThreadPool			  pool{4u};
+	std::atomic<uint32_t> count{0u};
+
+	for (int i = 0; i < 1000; i++) pool.submit([&count]() { count++; });
+	pool.wait();
+
+	EXPECT_EQ(pool.size(), 4u);
+	EXPECT_EQ(count.load(), 1000u);
+}
+
+TEST(TMP116_TestThreadPool, stealsTasksSubmittedByATask) {
+	ThreadPool			  pool{4u};
+	std::atomic<uint32_t> count{0u};
+
+	// Tasks submitted by a task are queued to its own thread, leaving the other threads to steal them.
+	pool.submit([&pool, &count]() {
+		for (int i = 0; i < 64; i++) {
+			pool.submit([&count]() {
+				std::this_thread::sleep_for(std::chrono::milliseconds{1});
+				count++;
+			});
+		}
+	});
+	pool.wait();
+
+	EXPECT_EQ(count.load(), 64u);
+	EXPECT_GT(pool.getSteals(), 0u);
+}
+
+TEST(TMP116_TestThreadPool, waitsForGroupFromATaskOfASingleThreadPool) {
+	ThreadPool			  pool{1u};
+	std::atomic<uint32_t> count{0u};
+	std::atomic<bool>	  waited{false};
+
+	// The only thread waits on its group, so must execute the tasks of the group itself.
+	pool.submit([&pool, &count, &waited]() {
+		ThreadPool::Group group{};
+		for (int i = 0; i < 16; i++) pool.submit([&count]() { count++; }, group);
+		pool.wait(group);
+		waited = count.load() == 16u && group.getPending() == 0u;
+	});
+	pool.wait();
+
+	EXPECT_TRUE(waited.load());
+}
+
+class TMP116_TestPipeline : public ::testing::Test {
+public:
+	ThreadPool pool{4u};
+
+	std::mutex			  mutex{};
+	std::vector<Sample>	  collected{};
+	std::atomic<bool>	  gate{true};
+	std::atomic<uint32_t> entered{0u};
+
+	Pipeline::Function collector() {
+		return [this](const Sample &sample) -> std::optional<Sample> {
+			std::lock_guard<std::mutex> lock{this->mutex};
+			this->collected.push_back(sample);
+			return sample;
+		};
+	}
+
+	Pipeline::Function gated() {
+		return [this](const Sample &sample) -> std::optional<Sample> {
+			this->entered++;
+			while (!this->gate.load()) std::this_thread::yield();
+			return sample;
+		};
+	}
+
+	void waitForEntered(uint32_t count) {
+		while (this->entered.load() < count) std::this_thread::yield();
+	}
+};
+
+TEST_F(TMP116_TestPipeline, pushFailsWithoutStages) {
+	Pipeline pipeline{pool};
+	EXPECT_FALSE(pipeline.push(makeSample(1u)));
+	EXPECT_EQ(pipeline.getStatistics(0u), std::nullopt);
+}
+
+TEST_F(TMP116_TestPipeline, processesSamplesThroughStagesInOrder) {
+	Pipeline pipeline{pool};
+	pipeline.addStage([](const Sample &sample) -> std::optional<Sample> {
+		Sample converted = sample;
+		converted.raw	 = static_cast<TMP116::Register>(sample.raw * 2u);
+		return converted;
+	});
+	pipeline.addStage(collector());
+	EXPECT_EQ(pipeline.size(), 2u);
+
+	for (TMP116::Register raw = 0u; raw < 500u; raw++) EXPECT_TRUE(pipeline.push(makeSample(raw)));
+	pipeline.flush();
+
+	ASSERT_EQ(collected.size(), 500u);
+	for (size_t i = 0u; i < collected.size(); i++) EXPECT_EQ(collected[i].raw, i * 2u);
+
+	const auto statistics = pipeline.getStatistics(0u);
+	EXPECT_EQ(statistics->processed, 500u);
+	EXPECT_EQ(statistics->emitted, 500u);
+	EXPECT_EQ(statistics->dropped, 0u);
+	EXPECT_GE(statistics->maxLatency, statistics->meanLatency);
+}
+
+TEST_F(TMP116_TestPipeline, stampsEnqueueAndStageExits) {
+	using Hop = TMP116::Trace::Hop;
+
+	Pipeline pipeline{pool};
+	pipeline.addStage([](const Sample &sample) -> std::optional<Sample> {
+		std::this_thread::sleep_for(microseconds{500});
+		return sample;
+	});
+	pipeline.addStage(collector());
+
+	Sample sample = makeSample(0u);
+	sample.timestamp = std::chrono::duration_cast<microseconds>(std::chrono::steady_clock::now().time_since_epoch());
+	ASSERT_TRUE(pipeline.push(sample));
+	pipeline.flush();
+
+	ASSERT_EQ(collected.size(), 1u);
+	const auto enqueue = collected[0].getStamp(Hop::ENQUEUE);
+	const auto first   = collected[0].getStamp(Hop::STAGE_0);
+	ASSERT_TRUE(enqueue && first);
+	EXPECT_GE(enqueue.value(), sample.timestamp);
+	EXPECT_GE(first.value() - enqueue.value(), microseconds{500});
+	EXPECT_EQ(collected[0].getStamp(Hop::STAGE_1), std::nullopt); // Collected within the second stage.
+}
+
+TEST_F(TMP116_TestPipeline, filteredSamplesAreNotPassedOn) {
+	Pipeline pipeline{pool};
+	pipeline.addStage([](const Sample &sample) -> std::optional<Sample> {
+		if (sample.raw % 2u) return std::nullopt;
+		return sample;
+	});
+	pipeline.addStage(collector());
+
+	for (TMP116::Register raw = 0u; raw < 10u; raw++) pipeline.push(makeSample(raw));
+	pipeline.flush();
+
+	EXPECT_EQ(collected.size(), 5u);
+	EXPECT_EQ(pipeline.getStatistics(0u)->processed, 10u);
+	EXPECT_EQ(pipeline.getStatistics(0u)->emitted, 5u);
+}
+
+TEST_F(TMP116_TestPipeline, dropOldestKeepsNewestSamplesWhenFull) {
+	Pipeline			   pipeline{pool};
+	Pipeline::StageOptions options{};
+	options.capacity = 4u;
+	gate			 = false;
+	pipeline.addStage(gated(), options);
+	pipeline.addStage(collector());
+
+	pipeline.push(makeSample(0u));
+	waitForEntered(1u);
+	for (TMP116::Register raw = 1u; raw <= 10u; raw++) EXPECT_TRUE(pipeline.push(makeSample(raw)));
+
+	gate = true;
+	pipeline.flush();
+
+	ASSERT_EQ(collected.size(), 5u);
+	EXPECT_EQ(collected[0].raw, 0u);
+	EXPECT_EQ(collected[1].raw, 7u);
+	EXPECT_EQ(collected[4].raw, 10u);
+	EXPECT_EQ(pipeline.getStatistics(0u)->dropped, 6u);
+}
+
+TEST_F(TMP116_TestPipeline, blockStallsUpstreamStageWithoutLoss) {
+	Pipeline			   pipeline{pool};
+	Pipeline::StageOptions options{};
+	options.capacity	 = 2u;
+	options.backpressure = Backpressure::BLOCK;
+	pipeline.addStage([](const Sample &sample) -> std::optional<Sample> { return sample; });
+	pipeline.addStage(
+		[this](const Sample &sample) -> std::optional<Sample> {
+			std::this_thread::sleep_for(microseconds{200});
+			return this->collector()(sample);
+		},
+		options
+	);
+
+	for (TMP116::Register raw = 0u; raw < 50u; raw++) EXPECT_TRUE(pipeline.push(makeSample(raw)));
+	pipeline.flush();
+
+	ASSERT_EQ(collected.size(), 50u);
+	for (size_t i = 0u; i < collected.size(); i++) EXPECT_EQ(collected[i].raw, i);
+	EXPECT_EQ(pipeline.getStatistics(1u)->dropped, 0u);
+}
+
+TEST_F(TMP116_TestPipeline, blockCompletesOnASingleThread) {
+	ThreadPool			   single{1u};
+	Pipeline			   pipeline{single};
+	Pipeline::StageOptions options{};
+	options.capacity	 = 2u;
+	options.backpressure = Backpressure::BLOCK;
+	pipeline.addStage([](const Sample &sample) -> std::optional<Sample> { return sample; });
+	pipeline.addStage([](const Sample &sample) -> std::optional<Sample> { return sample; }, options);
+	pipeline.addStage(collector(), options);
+
+	for (TMP116::Register raw = 0u; raw < 1000u; raw++) EXPECT_TRUE(pipeline.push(makeSample(raw)));
+	pipeline.flush();
+
+	ASSERT_EQ(collected.size(), 1000u);
+	for (size_t i = 0u; i < collected.size(); i++) EXPECT_EQ(collected[i].raw, i);
+	EXPECT_EQ(pipeline.getStatistics(1u)->dropped, 0u);
+	EXPECT_EQ(pipeline.getStatistics(2u)->dropped, 0u);
+}
+
+TEST_F(TMP116_TestPipeline, blockingFirstStageDropsPushedSamplesInsteadOfBlocking) {
+	Pipeline			   pipeline{pool};
+	Pipeline::StageOptions options{};
+	options.capacity	 = 2u;
+	options.backpressure = Backpressure::BLOCK;
+	gate				 = false;
+	pipeline.addStage(gated(), options);
+
+	pipeline.push(makeSample(0u));
+	waitForEntered(1u);
+	EXPECT_TRUE(pipeline.push(makeSample(1u)));
+	EXPECT_TRUE(pipeline.push(makeSample(2u)));
+	EXPECT_FALSE(pipeline.push(makeSample(3u)));
+
+	gate = true;
+	pipeline.flush();
+	EXPECT_EQ(pipeline.getStatistics(0u)->processed, 3u);
+	EXPECT_EQ(pipeline.getStatistics(0u)->dropped, 1u);
+}
+
+TEST_F(TMP116_TestPipeline, sampleDownAcceptsOneInRatioOnceHalfFull) {
+	Pipeline			   pipeline{pool};
+	Pipeline::StageOptions options{};
+	options.capacity	 = 8u;
+	options.backpressure = Backpressure::SAMPLE_DOWN;
+	options.sampleDown	 = 4u;
+	gate				 = false;
+	pipeline.addStage(gated(), options);
+
+	pipeline.push(makeSample(0u));
+	waitForEntered(1u);
+	size_t accepted = 0u;
+	for (TMP116::Register raw = 1u; raw <= 12u; raw++) accepted += pipeline.push(makeSample(raw)) ? 1u : 0u;
+
+	gate = true;
+	pipeline.flush();
+	EXPECT_EQ(accepted, 6u);
+	EXPECT_EQ(pipeline.getStatistics(0u)->processed, 7u); // 1 in progress, 4 below half full, 2 of 8 down-sampled.
+	EXPECT_EQ(pipeline.getStatistics(0u)->dropped, 6u);
+}
+
+TEST_F(TMP116_TestPipeline, sampleDownEmitsOnlySamplesQueued) {
+	Pipeline			   pipeline{pool};
+	Pipeline::StageOptions options{};
+	options.capacity	 = 8u;
+	options.backpressure = Backpressure::SAMPLE_DOWN;
+	options.sampleDown	 = 4u;
+	gate				 = false;
+	pipeline.addStage([](const Sample &sample) -> std::optional<Sample> { return sample; });
+	pipeline.addStage(gated(), options);
+
+	for (TMP116::Register raw = 0u; raw < 100u; raw++) EXPECT_TRUE(pipeline.push(makeSample(raw)));
+	waitForEntered(1u);
+	while (pipeline.getStatistics(0u)->processed < 100u) std::this_thread::yield();
+
+	gate = true;
+	pipeline.flush();
+	const auto first  = pipeline.getStatistics(0u).value();
+	const auto second = pipeline.getStatistics(1u).value();
+	EXPECT_EQ(first.processed, 100u);
+	EXPECT_GT(second.dropped, 0u);
+	EXPECT_EQ(first.emitted + second.dropped, first.processed);
+	EXPECT_EQ(second.processed, first.emitted);
+}
@@ -0,0 +1,209 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Predictor.test.cpp
+ * @brief			: TMP116::Predictor Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Predictor.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+
+using Predictor = TMP116::Predictor;
+using Sample	= TMP116::Sample;
+using Limit		= TMP116::Predictor::Limit;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+static Sample makeSample(TMP116::SensorId sensorId, TMP116::Timestamp timestamp, float celsius) {
+	const auto raw = static_cast<int16_t>(std::lround(celsius / TMP116::TEMPERATURE_RESOLUTION));
+	return Sample{sensorId, timestamp, static_cast<TMP116::Register>(raw)};
+}
+
+static double toSeconds(TMP116::Duration duration) { return std::chrono::duration<double>(duration).count(); }
+
+class TMP116_TestPredictor : public ::testing::Test {
+public:
+	Predictor::Options options{};
+
+	void SetUp() override {
+		options.window	= 8u;
+		options.horizon = seconds{30};
+	}
+};
+
+TEST_F(TMP116_TestPredictor, linearRampAlertsBeforeHighLimit) {
+	Predictor predictor{2u, options};
+	ASSERT_TRUE(predictor.setLimits(1u, -40.0f, 50.0f));
+
+	// Rising 0.5 degrees per second from 20, so meeting 50 at 60s.
+	std::optional<Predictor::Alert> alert{};
+	int								alertedAt = -1;
+	for (int t = 0; t <= 45; t++) {
+		const auto raised = predictor.offer(makeSample(1u, seconds{t}, 20.0f + 0.5f * static_cast<float>(t)));
+		if (raised.has_value()) {
+			EXPECT_FALSE(alert.has_value()) << "alerted again at " << t;
+			alert	  = raised;
+			alertedAt = t;
+		}
+	}
+
+	ASSERT_TRUE(alert.has_value());
+	EXPECT_EQ(alertedAt, 31); // The first sample projecting the limit within, rather than at, the horizon.
+	EXPECT_EQ(alert->sensorId, 1u);
+	EXPECT_EQ(alert->limit, Limit::HIGH);
+	EXPECT_EQ(alert->timestamp, seconds{31});
+	EXPECT_NEAR(toSeconds(alert->timeToLimit), 29.0, 1e-3);
+	EXPECT_NEAR(alert->value, 35.5f, 1e-3f);
+	EXPECT_NEAR(alert->slope, 0.5f, 1e-4f);
+	EXPECT_TRUE(predictor.isAlerting(1u, Limit::HIGH));
+	EXPECT_FALSE(predictor.isAlerting(1u, Limit::LOW));
+
+	const auto forecast = predictor.getForecast(1u);
+	ASSERT_TRUE(forecast.has_value());
+	EXPECT_EQ(forecast->timestamp, seconds{45});
+	EXPECT_NEAR(toSeconds(*forecast->timeToHigh), 15.0, 1e-3);
+	EXPECT_FALSE(forecast->timeToLow.has_value());
+}
+
+TEST_F(TMP116_TestPredictor, levellingOffClearsAlert) {
+	Predictor predictor{1u, options};
+	predictor.setLimits(0u, -40.0f, 30.0f);
+
+	int t = 0;
+	for (; t < 8; t++) predictor.offer(makeSample(0u, seconds{t}, 20.0f + static_cast<float>(t)));
+	EXPECT_TRUE(predictor.isAlerting(0u, Limit::HIGH));
+
+	// Once the window is level the limit is never met.
+	for (; t < 24; t++) EXPECT_FALSE(predictor.offer(makeSample(0u, seconds{t}, 27.0f)).has_value());
+	EXPECT_FALSE(predictor.isAlerting(0u, Limit::HIGH));
+	EXPECT_FALSE(predictor.getForecast(0u)->timeToHigh.has_value());
+
+	// Rising again alerts again.
+	bool alerted = false;
+	for (int step = 1; step <= 8 && !alerted; step++, t++)
+		alerted = predictor.offer(makeSample(0u, seconds{t}, 27.0f + static_cast<float>(step))).has_value();
+	EXPECT_TRUE(alerted);
+
+	// Having met the limit, the time to it is zero.
+	for (; t < 48; t++) predictor.offer(makeSample(0u, seconds{t}, 35.0f));
+	EXPECT_EQ(predictor.getForecast(0u)->timeToHigh, microseconds{0});
+	EXPECT_TRUE(predictor.isAlerting(0u, Limit::HIGH));
+}
+
+TEST_F(TMP116_TestPredictor, fallingRampAlertsBeforeLowLimit) {
+	Predictor predictor{1u, options};
+	predictor.setLimits(0u, 5.0f, 125.0f);
+
+	std::optional<Predictor::Alert> alert{};
+	for (int t = 0; t < 60 && !alert.has_value(); t++)
+		alert = predictor.offer(makeSample(0u, milliseconds{500 * t}, 25.0f - 0.25f * static_cast<float>(t)));
+
+	ASSERT_TRUE(alert.has_value());
+	EXPECT_EQ(alert->limit, Limit::LOW);
+	EXPECT_NEAR(alert->slope, -0.5f, 1e-4f);
+	EXPECT_LT(alert->timeToLimit, seconds{30});
+	EXPECT_GT(alert->timeToLimit, seconds{29});
+	EXPECT_TRUE(predictor.isAlerting(0u, Limit::LOW));
+}
+
+TEST_F(TMP116_TestPredictor, quadraticFitAnticipatesAcceleration) {
+	options.window = 16u;
+	Predictor linear{1u, options};
+	options.fit = Predictor::Fit::QUADRATIC;
+	Predictor quadratic{1u, options};
+	linear.setLimits(0u, -40.0f, 40.0f);
+	quadratic.setLimits(0u, -40.0f, 40.0f);
+
+	// Accelerating as 20 + t^2 / 100, so meeting 40 at about 44.7s.
+	for (int t = 0; t <= 20; t++) {
+		const float celsius = 20.0f + static_cast<float>(t * t) / 100.0f;
+		linear.offer(makeSample(0u, seconds{t}, celsius));
+		quadratic.offer(makeSample(0u, seconds{t}, celsius));
+	}
+
+	const auto forecast = quadratic.getForecast(0u);
+	ASSERT_TRUE(forecast.has_value());
+	EXPECT_NEAR(forecast->value, 24.0f, 0.01f);
+	EXPECT_NEAR(forecast->slope, 0.4f, 0.01f);
+	EXPECT_NEAR(forecast->curvature, 0.02f, 0.001f);
+	EXPECT_NEAR(toSeconds(*forecast->timeToHigh), std::sqrt(2000.0) - 20.0, 0.5);
+	EXPECT_TRUE(quadratic.isAlerting(0u, Limit::HIGH));
+
+	EXPECT_GT(*linear.getForecast(0u)->timeToHigh, seconds{30});
+	EXPECT_FALSE(linear.isAlerting(0u, Limit::HIGH));
+}
+
+TEST_F(TMP116_TestPredictor, rollingSumsMatchDirectFit) {
+	options.window = 32u;
+	Predictor predictor{1u, options};
+
+	std::mt19937					 random{116u};
+	std::normal_distribution<float>	 noise{0.0f, 0.05f};
+	std::uniform_int_distribution<> jitter{-50000, 50000};
+	std::vector<double>				 times;
+	std::vector<double>				 values;
+
+	// Far from the epoch, over many rebases.
+	const auto start = seconds{3600 * 24 * 365};
+	for (int i = 0; i < 1000; i++) {
+		const auto	timestamp = start + seconds{i} + microseconds{jitter(random)};
+		const float celsius	  = 25.0f + 0.01f * static_cast<float>(i) + noise(random);
+		const auto	sample	  = makeSample(0u, timestamp, celsius);
+		predictor.offer(sample);
+		times.push_back(toSeconds(timestamp - start));
+		values.push_back(sample.getTemperature());
+	}
+
+	// Ordinary least squares over the last window, centred for accuracy.
+	double meanT = 0.0, meanY = 0.0;
+	for (size_t i = times.size() - 32u; i < times.size(); i++) {
+		meanT += times[i] / 32.0;
+		meanY += values[i] / 32.0;
+	}
+	double covariance = 0.0, variance = 0.0;
+	for (size_t i = times.size() - 32u; i < times.size(); i++) {
+		covariance += (times[i] - meanT) * (values[i] - meanY);
+		variance += (times[i] - meanT) * (times[i] - meanT);
+	}
+	const double slope = covariance / variance;
+	const double value = meanY + slope * (times.back() - meanT);
+
+	const auto forecast = predictor.getForecast(0u);
+	ASSERT_TRUE(forecast.has_value());
+	EXPECT_NEAR(forecast->slope, slope, 1e-5);
+	EXPECT_NEAR(forecast->value, value, 1e-4);
+	EXPECT_EQ(forecast->curvature, 0.0f);
+}
+
+TEST_F(TMP116_TestPredictor, rejectsInvalidInput) {
+	Predictor predictor{1u, options};
+	EXPECT_FALSE(predictor.setLimits(1u, 0.0f, 10.0f));
+	EXPECT_FALSE(predictor.setLimits(0u, 10.0f, 10.0f));
+	EXPECT_FALSE(predictor.offer(makeSample(1u, seconds{0}, 20.0f)).has_value());
+	EXPECT_FALSE(predictor.getForecast(1u).has_value());
+	EXPECT_FALSE(predictor.isAlerting(1u, Limit::HIGH));
+	EXPECT_FALSE(predictor.reset(1u));
+
+	// A single sample has no slope.
+	predictor.offer(makeSample(0u, seconds{1}, 20.0f));
+	EXPECT_FALSE(predictor.getForecast(0u).has_value());
+
+	// Samples not later than the last are ignored.
+	predictor.offer(makeSample(0u, seconds{1}, 30.0f));
+	predictor.offer(makeSample(0u, seconds{0}, 30.0f));
+	EXPECT_FALSE(predictor.getForecast(0u).has_value());
+
+	predictor.offer(makeSample(0u, seconds{2}, 21.0f));
+	ASSERT_TRUE(predictor.getForecast(0u).has_value());
+	EXPECT_NEAR(predictor.getForecast(0u)->slope, 1.0f, 1e-5f);
+	EXPECT_FALSE(predictor.getForecast(0u)->timeToHigh.has_value()); // Without limits.
+
+	EXPECT_TRUE(predictor.reset(0u));
+	EXPECT_FALSE(predictor.getForecast(0u).has_value());
+}
@@ -0,0 +1,116 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_QuantileSketch.test.cpp
+ * @brief			: TMP116::QuantileSketch and TMP116::SlidingQuantileSketch Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_QuantileSketch.hpp"
+
+#include "gtest/gtest.h"
+
+using QuantileSketch		= TMP116::QuantileSketch;
+using SlidingQuantileSketch = TMP116::SlidingQuantileSketch;
+using Register				= TMP116::Register;
+using std::chrono::seconds;
+
+TEST(TMP116_TestQuantileSketch, getQuantileIsExactAtUnitBucketWidth) {
+	QuantileSketch sketch{};
+	EXPECT_EQ(sketch.getQuantile(0.5f), std::nullopt);
+
+	for (int16_t raw = 1; raw <= 100; raw++) sketch.add(static_cast<Register>(raw));
+
+	EXPECT_EQ(sketch.getCount(), 100u);
+	EXPECT_EQ(sketch.getQuantile(0.0f), Register{1u});
+	EXPECT_EQ(sketch.getQuantile(0.5f), Register{50u});
+	EXPECT_EQ(sketch.getQuantile(0.99f), Register{99u});
+	EXPECT_EQ(sketch.getQuantile(1.0f), Register{100u});
+}
+
+TEST(TMP116_TestQuantileSketch, negativeTemperaturesAreOrderedBelowPositive) {
+	QuantileSketch sketch{2u};
+	sketch.add(0xFB00u); // -10.0
+	sketch.add(0xFFFFu); // -0.0078125
+	sketch.add(0x0C80u); // 25.0
+
+	EXPECT_EQ(sketch.getBuckets(), 3u);
+	EXPECT_EQ(sketch.getQuantile(0.0f), Register{0xFB00u});
+	EXPECT_EQ(sketch.getQuantile(0.5f), Register{0xFFFCu}); // Bucket [-4, -1].
+	EXPECT_EQ(sketch.getQuantile(1.0f), Register{0x0C80u});
+}
+
+TEST(TMP116_TestQuantileSketch, compressesByCoarseningWhenBucketLimitExceeded) {
+	QuantileSketch sketch{0u, 8u};
+	for (int16_t raw = 0; raw < 64; raw++) sketch.add(static_cast<Register>(raw), 2u);
+
+	EXPECT_LE(sketch.getBuckets(), 8u);
+	EXPECT_EQ(sketch.getShift(), 3u);
+	EXPECT_EQ(sketch.getCount(), 128u);
+	EXPECT_EQ(sketch.getQuantile(0.5f), Register{24u}); // Bucket [24, 31] holds the 64th value.
+}
+
+TEST(TMP116_TestQuantileSketch, keepsNegativeValuesBelowZeroAtTheMaximumShift) {
+	QuantileSketch sketch{0u, 1u}; // Coarsened by one shift for each add beyond the bucket limit.
+	for (int i = 0; i < 8; i++) {
+		sketch.add(0xFB00u); // -10.0
+		sketch.add(0xFFFFu); // -0.0078125
+		sketch.add(0x0C80u); // 25.0
+	}
+
+	EXPECT_EQ(sketch.getShift(), 15u);
+	EXPECT_EQ(sketch.getBuckets(), 2u);
+	EXPECT_EQ(sketch.getQuantile(0.0f), Register{0x8000u}); // Bucket [-32768, -1], still below zero.
+	EXPECT_EQ(sketch.getQuantile(0.5f), Register{0x8000u});
+	EXPECT_EQ(sketch.getQuantile(1.0f), Register{0x0000u});
+
+	QuantileSketch other{0u, 1u};
+	other.add(0xFF00u); // -2.0
+	sketch.merge(other);
+	EXPECT_EQ(sketch.getShift(), 15u);
+	EXPECT_EQ(sketch.getQuantile(0.5f), Register{0x8000u});
+}
+
+TEST(TMP116_TestQuantileSketch, mergeCombinesSketchesOfDifferentWidths) {
+	QuantileSketch fine{0u};
+	QuantileSketch coarse{4u};
+	for (int16_t raw = 0; raw < 32; raw++) fine.add(static_cast<Register>(raw));
+	for (int16_t raw = 32; raw < 64; raw++) coarse.add(static_cast<Register>(raw));
+
+	fine.merge(coarse);
+	EXPECT_EQ(fine.getShift(), 4u);
+	EXPECT_EQ(fine.getCount(), 64u);
+	EXPECT_EQ(fine.getBuckets(), 4u);
+	EXPECT_EQ(fine.getQuantile(0.5f), Register{16u});
+	EXPECT_EQ(fine.getQuantile(1.0f), Register{48u});
+
+	fine.clear();
+	EXPECT_EQ(fine.getCount(), 0u);
+	EXPECT_EQ(fine.getQuantile(0.5f), std::nullopt);
+}
+
+TEST(TMP116_TestSlidingQuantileSketch, getWindowMergesOnlyCurrentSubWindows) {
+	SlidingQuantileSketch sketch{seconds{10}, 6u}; // 1 minute window.
+
+	sketch.add(TMP116::Sample{0u, seconds{5}, 1000u});
+	for (int time = 60; time < 120; time++) sketch.add(TMP116::Sample{0u, seconds{time}, 10u});
+	sketch.add(TMP116::Sample{0u, seconds{15}, 1000u}); // Older than the window.
+
+	const auto window = sketch.getWindow(seconds{119});
+	EXPECT_EQ(window.getCount(), 60u);
+	EXPECT_EQ(window.getQuantile(1.0f), Register{10u});
+
+	EXPECT_EQ(sketch.getWindow(seconds{130}).getCount(), 40u); // 60s to 70s has left the window.
+}
+
+TEST(TMP116_TestSlidingQuantileSketch, windowsBeforeTheEpochStartAtTheirFloor) {
+	SlidingQuantileSketch sketch{seconds{10}, 3u};
+
+	// -25s to -21s fall in the sub-window from -30s, and -5s in that from -10s.
+	for (int time = -25; time <= -21; time++) sketch.add(TMP116::Sample{0u, seconds{time}, 100u});
+	sketch.add(TMP116::Sample{0u, seconds{-5}, 200u});
+
+	EXPECT_EQ(sketch.getWindow(seconds{-1}).getCount(), 6u);
+	EXPECT_EQ(sketch.getWindow(seconds{5}).getCount(), 1u); // -30s to -20s has left the window.
+	EXPECT_EQ(sketch.getWindow(seconds{5}).getQuantile(0.0f), Register{200u});
+}
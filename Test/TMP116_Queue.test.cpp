@@ -0,0 +1,43 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Queue.test.cpp
+ * @brief			: TMP116::Queue Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Queue.hpp"
+
+#include "gtest/gtest.h"
+
+using Queue = TMP116::Queue<int>;
+
+TEST(TMP116_TestQueue, capacityIsRoundedUpToPowerOfTwo) {
+	EXPECT_EQ(Queue{1u}.capacity(), 2u);
+	EXPECT_EQ(Queue{3u}.capacity(), 4u);
+	EXPECT_EQ(Queue{1024u}.capacity(), 1024u);
+}
+
+TEST(TMP116_TestQueue, popReturnsElementsInOrderAcrossWrap) {
+	Queue queue{4u};
+	EXPECT_EQ(queue.pop(), std::nullopt);
+
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < 3; i++) EXPECT_TRUE(queue.push(round * 10 + i));
+		EXPECT_EQ(queue.size(), 3u);
+		for (int i = 0; i < 3; i++) EXPECT_EQ(queue.pop(), round * 10 + i);
+	}
+	EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(TMP116_TestQueue, pushFailsWhenFull) {
+	Queue queue{2u};
+	EXPECT_TRUE(queue.push(1));
+	EXPECT_TRUE(queue.push(2));
+	EXPECT_FALSE(queue.push(3));
+
+	EXPECT_EQ(queue.pop(), 1);
+	EXPECT_TRUE(queue.push(3));
+	EXPECT_EQ(queue.pop(), 2);
+	EXPECT_EQ(queue.pop(), 3);
+}
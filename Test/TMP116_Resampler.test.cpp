@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Resampler.test.cpp
+ * @brief			: TMP116::Resampler Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Resampler.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+using Interpolation = TMP116::Resampler::Interpolation;
+using Resampler		= TMP116::Resampler;
+using Sample		= TMP116::Sample;
+using std::chrono::milliseconds;
+
+/**
+ * @brief A sample of a temperature which is a whole number of LSBs.
+ */
+static Sample makeSample(TMP116::SensorId sensorId, int64_t ms, float celsius) {
+	const auto raw = static_cast<int16_t>(std::lround(celsius / TMP116::TEMPERATURE_RESOLUTION));
+	return Sample{sensorId, milliseconds{ms}, static_cast<TMP116::Register>(raw)};
+}
+
+class TMP116_TestResampler : public ::testing::Test {
+public:
+	static Resampler::Options options(Interpolation interpolation) {
+		Resampler::Options options{};
+		options.interval	  = milliseconds{100};
+		options.lookahead	  = milliseconds{300};
+		options.maxGap		  = milliseconds{1000};
+		options.interpolation = interpolation;
+		return options;
+	}
+};
+
+TEST_F(TMP116_TestResampler, interpolatesRaggedSensorsOntoGrid) {
+	Resampler resampler{2u, options(Interpolation::LINEAR)};
+
+	// Sensor 0 every 100ms on the grid, sensor 1 every 250ms offset by 50ms, ramping by 1C per second.
+	for (int64_t ms = 0; ms <= 1000; ms += 50) {
+		if (ms % 100 == 0) {
+			ASSERT_TRUE(resampler.offer(makeSample(0u, ms, 20.0f)));
+		}
+		if ((ms - 50) % 250 == 0) {
+			ASSERT_TRUE(resampler.offer(makeSample(1u, ms, 30.0f + ms / 1000.0f)));
+		}
+	}
+	resampler.flush();
+	const auto matrix = resampler.drain();
+
+	ASSERT_EQ(matrix.sensors, 2u);
+	ASSERT_EQ(matrix.getRows(), 11u); // 0ms to 1000ms.
+	EXPECT_EQ(matrix.times[0], milliseconds{0});
+	EXPECT_TRUE(std::isnan(matrix.at(0u, 1u))); // Before the first sample of sensor 1.
+	for (size_t row = 1u; row < matrix.getRows(); row++) {
+		EXPECT_EQ(matrix.times[row], milliseconds{100 * static_cast<int64_t>(row)});
+		EXPECT_FLOAT_EQ(matrix.at(row, 0u), 20.0f);
+		if (row <= 8u) {
+			EXPECT_NEAR(matrix.at(row, 1u), 30.0f + 0.1f * row, 0.01f);
+		}
+	}
+	EXPECT_NEAR(matrix.getRow(9u)[1], 30.8f, 0.01f); // Held after the last sample of sensor 1 at 800ms.
+}
+
+TEST_F(TMP116_TestResampler, holdsLastSampleBeforeRow) {
+	Resampler resampler{1u, options(Interpolation::HOLD)};
+	resampler.offer(makeSample(0u, 0, 20.0f));
+	resampler.offer(makeSample(0u, 250, 21.0f));
+	resampler.offer(makeSample(0u, 400, 22.0f));
+
+	const auto matrix = resampler.drain();
+	ASSERT_EQ(matrix.getRows(), 5u);
+	EXPECT_FLOAT_EQ(matrix.at(0u, 0u), 20.0f);
+	EXPECT_FLOAT_EQ(matrix.at(2u, 0u), 20.0f);
+	EXPECT_FLOAT_EQ(matrix.at(3u, 0u), 21.0f);
+	EXPECT_FLOAT_EQ(matrix.at(4u, 0u), 22.0f); // On the grid, so exact.
+}
+
+TEST_F(TMP116_TestResampler, completesRowsOnlyAfterAllSensorsOrLookahead) {
+	Resampler resampler{2u, options(Interpolation::LINEAR)};
+	resampler.offer(makeSample(0u, 0, 20.0f));
+	resampler.offer(makeSample(0u, 200, 20.0f));
+	EXPECT_EQ(resampler.drain().getRows(), 0u); // Waiting for sensor 1.
+
+	resampler.offer(makeSample(1u, 100, 25.0f));
+	auto matrix = resampler.drain();
+	ASSERT_EQ(matrix.getRows(), 2u);
+	EXPECT_TRUE(std::isnan(matrix.at(0u, 1u)));
+	EXPECT_FLOAT_EQ(matrix.at(1u, 1u), 25.0f);
+
+	// Sensor 1 falls silent, so rows wait for the lookahead, then hold its last value.
+	resampler.offer(makeSample(0u, 300, 20.0f));
+	EXPECT_EQ(resampler.advance(milliseconds{499}), 0u);
+	EXPECT_EQ(resampler.advance(milliseconds{500}), 1u);
+	matrix = resampler.drain();
+	ASSERT_EQ(matrix.getRows(), 1u);
+	EXPECT_EQ(matrix.times[0], milliseconds{200});
+	EXPECT_FLOAT_EQ(matrix.at(0u, 1u), 25.0f);
+
+	// Samples running beyond the lookahead of the oldest rows complete them, from 300ms to 600ms.
+	resampler.offer(makeSample(0u, 1000, 20.0f));
+	matrix = resampler.drain();
+	ASSERT_EQ(matrix.getRows(), 4u);
+	EXPECT_EQ(matrix.times[3], milliseconds{600});
+}
+
+TEST_F(TMP116_TestResampler, leavesGapsBeyondMaxGapMissing) {
+	Resampler resampler{1u, options(Interpolation::LINEAR)};
+	resampler.offer(makeSample(0u, 0, 20.0f));
+	resampler.offer(makeSample(0u, 2000, 30.0f));
+
+	const auto matrix = resampler.drain();
+	ASSERT_EQ(matrix.getRows(), 21u);
+	EXPECT_FLOAT_EQ(matrix.at(5u, 0u), 20.0f);	  // Held within the maximum gap.
+	EXPECT_TRUE(std::isnan(matrix.at(15u, 0u))); // Not interpolated across the gap.
+	EXPECT_FLOAT_EQ(matrix.at(20u, 0u), 30.0f);
+}
+
+TEST_F(TMP116_TestResampler, dropsOutOfOrderSamples) {
+	Resampler resampler{1u, options(Interpolation::LINEAR)};
+	EXPECT_TRUE(resampler.offer(makeSample(0u, 100, 20.0f)));
+	EXPECT_FALSE(resampler.offer(makeSample(0u, 100, 20.0f)));
+	EXPECT_FALSE(resampler.offer(makeSample(0u, 50, 20.0f)));
+	EXPECT_FALSE(resampler.offer(makeSample(1u, 200, 20.0f)));
+	EXPECT_EQ(resampler.getDropped(), 2u);
+}
+
+TEST_F(TMP116_TestResampler, dropsSamplesTooFarAheadOfPendingRows) {
+	auto options	 = TMP116_TestResampler::options(Interpolation::LINEAR);
+	options.maxAhead = milliseconds{1000};
+	Resampler resampler{2u, options};
+	EXPECT_TRUE(resampler.offer(makeSample(0u, 0, 20.0f)));
+	EXPECT_TRUE(resampler.offer(makeSample(1u, 10, 20.0f)));
+
+	// A day ahead, as with a corrupt timestamp, would otherwise complete 864,000 rows.
+	EXPECT_FALSE(resampler.offer(makeSample(0u, 86'400'000, 20.0f)));
+	EXPECT_EQ(resampler.getDropped(), 1u);
+	EXPECT_EQ(resampler.drain().getRows(), 1u); // Row 0 only, completed by both sensors.
+
+	// The newest pending row is at 400ms, so 1300ms is within the lead.
+	EXPECT_TRUE(resampler.offer(makeSample(0u, 1300, 21.0f)));
+	EXPECT_EQ(resampler.drain().getRows(), 9u); // 100ms to 900ms, beyond the lookahead of 1300ms.
+	EXPECT_FALSE(resampler.offer(makeSample(1u, 2800, 21.0f))); // The newest pending row is now at 1300ms.
+}
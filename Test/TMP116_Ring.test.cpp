@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Ring.test.cpp
+ * @brief			: TMP116::Ring Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Ring.hpp"
+
+#include "gtest/gtest.h"
+
+using Ring = TMP116::Ring<int>;
+
+TEST(TMP116_TestRing, capacityIsRoundedUpToPowerOfTwo) {
+	EXPECT_EQ(Ring{1u}.capacity(), 1u);
+	EXPECT_EQ(Ring{5u}.capacity(), 8u);
+	EXPECT_EQ(Ring{64u}.capacity(), 64u);
+}
+
+TEST(TMP116_TestRing, popReturnsElementsInOrder) {
+	Ring ring{4u};
+	EXPECT_EQ(ring.pop(), std::nullopt);
+
+	EXPECT_TRUE(ring.push(1));
+	EXPECT_TRUE(ring.push(2));
+	EXPECT_EQ(ring.size(), 2u);
+
+	EXPECT_EQ(ring.pop(), 1);
+	EXPECT_EQ(ring.pop(), 2);
+	EXPECT_EQ(ring.pop(), std::nullopt);
+}
+
+TEST(TMP116_TestRing, pushFailsWhenFull) {
+	Ring ring{2u};
+	EXPECT_TRUE(ring.push(1));
+	EXPECT_TRUE(ring.push(2));
+	EXPECT_FALSE(ring.push(3));
+
+	EXPECT_EQ(ring.pop(), 1);
+	EXPECT_TRUE(ring.push(3));
+}
+
+TEST(TMP116_TestRing, bulkPopDrainsAvailableElementsAcrossWrap) {
+	Ring ring{4u};
+	for (int i = 0; i < 3; i++) ring.push(i);
+	ring.pop();
+	ring.pop();
+	for (int i = 3; i < 6; i++) ring.push(i);
+
+	int elements[8]{};
+	EXPECT_EQ(ring.pop(elements, 8u), 4u);
+	EXPECT_EQ(elements[0], 2);
+	EXPECT_EQ(elements[3], 5);
+	EXPECT_EQ(ring.pop(elements, 8u), 0u);
+}
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Rollup.test.cpp
+ * @brief			: TMP116::Rollup Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Rollup.hpp"
+
+#include "gtest/gtest.h"
+
+using Rollup = TMP116::Rollup;
+using Sample = TMP116::Sample;
+using std::chrono::seconds;
+
+class TMP116_TestRollup : public ::testing::Test {
+public:
+	// 1s for 60s, 1min for 1h.
+	Rollup rollup{2u, {{seconds{1}, 60u}, {seconds{60}, 60u}}};
+
+	void ingest(TMP116::SensorId sensorId, seconds time, TMP116::Register raw) {
+		EXPECT_TRUE(rollup.ingest(Sample{sensorId, time, raw}));
+	}
+};
+
+TEST_F(TMP116_TestRollup, ingestAggregatesAtEachResolution) {
+	ingest(0u, seconds{0}, 0x0C80u);  // 25.0
+	ingest(0u, seconds{0}, 0x0D00u);  // 26.0
+	ingest(0u, seconds{30}, 0xFF80u); // -1.0
+
+	const auto second = rollup.getBucket(0u, 0u, seconds{0});
+	ASSERT_TRUE(second.has_value());
+	EXPECT_EQ(second->count, 2u);
+	EXPECT_EQ(second->min, 0x0C80);
+	EXPECT_EQ(second->max, 0x0D00);
+	EXPECT_EQ(second->last, 0x0D00);
+	EXPECT_FLOAT_EQ(second->getMean(), 25.5f);
+
+	const auto minute = rollup.getBucket(0u, 1u, seconds{59});
+	ASSERT_TRUE(minute.has_value());
+	EXPECT_EQ(minute->start, seconds{0});
+	EXPECT_EQ(minute->count, 3u);
+	EXPECT_EQ(minute->min, -128);
+	EXPECT_EQ(minute->last, -128);
+	EXPECT_FLOAT_EQ(minute->getMean(), 50.0f / 3.0f);
+}
+
+TEST_F(TMP116_TestRollup, sensorsAreAggregatedIndependently) {
+	ingest(0u, seconds{0}, 0x0080u);
+	ingest(1u, seconds{0}, 0x0100u);
+
+	EXPECT_EQ(rollup.getBucket(0u, 0u, seconds{0})->max, 0x0080);
+	EXPECT_EQ(rollup.getBucket(1u, 0u, seconds{0})->max, 0x0100);
+	EXPECT_FALSE(rollup.ingest(Sample{2u, seconds{0}, 0x0000u}));
+	EXPECT_EQ(rollup.getBucket(2u, 0u, seconds{0}), std::nullopt);
+}
+
+TEST_F(TMP116_TestRollup, bucketsAreRecycledAsTimeAdvances) {
+	ingest(0u, seconds{5}, 0x0080u);
+	ingest(0u, seconds{65}, 0x0100u); // Same 1s slot as 5s.
+
+	EXPECT_EQ(rollup.getBucket(0u, 0u, seconds{5}), std::nullopt);
+	EXPECT_EQ(rollup.getBucket(0u, 0u, seconds{65})->count, 1u);
+	EXPECT_EQ(rollup.getBucket(0u, 1u, seconds{5})->count, 1u); // Still retained at 1min.
+
+	// Samples older than the retained interval are ignored at that resolution only.
+	EXPECT_TRUE(rollup.ingest(Sample{0u, seconds{5}, 0x0000u}));
+	EXPECT_EQ(rollup.getBucket(0u, 0u, seconds{5}), std::nullopt);
+	EXPECT_EQ(rollup.getBucket(0u, 1u, seconds{5})->count, 2u);
+}
+
+TEST_F(TMP116_TestRollup, getBucketsReturnsRetainedBucketsInRange) {
+	for (int time = 0; time < 200; time += 10) ingest(0u, seconds{time}, static_cast<TMP116::Register>(time));
+
+	Rollup::Bucket buckets[100]{};
+	const size_t   count = rollup.getBuckets(0u, 0u, seconds{0}, seconds{199}, buckets, 100u);
+	ASSERT_EQ(count, 6u); // Only the last 60s are retained at 1s.
+	EXPECT_EQ(buckets[0].start, seconds{140});
+	EXPECT_EQ(buckets[5].start, seconds{190});
+
+	EXPECT_EQ(rollup.getBuckets(0u, 1u, seconds{0}, seconds{199}, buckets, 100u), 4u);
+	EXPECT_EQ(buckets[3].count, 2u);
+	EXPECT_EQ(rollup.getBuckets(0u, 1u, seconds{0}, seconds{199}, buckets, 2u), 2u);
+}
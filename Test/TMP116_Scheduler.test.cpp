@@ -0,0 +1,160 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Scheduler.test.cpp
+ * @brief			: TMP116::Scheduler Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Scheduler.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnArg;
+
+using BusModel		= TMP116::BusModel;
+using Config		= TMP116::Config;
+using DeviceAddress = TMP116::DeviceAddress;
+using PollPolicy	= TMP116::BusModel::PollPolicy;
+using Register		= TMP116::Register;
+using Scheduler		= TMP116::Scheduler;
+using std::chrono::microseconds;
+
+class SchedulerMockedI2C : public TMP116::I2C {
+public:
+	MOCK_METHOD(
+		std::optional<Register>, //
+		read,
+		(DeviceAddress deviceAddress, MemoryAddress memoryAddress),
+		(override)
+	);
+	MOCK_METHOD(
+		std::optional<Register>,
+		write,
+		(DeviceAddress deviceAddress, MemoryAddress memoryAddress, Register registerValue),
+		(override)
+	);
+};
+
+class TMP116_TestScheduler : public ::testing::Test {
+public:
+	NiceMock<SchedulerMockedI2C> mockedI2C{}; // Reads are stubbed by ON_CALL, and not all expected.
+	BusModel					 model{400'000u};
+	Scheduler					 scheduler{model};
+	TMP116						 control{mockedI2C, DeviceAddress::ADD0_GND};
+	TMP116						 housekeeping{mockedI2C, DeviceAddress::ADD0_VCC};
+
+	void SetUp() override {
+		EXPECT_CALL(mockedI2C, write).WillRepeatedly(ReturnArg<2>());
+		ON_CALL(mockedI2C, read(Eq(DeviceAddress::ADD0_GND), Eq(0x00u))).WillByDefault(Return(0x0100u));
+		ON_CALL(mockedI2C, read(Eq(DeviceAddress::ADD0_VCC), Eq(0x00u))).WillByDefault(Return(0x0200u));
+	}
+
+	static PollPolicy controlPolicy(void) {
+		PollPolicy policy{};
+		policy.config.conversionCycleTime = Config::ConversionCycleTime::CONV_15_5MS;
+		policy.config.averages			  = Config::Averages::AVG_1;
+		return policy;
+	}
+};
+
+TEST_F(TMP116_TestScheduler, addSensorWritesAdmittedConfig) {
+	EXPECT_CALL(mockedI2C, write(Eq(DeviceAddress::ADD0_GND), Eq(0x01u), Eq(Register(controlPolicy().config))))
+		.WillOnce(ReturnArg<2>());
+
+	const auto admitted = scheduler.addSensor(1u, control, controlPolicy());
+	ASSERT_TRUE(admitted.has_value());
+	EXPECT_EQ(admitted->getPeriod(), microseconds{15'500});
+	EXPECT_EQ(scheduler.size(), 1u);
+	EXPECT_EQ(model.getPolicies().size(), 1u);
+}
+
+TEST_F(TMP116_TestScheduler, addSensorFailsWhenConfigCannotBeWritten) {
+	EXPECT_CALL(mockedI2C, write).WillOnce(Return(std::nullopt));
+	EXPECT_EQ(scheduler.addSensor(1u, control, controlPolicy()), std::nullopt);
+	EXPECT_EQ(scheduler.size(), 0u);
+	EXPECT_TRUE(model.getPolicies().empty());
+}
+
+TEST_F(TMP116_TestScheduler, addSensorRejectsPolicyExceedingBusBudget) {
+	BusModel  exhaustedModel{400'000u, 0.0f};
+	Scheduler exhaustedScheduler{exhaustedModel};
+	EXPECT_EQ(exhaustedScheduler.addSensor(1u, control, controlPolicy()), std::nullopt);
+	EXPECT_EQ(exhaustedScheduler.size(), 0u);
+}
+
+TEST_F(TMP116_TestScheduler, pollReadsEarliestDeadlineFirst) {
+	ASSERT_TRUE(scheduler.addSensor(2u, housekeeping, PollPolicy{}).has_value());
+	ASSERT_TRUE(scheduler.addSensor(1u, control, controlPolicy(), microseconds{5'000}).has_value());
+
+	const auto first = scheduler.poll(microseconds{100});
+	ASSERT_TRUE(first.has_value());
+	EXPECT_EQ(first->sensorId, 1u);
+	EXPECT_EQ(first->raw, 0x0100u);
+	EXPECT_EQ(first->timestamp, microseconds{100});
+
+	const auto second = scheduler.poll(microseconds{200});
+	ASSERT_TRUE(second.has_value());
+	EXPECT_EQ(second->sensorId, 2u);
+	EXPECT_FLOAT_EQ(second->getTemperature(), 4.0f);
+}
+
+TEST_F(TMP116_TestScheduler, pollWaitsForNextRelease) {
+	ASSERT_TRUE(scheduler.addSensor(1u, control, controlPolicy()).has_value());
+	ASSERT_TRUE(scheduler.poll(microseconds{0}).has_value());
+
+	EXPECT_EQ(scheduler.getNextRelease(), microseconds{15'500});
+	EXPECT_EQ(scheduler.poll(microseconds{10'000}), std::nullopt);
+
+	// Read late, so the sample waited since the conversion expected at its release.
+	const auto sample = scheduler.poll(microseconds{16'000});
+	ASSERT_TRUE(sample.has_value());
+	EXPECT_EQ(sample->getStamp(TMP116::Trace::Hop::CONVERSION), microseconds{15'500});
+	EXPECT_EQ(sample->getStamp(TMP116::Trace::Hop::READ), std::nullopt);
+}
+
+TEST_F(TMP116_TestScheduler, pollRecordsSlackAndDeadlineMisses) {
+	ASSERT_TRUE(scheduler.addSensor(1u, control, controlPolicy(), microseconds{5'000}).has_value());
+
+	ASSERT_TRUE(scheduler.poll(microseconds{1'000}).has_value()); // Slack 4ms.
+	ASSERT_TRUE(scheduler.poll(microseconds{17'500}).has_value()); // Slack 3ms.
+
+	// Releases at 31ms and 46.5ms are missed, the release at 62ms is read with slack 1ms.
+	ASSERT_TRUE(scheduler.poll(microseconds{66'000}).has_value());
+
+	const auto statistics = scheduler.getStatistics(1u);
+	ASSERT_TRUE(statistics.has_value());
+	EXPECT_EQ(statistics->reads, 3u);
+	EXPECT_EQ(statistics->misses, 2u);
+	EXPECT_EQ(statistics->minSlack, microseconds{1'000});
+	EXPECT_EQ(statistics->getMeanSlack(), microseconds{(4'000 + 3'000 + 1'000) / 3});
+}
+
+TEST_F(TMP116_TestScheduler, pollCountsFailedReadsAndRetriesJob) {
+	ASSERT_TRUE(scheduler.addSensor(1u, control, controlPolicy()).has_value());
+
+	EXPECT_CALL(mockedI2C, read).WillOnce(Return(std::nullopt)).WillOnce(Return(0x0100u));
+	EXPECT_EQ(scheduler.poll(microseconds{0}), std::nullopt);
+	EXPECT_TRUE(scheduler.poll(microseconds{100}).has_value());
+
+	EXPECT_EQ(scheduler.getStatistics(1u)->failures, 1u);
+	EXPECT_EQ(scheduler.getStatistics(1u)->reads, 1u);
+	EXPECT_EQ(scheduler.getStatistics(3u), std::nullopt);
+}
+
+TEST_F(TMP116_TestScheduler, pollWaitsForDataReadyWhenPolicyRequires) {
+	PollPolicy policy	 = controlPolicy();
+	policy.pollDataReady = true;
+	ASSERT_TRUE(scheduler.addSensor(1u, control, policy).has_value());
+
+	EXPECT_CALL(mockedI2C, read(_, Eq(0x01u))).WillOnce(Return(0x0000u)).WillOnce(Return(0x2000u));
+	EXPECT_CALL(mockedI2C, read(_, Eq(0x00u))).WillOnce(Return(0x0100u));
+
+	EXPECT_EQ(scheduler.poll(microseconds{0}), std::nullopt);
+	EXPECT_TRUE(scheduler.poll(microseconds{100}).has_value());
+}
@@ -0,0 +1,227 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Segment.test.cpp
+ * @brief			: TMP116::SegmentWriter and TMP116::SegmentReader Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Segment.hpp"
+#include "TMP116_ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using Query			= TMP116::Segment::Query;
+using Sample		= TMP116::Sample;
+using SegmentReader = TMP116::SegmentReader;
+using SegmentWriter = TMP116::SegmentWriter;
+using ThreadPool	= TMP116::ThreadPool;
+using std::chrono::microseconds;
+
+class TMP116_TestSegment : public ::testing::Test {
+public:
+	std::vector<std::string> paths{};
+
+	void TearDown() override {
+		for (const auto &path : paths) unlink(path.c_str());
+	}
+
+	std::string makePath() {
+		paths.push_back(
+			"/tmp/TMP116_TestSegment." + std::to_string(getpid()) + "." + std::to_string(paths.size()) + ".seg"
+		);
+		return paths.back();
+	}
+
+	/**
+	 * @brief Write a segment of 8 sensors sampled every 10us, with the raw value rising with time.
+	 */
+	std::string writeSegment(int64_t start, size_t count, size_t blockCapacity, bool seal = true) {
+		const std::string path = makePath();
+		SegmentWriter	  writer{path, blockCapacity};
+		EXPECT_TRUE(writer.open());
+		for (size_t i = 0u; i < count; i++) EXPECT_TRUE(writer.append(makeSample(start, i)));
+		if (seal) EXPECT_TRUE(writer.seal());
+		else {
+			EXPECT_TRUE(writer.sync());
+			SegmentReader reader{path}; // Read while still open, as after a crash.
+			EXPECT_TRUE(reader.open());
+			EXPECT_FALSE(reader.isSealed());
+			EXPECT_EQ(reader.getSamples(), count);
+		}
+		return path;
+	}
+
+	static Sample makeSample(int64_t start, size_t i) {
+		return Sample{
+			static_cast<TMP116::SensorId>(i % 8u),
+			microseconds{start + static_cast<int64_t>(i) * 10},
+			static_cast<TMP116::Register>(i),
+		};
+	}
+};
+
+TEST_F(TMP116_TestSegment, writesAndReadsBackAllSamples) {
+	const auto	  path = writeSegment(0, 1000u, 64u);
+	SegmentReader reader{path};
+	ASSERT_TRUE(reader.open());
+
+	EXPECT_TRUE(reader.isSealed());
+	EXPECT_EQ(reader.getBlocks(), 16u);
+	EXPECT_EQ(reader.getSamples(), 1000u);
+	EXPECT_EQ(reader.getBlock(15u).count, 1000u - 15u * 64u);
+
+	const auto samples = reader.query(Query{});
+	ASSERT_EQ(samples.size(), 1000u);
+	for (size_t i = 0u; i < samples.size(); i++) {
+		const Sample expected = makeSample(0, i);
+		EXPECT_EQ(samples[i].sensorId, expected.sensorId);
+		EXPECT_EQ(samples[i].timestamp, expected.timestamp);
+		EXPECT_EQ(samples[i].raw, expected.raw);
+	}
+}
+
+TEST_F(TMP116_TestSegment, timeRangeSkipsBlocksByIndex) {
+	const auto	  path = writeSegment(0, 1000u, 64u);
+	SegmentReader reader{path};
+	ASSERT_TRUE(reader.open());
+
+	Query query{};
+	query.first = 3u;
+	query.last	= 3u;
+	query.from	= microseconds{5'000};
+	query.to	= microseconds{5'990};
+
+	std::vector<Sample> samples{};
+	const auto			statistics = reader.scan(query, [&samples](const Sample &sample) {
+		 samples.push_back(sample);
+		 return true;
+	 });
+
+	ASSERT_EQ(samples.size(), 12u); // Samples 507 to 595 of sensor 3.
+	EXPECT_EQ(samples.front().timestamp, microseconds{5'070});
+	EXPECT_EQ(samples.back().timestamp, microseconds{5'950});
+	EXPECT_EQ(statistics.blocksRead, 3u); // Blocks 7 to 9 hold samples 448 to 639.
+	EXPECT_EQ(statistics.blocksSkipped, 13u);
+	EXPECT_EQ(statistics.matched, 12u);
+}
+
+TEST_F(TMP116_TestSegment, temperaturePredicateIsPushedDown) {
+	const auto	  path = writeSegment(0, 1000u, 100u);
+	SegmentReader reader{path};
+	ASSERT_TRUE(reader.open());
+
+	Query query{};
+	query.minRaw = 950;
+
+	const auto statistics = reader.scan(query, [](const Sample &) { return true; });
+	EXPECT_EQ(statistics.matched, 50u);
+	EXPECT_EQ(statistics.blocksRead, 1u);
+	EXPECT_EQ(statistics.samplesRead, 100u);
+}
+
+TEST_F(TMP116_TestSegment, visitorStopsScan) {
+	const auto	  path = writeSegment(0, 1000u, 100u);
+	SegmentReader reader{path};
+	ASSERT_TRUE(reader.open());
+
+	size_t visited = 0u;
+	reader.scan(Query{}, [&visited](const Sample &) { return ++visited < 5u; });
+	EXPECT_EQ(visited, 5u);
+}
+
+TEST_F(TMP116_TestSegment, recoversUnsealedSegment) {
+	const auto path = writeSegment(0, 250u, 100u, false);
+
+	// A torn block at the end is ignored.
+	FILE *file = fopen(path.c_str(), "ab");
+	ASSERT_NE(file, nullptr);
+	const char garbage[24] = "TBLK partial block";
+	fwrite(garbage, 1u, sizeof(garbage), file);
+	fclose(file);
+
+	SegmentReader reader{path};
+	ASSERT_TRUE(reader.open());
+	EXPECT_FALSE(reader.isSealed());
+	EXPECT_EQ(reader.getBlocks(), 3u);
+	EXPECT_EQ(reader.query(Query{}).size(), 250u);
+}
+
+TEST_F(TMP116_TestSegment, rejectsMissingOrForeignFiles) {
+	SegmentReader missing{"/tmp/TMP116_TestSegment.missing.seg"};
+	EXPECT_FALSE(missing.open());
+
+	const auto path = makePath();
+	FILE	  *file = fopen(path.c_str(), "wb");
+	fputs("not a segment file", file);
+	fclose(file);
+
+	SegmentReader foreign{path};
+	EXPECT_FALSE(foreign.open());
+}
+
+TEST_F(TMP116_TestSegment, queriesSegmentsInParallelInOrder) {
+	std::vector<std::string> segments{};
+	for (int64_t segment = 0; segment < 8; segment++) segments.push_back(writeSegment(segment * 10'000, 1000u, 64u));
+
+	ThreadPool pool{4u};
+	Query	   query{};
+	query.first = 2u;
+	query.last	= 2u;
+
+	const auto samples = SegmentReader::query(segments, query, pool);
+	ASSERT_EQ(samples.size(), 8u * 125u);
+	for (size_t i = 1u; i < samples.size(); i++) EXPECT_LT(samples[i - 1u].timestamp, samples[i].timestamp);
+}
+
+TEST_F(TMP116_TestSegment, queriesSegmentsFromATaskOfTheSamePool) {
+	std::vector<std::string> segments{};
+	for (int64_t segment = 0; segment < 4; segment++) segments.push_back(writeSegment(segment * 10'000, 100u, 4u));
+
+	// The only thread of the pool is the one waiting, so it scans the segments itself.
+	ThreadPool pool{1u};
+	size_t	   matched = 0u;
+	pool.submit([&pool, &segments, &matched]() { matched = SegmentReader::query(segments, Query{}, pool).size(); });
+	pool.wait();
+
+	EXPECT_EQ(matched, 4u * 100u);
+}
+
+TEST_F(TMP116_TestSegment, reportsCorruptBlocksOfSealedSegments) {
+	const auto path = writeSegment(0, 640u, 64u);
+
+	// Flip a bit of a record of block 2, leaving its header and the index intact.
+	const int file = open(path.c_str(), O_RDWR);
+	ASSERT_GE(file, 0);
+	const size_t header = sizeof(TMP116::Segment::Block);
+	const size_t block	= header + 64u * sizeof(TMP116::Segment::Record);
+	const off_t	 record = static_cast<off_t>(sizeof(TMP116::Segment::Header) + 2u * block + header);
+	uint8_t byte = 0u;
+	ASSERT_EQ(pread(file, &byte, 1u, record), 1);
+	byte ^= 0x01u;
+	ASSERT_EQ(pwrite(file, &byte, 1u, record), 1);
+	close(file);
+
+	SegmentReader reader{path};
+	ASSERT_TRUE(reader.open());
+	ASSERT_TRUE(reader.isSealed());
+	EXPECT_TRUE(reader.readBlock(2u).empty());
+	EXPECT_EQ(reader.readBlock(3u).size(), 64u);
+
+	const auto statistics = reader.scan(Query{}, [](const Sample &) { return true; });
+	EXPECT_EQ(statistics.errors, 1u);
+	EXPECT_EQ(statistics.blocksRead, 9u);
+	EXPECT_EQ(statistics.matched, 576u); // The blocks after the corrupt block are still read.
+}
+
+TEST_F(TMP116_TestSegment, failedWriterClosesWithoutATrailer) {
+	SegmentWriter writer{"/dev/full", 4u}; // Every write fails with ENOSPC.
+	EXPECT_FALSE(writer.open());
+	EXPECT_TRUE(writer.hasFailed());
+	EXPECT_FALSE(writer.append(makeSample(0, 0u)));
+	EXPECT_FALSE(writer.seal());
+	EXPECT_FALSE(writer.isOpen()); // Closed despite failing, so the destructor does not seal again.
+}
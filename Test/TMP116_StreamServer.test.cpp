@@ -0,0 +1,267 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_StreamServer.test.cpp
+ * @brief			: TMP116::StreamServer Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_StreamServer.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using FrameHeader  = TMP116::StreamServer::FrameHeader;
+using Record	   = TMP116::StreamServer::Record;
+using Sample	   = TMP116::Sample;
+using StreamServer = TMP116::StreamServer;
+using Subscription = TMP116::StreamServer::Subscription;
+using std::chrono::microseconds;
+
+class TMP116_TestStreamServer : public ::testing::Test {
+public:
+	std::string		 path = "/tmp/TMP116_TestStreamServer." + std::to_string(getpid()) + ".sock";
+	StreamServer	 server{path};
+	std::vector<int> clients{};
+
+	void SetUp() override { ASSERT_TRUE(server.open()); }
+
+	void TearDown() override {
+		for (int client : clients) close(client);
+	}
+
+	int connectClient() {
+		sockaddr_un address{};
+		address.sun_family = AF_UNIX;
+		std::strcpy(address.sun_path, path.c_str());
+
+		const int client = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+		EXPECT_EQ(connect(client, reinterpret_cast<const sockaddr *>(&address), sizeof(address)), 0);
+		clients.push_back(client);
+		return client;
+	}
+
+	static std::vector<Sample> receive(int client) {
+		std::vector<uint8_t> buffer(65536u);
+		const ssize_t		 received = recv(client, buffer.data(), buffer.size(), MSG_DONTWAIT);
+		if (received < static_cast<ssize_t>(sizeof(FrameHeader))) return {};
+
+		FrameHeader header{};
+		std::memcpy(&header, buffer.data(), sizeof(header));
+		EXPECT_EQ(header.magic, StreamServer::MAGIC);
+		EXPECT_EQ(static_cast<size_t>(received), sizeof(FrameHeader) + header.count * sizeof(Record));
+
+		std::vector<Sample> samples{};
+		for (size_t i = 0u; i < header.count; i++) {
+			Record record{};
+			std::memcpy(&record, buffer.data() + sizeof(FrameHeader) + i * sizeof(Record), sizeof(record));
+			samples.push_back(Sample{record.sensorId, microseconds{header.timestamp + record.offset}, record.raw});
+		}
+		return samples;
+	}
+
+	static std::vector<Sample> makeBatch(size_t count) {
+		std::vector<Sample> samples{};
+		for (size_t i = 0u; i < count; i++) {
+			samples.push_back(Sample{
+				static_cast<TMP116::SensorId>(i % 8u),
+				microseconds{1'000'000'000 + static_cast<int64_t>(i) * 10},
+				static_cast<TMP116::Register>(0xF000u + i),
+			});
+		}
+		return samples;
+	}
+};
+
+TEST_F(TMP116_TestStreamServer, streamsBatchesToAllSubscribers) {
+	const int first	 = connectClient();
+	const int second = connectClient();
+	server.poll();
+	EXPECT_EQ(server.getSubscribers(), 2u);
+
+	const auto batch = makeBatch(100u);
+	server.publish(batch.data(), batch.size());
+
+	for (int client : {first, second}) {
+		const auto received = receive(client);
+		ASSERT_EQ(received.size(), batch.size());
+		for (size_t i = 0u; i < batch.size(); i++) {
+			EXPECT_EQ(received[i].sensorId, batch[i].sensorId);
+			EXPECT_EQ(received[i].timestamp, batch[i].timestamp);
+			EXPECT_EQ(received[i].raw, batch[i].raw);
+		}
+	}
+	EXPECT_EQ(server.getStatistics().frames, 2u);
+	EXPECT_EQ(server.getStatistics().records, 200u);
+}
+
+TEST_F(TMP116_TestStreamServer, appliesSubscriptionFilters) {
+	const int client = connectClient();
+	server.poll();
+
+	const Subscription subscription{StreamServer::MAGIC, 2u, 3u, 2u, 0u};
+	ASSERT_EQ(send(client, &subscription, sizeof(subscription), 0), static_cast<ssize_t>(sizeof(subscription)));
+	server.poll();
+
+	const auto batch = makeBatch(80u); // 10 samples of each of sensors 0 to 7.
+	server.publish(batch.data(), batch.size());
+
+	const auto received = receive(client);
+	ASSERT_EQ(received.size(), 10u); // Every second of the 20 samples from sensors 2 and 3.
+	for (const auto &sample : received) {
+		EXPECT_GE(sample.sensorId, 2u);
+		EXPECT_LE(sample.sensorId, 3u);
+	}
+}
+
+TEST_F(TMP116_TestStreamServer, splitsFramesExceedingGatherLimit) {
+	StreamServer::Options options{};
+	options.maxRuns = 4u;
+	StreamServer limited{path + ".limited", options};
+	ASSERT_TRUE(limited.open());
+
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	std::strcpy(address.sun_path, (path + ".limited").c_str());
+	const int client = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+	clients.push_back(client);
+	ASSERT_EQ(connect(client, reinterpret_cast<const sockaddr *>(&address), sizeof(address)), 0);
+	limited.poll();
+
+	const Subscription subscription{StreamServer::MAGIC, 0u, 0u, 1u, 0u};
+	send(client, &subscription, sizeof(subscription), 0);
+	limited.poll();
+
+	const auto batch = makeBatch(80u); // Sensor 0 forms 10 separate runs.
+	limited.publish(batch.data(), batch.size());
+
+	EXPECT_EQ(receive(client).size(), 4u);
+	EXPECT_EQ(receive(client).size(), 4u);
+	EXPECT_EQ(receive(client).size(), 2u);
+	EXPECT_EQ(limited.getStatistics().frames, 3u);
+}
+
+TEST_F(TMP116_TestStreamServer, removesSubscribersWhichHangUp) {
+	const int client = connectClient();
+	server.poll();
+	EXPECT_EQ(server.getSubscribers(), 1u);
+
+	close(client);
+	clients.clear();
+	server.poll();
+	EXPECT_EQ(server.getSubscribers(), 0u);
+	EXPECT_EQ(server.getStatistics().disconnected, 1u);
+}
+
+TEST_F(TMP116_TestStreamServer, shedsSlowSubscribersWithoutBlocking) {
+	const int slow = connectClient();
+	const int fast = connectClient();
+	server.poll();
+
+	const auto batch	= makeBatch(1000u);
+	size_t	   received = 0u;
+	for (int i = 0; i < 10'000 && server.getSubscribers() == 2u; i++) {
+		server.publish(batch.data(), batch.size());
+		while (!receive(fast).empty()) received++;
+	}
+
+	EXPECT_EQ(server.getSubscribers(), 1u);
+	EXPECT_GT(server.getStatistics().missed, 0u);
+	EXPECT_EQ(server.getStatistics().disconnected, 1u);
+	EXPECT_GT(received, 0u);
+	(void)slow;
+}
+
+TEST_F(TMP116_TestStreamServer, splitsLargeBatchesIntoFramesFittingTheSendBuffer) {
+	const int client = connectClient();
+	server.poll();
+
+	// 240 KB of records in one batch, more than a single frame may hold.
+	const auto batch = makeBatch(30'000u);
+	server.publish(batch.data(), batch.size());
+	EXPECT_EQ(server.getSubscribers(), 1u);
+	EXPECT_EQ(server.getStatistics().disconnected, 0u);
+	EXPECT_GT(server.getStatistics().frames, 1u);
+
+	size_t received = 0u;
+	for (auto frame = receive(client); !frame.empty(); frame = receive(client)) {
+		EXPECT_LE(frame.size(), StreamServer::Options{}.maxRecords);
+		if (received == 0u) {
+			EXPECT_EQ(frame.front().raw, batch.front().raw);
+			EXPECT_EQ(frame.back().raw, batch[frame.size() - 1u].raw);
+		}
+		received += frame.size();
+	}
+	EXPECT_EQ(received, server.getStatistics().records);
+}
+
+TEST_F(TMP116_TestStreamServer, gathersAtLeastOneRunPerFrame) {
+	StreamServer::Options options{};
+	options.maxRuns = 0u;
+	StreamServer limited{path + ".limited", options};
+	ASSERT_TRUE(limited.open());
+
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	std::strcpy(address.sun_path, (path + ".limited").c_str());
+	const int client = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+	clients.push_back(client);
+	ASSERT_EQ(connect(client, reinterpret_cast<const sockaddr *>(&address), sizeof(address)), 0);
+	limited.poll();
+
+	const Subscription subscription{StreamServer::MAGIC, 0u, 0u, 1u, 0u};
+	send(client, &subscription, sizeof(subscription), 0);
+	limited.poll();
+
+	const auto batch = makeBatch(24u); // Sensor 0 forms 3 separate runs.
+	limited.publish(batch.data(), batch.size());
+
+	for (int i = 0; i < 3; i++) EXPECT_EQ(receive(client).size(), 1u);
+	EXPECT_EQ(limited.getStatistics().frames, 3u);
+}
+
+TEST_F(TMP116_TestStreamServer, splitsBatchesSpanningMoreThanARecordOffset) {
+	const int client = connectClient();
+	server.poll();
+
+	// A day apart, beyond the 71 minutes a record offset spans from the base of its frame.
+	auto batch			= makeBatch(30u);
+	const int64_t day	= 86'400'000'000;
+	batch[10].timestamp = microseconds{1'000'000'000 + day};
+	batch[20].timestamp = microseconds{1'000'000'000 - day};
+	server.publish(batch.data(), batch.size());
+
+	std::vector<Sample> received{};
+	for (auto frame = receive(client); !frame.empty(); frame = receive(client))
+		received.insert(received.end(), frame.begin(), frame.end());
+	EXPECT_EQ(server.getStatistics().frames, 5u);
+	ASSERT_EQ(received.size(), batch.size());
+	for (size_t i = 0u; i < batch.size(); i++) EXPECT_EQ(received[i].timestamp, batch[i].timestamp);
+}
+
+TEST_F(TMP116_TestStreamServer, refusesPathOfListeningServerButReplacesStaleSocket) {
+	StreamServer second{path};
+	EXPECT_FALSE(second.open());
+
+	const int client = connectClient(); // The first server still owns its socket.
+	server.poll();
+	EXPECT_EQ(server.getSubscribers(), 1u);
+
+	// A socket bound and closed without being removed, as a crashed server leaves it.
+	const std::string stalePath = path + ".stale";
+	sockaddr_un		  address{};
+	address.sun_family = AF_UNIX;
+	std::strcpy(address.sun_path, stalePath.c_str());
+	const int stale = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+	ASSERT_EQ(bind(stale, reinterpret_cast<const sockaddr *>(&address), sizeof(address)), 0);
+	close(stale);
+
+	StreamServer replacing{stalePath};
+	EXPECT_TRUE(replacing.open());
+	(void)client;
+}
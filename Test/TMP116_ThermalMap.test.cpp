@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ThermalMap.test.cpp
+ * @brief			: TMP116::ThermalMap Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_ThermalMap.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+
+using Grid		 = TMP116::ThermalMap::Grid;
+using Position	 = TMP116::ThermalMap::Position;
+using Sample	 = TMP116::Sample;
+using ThermalMap = TMP116::ThermalMap;
+using std::chrono::microseconds;
+
+static Sample makeSample(TMP116::SensorId sensorId, float celsius) {
+	const auto raw = static_cast<int16_t>(std::lround(celsius / TMP116::TEMPERATURE_RESOLUTION));
+	return Sample{sensorId, microseconds{0}, static_cast<TMP116::Register>(raw)};
+}
+
+class TMP116_TestThermalMap : public ::testing::Test {
+public:
+	// Four sensors on the corners of a 1m square, mapped on a 5x5 grid of 0.25m.
+	const std::vector<Position> corners{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 1.0f}};
+	const Grid					grid{0.0f, 0.0f, 0.25f, 5u, 5u};
+};
+
+TEST_F(TMP116_TestThermalMap, cellsOnSensorsTakeTheirReadings) {
+	ThermalMap map{corners, grid};
+	const float temperatures[] = {20.0f, 30.0f, 40.0f, 50.0f};
+	for (TMP116::SensorId sensor = 0u; sensor < 4u; sensor++)
+		ASSERT_TRUE(map.update(makeSample(sensor, temperatures[sensor])));
+	map.refresh();
+
+	EXPECT_NEAR(map.at(0u, 0u), 20.0f, 1e-3f);
+	EXPECT_NEAR(map.at(4u, 0u), 30.0f, 1e-3f);
+	EXPECT_NEAR(map.at(0u, 4u), 40.0f, 1e-3f);
+	EXPECT_NEAR(map.at(4u, 4u), 50.0f, 1e-3f);
+	EXPECT_NEAR(map.at(2u, 2u), 35.0f, 1e-3f); // Equidistant from all, so the mean.
+	EXPECT_NEAR(map.at(2u, 0u), 272.0f / 9.6f, 1e-3f); // Weights of 4 for the two nearest and 0.8 for the others.
+	EXPECT_FALSE(map.update(makeSample(4u, 0.0f)));
+}
+
+TEST_F(TMP116_TestThermalMap, matchesDirectInverseDistanceWeighting) {
+	const std::vector<Position> positions{{0.1f, 0.2f}, {0.9f, 0.3f}, {0.4f, 0.8f}, {0.7f, 0.65f}, {0.2f, 0.5f}};
+	const float					temperatures[] = {21.0f, 24.0f, 19.5f, 30.0f, 22.5f};
+	ThermalMap::Options			options{};
+	options.neighbours = 3u;
+	options.power	   = 2.0f;
+
+	ThermalMap map{positions, grid, options};
+	map.update(temperatures);
+	map.refresh();
+	EXPECT_EQ(map.getNeighbours(), 3u);
+
+	for (size_t row = 0u; row < grid.height; row++) {
+		for (size_t column = 0u; column < grid.width; column++) {
+			const float x = 0.25f * column, y = 0.25f * row;
+
+			// The three nearest sensors by brute force.
+			std::vector<std::pair<float, size_t>> nearest{};
+			for (size_t sensor = 0u; sensor < positions.size(); sensor++)
+				nearest.emplace_back(std::hypot(positions[sensor].x - x, positions[sensor].y - y), sensor);
+			std::sort(nearest.begin(), nearest.end());
+
+			float sum = 0.0f, norm = 0.0f;
+			for (size_t rank = 0u; rank < 3u; rank++) {
+				const float weight = 1.0f / (nearest[rank].first * nearest[rank].first);
+				sum += weight * temperatures[nearest[rank].second];
+				norm += weight;
+			}
+			EXPECT_NEAR(map.at(column, row), sum / norm, 1e-3f);
+		}
+	}
+}
+
+TEST_F(TMP116_TestThermalMap, skipsSensorsWithoutReadings) {
+	ThermalMap map{corners, grid};
+	map.refresh();
+	EXPECT_TRUE(std::isnan(map.at(2u, 2u))); // No readings at all.
+
+	map.update(makeSample(1u, 30.0f));
+	map.update(makeSample(3u, 50.0f));
+	map.refresh();
+	EXPECT_NEAR(map.at(0u, 0u), 110.0f / 3.0f, 1e-3f); // Falls back to the sensors read, despite sensor 0 on the cell.
+	EXPECT_NEAR(map.at(2u, 2u), 40.0f, 1e-3f);
+	for (const float cell : map.getCells()) EXPECT_FALSE(std::isnan(cell));
+}
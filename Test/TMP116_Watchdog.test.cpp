@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Watchdog.test.cpp
+ * @brief			: TMP116::Watchdog Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Watchdog.hpp"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+using Config   = TMP116::Config;
+using Event	   = TMP116::Watchdog::Event;
+using Watchdog = TMP116::Watchdog;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+class TMP116_TestWatchdog : public ::testing::Test {
+public:
+	Watchdog		   watchdog{16u, microseconds{0}};
+	std::vector<Event> events{};
+
+	size_t advance(int64_t ms) {
+		return watchdog.advance(milliseconds{ms}, [this](const Event &event) { events.push_back(event); });
+	}
+};
+
+TEST_F(TMP116_TestWatchdog, expiresAfterTimeout) {
+	ASSERT_TRUE(watchdog.arm(3u, milliseconds{100}, milliseconds{0}));
+	EXPECT_EQ(watchdog.getArmed(), 1u);
+
+	EXPECT_EQ(advance(99), 0u);
+	EXPECT_FALSE(watchdog.isStale(3u));
+	EXPECT_EQ(advance(100), 1u);
+	ASSERT_EQ(events.size(), 1u);
+	EXPECT_EQ(events[0].sensorId, 3u);
+	EXPECT_EQ(events[0].reset, milliseconds{0});
+	EXPECT_EQ(events[0].deadline, milliseconds{100});
+	EXPECT_TRUE(watchdog.isStale(3u));
+	EXPECT_EQ(watchdog.getArmed(), 0u);
+
+	// Expired timers stay disarmed until reset.
+	EXPECT_EQ(advance(1000), 0u);
+}
+
+TEST_F(TMP116_TestWatchdog, resetPostponesExpiry) {
+	ASSERT_TRUE(watchdog.arm(1u, milliseconds{100}, milliseconds{0}));
+	for (int64_t now = 50; now <= 500; now += 50) {
+		EXPECT_EQ(advance(now), 0u);
+		ASSERT_TRUE(watchdog.reset(1u, milliseconds{now}));
+	}
+	EXPECT_EQ(advance(599), 0u);
+	EXPECT_EQ(advance(600), 1u);
+
+	// Reset re-arms an expired timer.
+	EXPECT_TRUE(watchdog.reset(1u, milliseconds{600}));
+	EXPECT_FALSE(watchdog.isStale(1u));
+	EXPECT_EQ(advance(700), 1u);
+}
+
+TEST_F(TMP116_TestWatchdog, rejectsUnknownOrUnarmedSensors) {
+	EXPECT_FALSE(watchdog.arm(16u, milliseconds{100}, milliseconds{0}));
+	EXPECT_FALSE(watchdog.reset(2u, milliseconds{0}));
+
+	ASSERT_TRUE(watchdog.arm(2u, milliseconds{100}, milliseconds{0}));
+	ASSERT_TRUE(watchdog.disarm(2u));
+	EXPECT_EQ(watchdog.getArmed(), 0u);
+	EXPECT_EQ(advance(1000), 0u);
+	EXPECT_FALSE(watchdog.reset(2u, milliseconds{1000}));
+}
+
+TEST_F(TMP116_TestWatchdog, timeoutFollowsConversionPeriod) {
+	Config config{};
+	config.conversionCycleTime = Config::ConversionCycleTime::CONV_125MS;
+	config.averages			   = Config::Averages::AVG_32; // Lengthens the period to 500ms.
+	ASSERT_TRUE(watchdog.arm(0u, config, milliseconds{0}));
+
+	EXPECT_EQ(advance(504), 0u);
+	EXPECT_EQ(advance(505), 1u); // The period and the default grace of 5ms.
+}
+
+TEST_F(TMP116_TestWatchdog, expiresTimersAcrossLevels) {
+	// Timeouts spanning the first three levels of the wheel, each expiring exactly on its tick.
+	const int64_t timeouts[] = {1, 255, 256, 257, 1000, 65535, 65536, 70000, 1'000'000};
+	for (size_t i = 0u; i < std::size(timeouts); i++)
+		ASSERT_TRUE(watchdog.arm(static_cast<TMP116::SensorId>(i), milliseconds{timeouts[i]}, milliseconds{0}));
+
+	for (size_t i = 0u; i < std::size(timeouts); i++) {
+		EXPECT_EQ(advance(timeouts[i] - 1), 0u);
+		EXPECT_EQ(advance(timeouts[i]), 1u);
+		ASSERT_EQ(events.size(), i + 1u);
+		EXPECT_EQ(events.back().sensorId, i);
+	}
+}
+
+TEST_F(TMP116_TestWatchdog, matchesReferenceUnderRandomResets) {
+	Watchdog			 wheel{256u, microseconds{0}};
+	std::vector<int64_t> deadlines(256u, -1);
+	std::mt19937		 random{1u};
+
+	for (uint16_t sensor = 0u; sensor < 256u; sensor++) {
+		const int64_t timeout = 1 + static_cast<int64_t>(random() % 5000u);
+		wheel.arm(sensor, milliseconds{timeout}, milliseconds{0});
+		deadlines[sensor] = timeout;
+	}
+
+	for (int64_t now = 1; now <= 20000; now++) {
+		wheel.advance(milliseconds{now}, [&deadlines, now](const Event &event) {
+			EXPECT_EQ(deadlines[event.sensorId], now);
+			deadlines[event.sensorId] = -1;
+		});
+		for (const auto deadline : deadlines) EXPECT_TRUE(deadline < 0 || deadline > now);
+
+		// Successful reads of random sensors, each re-arming with a new timeout.
+		for (int i = 0; i < 4; i++) {
+			const auto	  sensor  = static_cast<uint16_t>(random() % 256u);
+			const int64_t timeout = 1 + static_cast<int64_t>(random() % 5000u);
+			wheel.arm(sensor, milliseconds{timeout}, milliseconds{now});
+			deadlines[sensor] = now + timeout;
+		}
+	}
+}
@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Worker.test.cpp
+ * @brief			: TMP116::Worker Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Worker.hpp"
+
+#include "gtest/gtest.h"
+
+using BusModel	 = TMP116::BusModel;
+using Config	 = TMP116::Config;
+using PollPolicy = TMP116::BusModel::PollPolicy;
+using Register	 = TMP116::Register;
+using Scheduler	 = TMP116::Scheduler;
+using Worker	 = TMP116::Worker;
+using std::chrono::microseconds;
+
+class WorkerFakeI2C : public TMP116::I2C {
+public:
+	std::optional<Register> read(DeviceAddress, MemoryAddress) override { return Register{0x0C80u}; }
+	std::optional<Register> write(DeviceAddress, MemoryAddress, Register data) override { return data; }
+};
+
+class TMP116_TestWorker : public ::testing::Test {
+public:
+	WorkerFakeI2C fakeI2C{};
+	BusModel	  model{400'000u};
+	Scheduler	  scheduler{model};
+	TMP116		  tmp116{fakeI2C, TMP116::DeviceAddress::ADD0_GND};
+
+	void SetUp() override {
+		PollPolicy policy{};
+		policy.config.conversionCycleTime = Config::ConversionCycleTime::CONV_15_5MS;
+		policy.config.averages			  = Config::Averages::AVG_1;
+		ASSERT_TRUE(scheduler.addSensor(7u, tmp116, policy, std::nullopt, Worker::now()).has_value());
+	}
+};
+
+TEST_F(TMP116_TestWorker, nowIsMonotonic) {
+	const auto first  = Worker::now();
+	const auto second = Worker::now();
+	EXPECT_GE(second, first);
+}
+
+TEST_F(TMP116_TestWorker, acquiresSamplesIntoRingAndRecordsJitter) {
+	Worker::Options options{};
+	options.capacity = 64u;
+	Worker worker{scheduler, options};
+
+	ASSERT_TRUE(worker.start());
+	EXPECT_TRUE(worker.isRunning());
+	EXPECT_FALSE(worker.start());
+
+	std::this_thread::sleep_for(std::chrono::milliseconds{100});
+	worker.stop();
+	EXPECT_FALSE(worker.isRunning());
+
+	TMP116::Sample samples[64]{};
+	const size_t   count = worker.getSamples().pop(samples, 64u);
+	ASSERT_GE(count, 2u);
+	EXPECT_EQ(samples[0].sensorId, 7u);
+	EXPECT_FLOAT_EQ(samples[0].getTemperature(), 25.0f);
+	EXPECT_GT(samples[1].timestamp, samples[0].timestamp);
+
+	EXPECT_EQ(worker.getJitter().getCount(), count + worker.getOverruns());
+	EXPECT_GE(worker.getJitter().getMin(), microseconds{0});
+}
+
+TEST_F(TMP116_TestWorker, startFailsWhenRealTimePolicyCannotBeApplied) {
+	Worker::Options options{};
+	options.realTime   = true;
+	options.lockMemory = false;
+	options.priority   = 1'000; // Outside of the SCHED_FIFO priority range.
+	Worker worker{scheduler, options};
+
+	EXPECT_FALSE(worker.start());
+	EXPECT_FALSE(worker.isRunning());
+}
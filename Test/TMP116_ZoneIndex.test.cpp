@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_ZoneIndex.test.cpp
+ * @brief			: TMP116::ZoneIndex Tests
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_ZoneIndex.hpp"
+
+#include "gtest/gtest.h"
+
+using ZoneIndex = TMP116::ZoneIndex;
+using SensorId	= TMP116::SensorId;
+using std::chrono::seconds;
+
+class TMP116_TestZoneIndex : public ::testing::Test {
+public:
+	ZoneIndex index{10u};
+
+	void update(SensorId sensorId, int16_t raw) {
+		EXPECT_TRUE(index.update(TMP116::Sample{sensorId, seconds{0}, static_cast<TMP116::Register>(raw)}));
+	}
+};
+
+TEST_F(TMP116_TestZoneIndex, getRangeAggregatesValidSensors) {
+	EXPECT_EQ(index.getRange(0u, 9u), std::nullopt);
+
+	update(1u, 100);
+	update(4u, -50);
+	update(7u, 300);
+
+	const auto all = index.getRange(0u, 9u);
+	ASSERT_TRUE(all.has_value());
+	EXPECT_EQ(all->count, 3u);
+	EXPECT_EQ(all->max, 300);
+	EXPECT_EQ(all->argMax, 7u);
+	EXPECT_EQ(all->min, -50);
+	EXPECT_EQ(all->argMin, 4u);
+	EXPECT_FLOAT_EQ(all->getMean(), 350.0f / 3.0f * 0.0078125f);
+
+	const auto part = index.getRange(2u, 5u);
+	ASSERT_TRUE(part.has_value());
+	EXPECT_EQ(part->count, 1u);
+	EXPECT_EQ(part->max, -50);
+
+	EXPECT_EQ(index.getRange(5u, 6u), std::nullopt);
+	EXPECT_EQ(index.getRange(5u, 10u), std::nullopt);
+	EXPECT_FALSE(index.update(TMP116::Sample{10u, seconds{0}, 0u}));
+}
+
+TEST_F(TMP116_TestZoneIndex, zonesTrackUpdatesAndInvalidation) {
+	const auto rack = index.addZone(0u, 4u);
+	const auto row	= index.addZone(0u, 9u);
+	ASSERT_TRUE(rack.has_value());
+	ASSERT_TRUE(row.has_value());
+	EXPECT_EQ(index.addZone(5u, 4u), std::nullopt);
+
+	update(2u, 10);
+	update(8u, 20);
+	EXPECT_EQ(index.getZone(rack.value())->max, 10);
+	EXPECT_EQ(index.getZone(row.value())->max, 20);
+
+	update(2u, 30);
+	EXPECT_EQ(index.getZone(row.value())->argMax, 2u);
+
+	EXPECT_TRUE(index.invalidate(2u));
+	EXPECT_EQ(index.getZone(rack.value()), std::nullopt);
+	EXPECT_EQ(index.getZone(row.value())->max, 20);
+	EXPECT_EQ(index.getZone(5u), std::nullopt);
+}
+
+TEST_F(TMP116_TestZoneIndex, getHottestReturnsSensorsInDescendingOrder) {
+	const int16_t values[] = {5, 90, -3, 40, 70, 0, 12, 88, 1, 60};
+	for (SensorId sensor = 0u; sensor < 10u; sensor++) update(sensor, values[sensor]);
+	index.invalidate(1u);
+
+	SensorId hottest[4]{};
+	ASSERT_EQ(index.getHottest(hottest, 4u), 4u);
+	EXPECT_EQ(hottest[0], 7u);
+	EXPECT_EQ(hottest[1], 4u);
+	EXPECT_EQ(hottest[2], 9u);
+	EXPECT_EQ(hottest[3], 3u);
+
+	ZoneIndex empty{3u};
+	EXPECT_EQ(empty.getHottest(hottest, 4u), 0u);
+}
@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_Backfill.cpp
+ * @brief			: Command line tool reprocessing sample log segments with TMP116::Backfill
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_Backfill.hpp"
+#include "TMP116_Formatter.hpp"
+#include "TMP116_ThreadPool.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using Backfill = TMP116::Backfill;
+using Level	   = TMP116::Backfill::Level;
+
+static void usage(const char *program) {
+	std::fprintf(
+		stderr,
+		"Usage: %s [options] segment...\n"
+		"  --threads N            Threads of the pool (default: hardware threads)\n"
+		"  --low C                Low limit in degrees Celsius\n"
+		"  --high C               High limit in degrees Celsius\n"
+		"  --interval S           Rollup interval in seconds (default: 60)\n"
+		"  --shard-hours H        Time window of each shard in hours (default: 24)\n"
+		"  --sensors-per-shard N  Sensor identifiers in each shard (default: 64)\n"
+		"  --scaling              Run with 1, 2, 4... threads, reporting speedup instead of results\n",
+		program
+	);
+}
+
+static int16_t toRaw(double temperature) {
+	const double raw = std::round(temperature / TMP116::TEMPERATURE_RESOLUTION);
+	return static_cast<int16_t>(std::fmax(-32768.0, std::fmin(32767.0, raw)));
+}
+
+static const char *toString(Level level) {
+	switch (level) {
+	case Level::LOW:
+		return "low";
+	case Level::HIGH:
+		return "high";
+	default:
+		return "normal";
+	}
+}
+
+static bool identical(const Backfill::Result &a, const Backfill::Result &b) {
+	if (a.alerts.size() != b.alerts.size() || a.aggregates.size() != b.aggregates.size()) return false;
+	for (size_t i = 0u; i < a.alerts.size(); i++) {
+		const auto &x = a.alerts[i], &y = b.alerts[i];
+		if (x.sensorId != y.sensorId || x.timestamp != y.timestamp || x.raw != y.raw || x.level != y.level) return false;
+	}
+	for (size_t i = 0u; i < a.aggregates.size(); i++) {
+		const auto &x = a.aggregates[i], &y = b.aggregates[i];
+		if (x.sensorId != y.sensorId || x.bucket.start != y.bucket.start || x.bucket.count != y.bucket.count ||
+			x.bucket.sum != y.bucket.sum || x.bucket.min != y.bucket.min || x.bucket.max != y.bucket.max ||
+			x.bucket.last != y.bucket.last)
+			return false;
+	}
+	return true;
+}
+
+static void print(const Backfill::Result &result) {
+	char min[TMP116::Formatter::MAX_LENGTH + 1u]{}, max[TMP116::Formatter::MAX_LENGTH + 1u]{};
+
+	std::printf("alert,sensor,timestamp_us,temperature,level\n");
+	for (const auto &alert : result.alerts) {
+		min[TMP116::Formatter::format(alert.raw, min, 4u)] = '\0';
+		std::printf(
+			"alert,%u,%lld,%s,%s\n",
+			unsigned{alert.sensorId},
+			static_cast<long long>(alert.timestamp.count()),
+			min,
+			toString(alert.level)
+		);
+	}
+
+	std::printf("rollup,sensor,start_us,min,max,mean,count\n");
+	for (const auto &aggregate : result.aggregates) {
+		const auto &bucket = aggregate.bucket;
+		min[TMP116::Formatter::format(static_cast<TMP116::Register>(bucket.min), min, 4u)] = '\0';
+		max[TMP116::Formatter::format(static_cast<TMP116::Register>(bucket.max), max, 4u)] = '\0';
+		std::printf(
+			"rollup,%u,%lld,%s,%s,%.4f,%u\n",
+			unsigned{aggregate.sensorId},
+			static_cast<long long>(bucket.start.count()),
+			min,
+			max,
+			static_cast<double>(bucket.getMean()),
+			bucket.count
+		);
+	}
+}
+
+static void report(const Backfill::Result &result, size_t threads) {
+	const double seconds = static_cast<double>(result.elapsed.count()) / 1e6;
+	std::fprintf(
+		stderr,
+		"threads %zu: %llu samples, %llu dropped, %zu shards, %llu steals, %.3f s, %.0f samples/s\n",
+		threads,
+		static_cast<unsigned long long>(result.samples),
+		static_cast<unsigned long long>(result.dropped),
+		result.shards,
+		static_cast<unsigned long long>(result.steals),
+		seconds,
+		seconds > 0.0 ? static_cast<double>(result.samples) / seconds : 0.0
+	);
+}
+
+int main(int argc, char **argv) {
+	Backfill::Options		 options{};
+	std::vector<std::string> paths{};
+	size_t					 threads = std::thread::hardware_concurrency();
+	bool					 scaling = false;
+
+	for (int i = 1; i < argc; i++) {
+		const char *argument = argv[i];
+		const bool	value	 = i + 1 < argc;
+		if (std::strcmp(argument, "--threads") == 0 && value) threads = std::strtoul(argv[++i], nullptr, 10);
+		else if (std::strcmp(argument, "--low") == 0 && value) options.lowLimit = toRaw(std::atof(argv[++i]));
+		else if (std::strcmp(argument, "--high") == 0 && value) options.highLimit = toRaw(std::atof(argv[++i]));
+		else if (std::strcmp(argument, "--interval") == 0 && value)
+			options.rollupInterval = std::chrono::seconds{std::atoll(argv[++i])};
+		else if (std::strcmp(argument, "--shard-hours") == 0 && value)
+			options.shardDuration = std::chrono::hours{std::atoll(argv[++i])};
+		else if (std::strcmp(argument, "--sensors-per-shard") == 0 && value)
+			options.sensorsPerShard = static_cast<TMP116::SensorId>(std::strtoul(argv[++i], nullptr, 10));
+		else if (std::strcmp(argument, "--scaling") == 0) scaling = true;
+		else if (argument[0] == '-') {
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		} else paths.emplace_back(argument);
+	}
+	if (paths.empty()) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	if (threads == 0u) threads = 1u;
+
+	Backfill backfill{paths, options};
+	if (!backfill.open()) std::fprintf(stderr, "warning: some segments could not be opened\n");
+
+	if (!scaling) {
+		TMP116::ThreadPool pool{threads};
+		const auto		   result = backfill.run(pool);
+		print(result);
+		report(result, threads);
+		return EXIT_SUCCESS;
+	}
+
+	Backfill::Result baseline{};
+	for (size_t count = 1u;; count = std::min(count * 2u, threads)) {
+		TMP116::ThreadPool pool{count};
+		const auto		   result = backfill.run(pool);
+		report(result, count);
+
+		if (count == 1u) baseline = result;
+		else {
+			const double speedup = static_cast<double>(baseline.elapsed.count()) /
+								   static_cast<double>(std::max<int64_t>(result.elapsed.count(), 1));
+			std::fprintf(stderr, "  speedup %.2fx, efficiency %.0f%%\n", speedup, 100.0 * speedup / count);
+			if (!identical(baseline, result)) {
+				std::fprintf(stderr, "error: results differ from a single thread\n");
+				return EXIT_FAILURE;
+			}
+		}
+		if (count == threads) break;
+	}
+	return EXIT_SUCCESS;
+}
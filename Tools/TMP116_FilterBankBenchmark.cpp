@@ -0,0 +1,64 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_FilterBankBenchmark.cpp
+ * @brief			: Benchmark of the channel throughput of TMP116::FilterBank
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_FilterBank.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+using Biquad	 = TMP116::FilterBank::Biquad;
+using FilterBank = TMP116::FilterBank;
+
+/**
+ * @brief Filter frames of all channels for a time, and report the frames and samples filtered per second on one core.
+ */
+static void benchmark(const char *name, FilterBank &bank, double seconds) {
+	const size_t				  channels = bank.getChannels();
+	std::vector<TMP116::Register> raw(channels);
+	std::vector<float>			  output(channels);
+	std::mt19937				  random{1u};
+	for (auto &value : raw) value = static_cast<TMP116::Register>(3200u + random() % 64u);
+
+	const auto start  = std::chrono::steady_clock::now();
+	uint64_t   frames = 0u;
+	double	   elapsed;
+	do {
+		for (int i = 0; i < 64; i++) bank.process(raw.data(), output.data());
+		frames += 64u;
+		elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	} while (elapsed < seconds);
+
+	const double rate = static_cast<double>(frames) * static_cast<double>(channels) / elapsed;
+	std::printf("%-16s %9zu %12.0f %14.0f\n", name, channels, static_cast<double>(frames) / elapsed, rate);
+}
+
+int main(int argc, char **argv) {
+	size_t channels = 4096u;
+	double seconds	= 1.0;
+
+	for (int i = 1; i < argc; i++) {
+		const bool value = i + 1 < argc;
+		if (std::strcmp(argv[i], "--channels") == 0 && value) channels = std::strtoul(argv[++i], nullptr, 10);
+		else if (std::strcmp(argv[i], "--seconds") == 0 && value) seconds = std::atof(argv[++i]);
+		else {
+			std::fprintf(stderr, "Usage: %s [--channels N] [--seconds S]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	FilterBank fir{channels, std::vector<float>(16u, 1.0f / 16.0f)};
+	FilterBank iir{channels, std::vector<Biquad>{Biquad::lowPass(0.5f, 8.0f), Biquad::lowPass(0.5f, 8.0f)}};
+
+	std::printf("filter            channels     frames/s      samples/s\n");
+	benchmark("fir 16 taps", fir, seconds);
+	benchmark("biquad x2", iir, seconds);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,122 @@
+/**
+ ******************************************************************************
+ * @file			: TMP116_GroupCommitBenchmark.cpp
+ * @brief			: Benchmark of throughput against commit latency of TMP116::GroupCommitWriter
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "TMP116_GroupCommit.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <unistd.h>
+
+using GroupCommitWriter = TMP116::GroupCommitWriter;
+using Duration			= TMP116::Duration;
+
+struct Configuration {
+	size_t	 batchSize;
+	Duration maxDelay;
+};
+
+/**
+ * @brief Run producers appending batches of 16 samples at a rate for a time, and report the commits.
+ *
+ * @param rate The samples per second of each producer, or 0 to append as fast as possible.
+ */
+static void benchmark(
+	const std::string	&path,
+	const Configuration &configuration,
+	size_t				 producers,
+	uint64_t			 rate,
+	Duration			 length
+) {
+	GroupCommitWriter::Options options{};
+	options.batchSize = configuration.batchSize;
+	options.maxDelay  = configuration.maxDelay;
+	options.capacity  = std::max<size_t>(4u * configuration.batchSize, 65536u);
+
+	GroupCommitWriter writer{path, options};
+	if (!writer.start()) {
+		std::fprintf(stderr, "error: cannot open %s\n", path.c_str());
+		std::exit(EXIT_FAILURE);
+	}
+
+	std::atomic<bool>		 stop{false};
+	std::vector<std::thread> threads{};
+	const auto				 start = std::chrono::steady_clock::now();
+	for (size_t producer = 0u; producer < producers; producer++) {
+		threads.emplace_back([&writer, &stop, &start, producer, rate]() {
+			TMP116::Sample samples[16]{};
+			for (int64_t time = 0; !stop.load(std::memory_order_relaxed); time++) {
+				for (auto &sample : samples) sample = {static_cast<TMP116::SensorId>(producer), Duration{time}, 0u};
+				if (!writer.append(samples, 16u)) std::this_thread::yield();
+				if (rate > 0u) std::this_thread::sleep_until(start + Duration{(time + 1) * 16 * 1'000'000 / rate});
+			}
+		});
+	}
+
+	std::this_thread::sleep_for(length);
+	stop.store(true);
+	for (auto &thread : threads) thread.join();
+	writer.flush();
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	const auto statistics = writer.getStatistics();
+	const auto latency	  = writer.getCommitLatency();
+	writer.stop();
+	unlink(path.c_str());
+
+	std::printf(
+		"%9zu %9lld %12.0f %9llu %10.1f %9lld %9lld %9lld\n",
+		configuration.batchSize,
+		static_cast<long long>(configuration.maxDelay.count()),
+		static_cast<double>(statistics.samples) / seconds,
+		static_cast<unsigned long long>(statistics.commits),
+		statistics.commits > 0u ? static_cast<double>(statistics.samples) / static_cast<double>(statistics.commits) : 0.0,
+		static_cast<long long>(latency.getPercentile(0.5f).count()),
+		static_cast<long long>(latency.getPercentile(0.99f).count()),
+		static_cast<long long>(latency.getMax().count())
+	);
+}
+
+int main(int argc, char **argv) {
+	std::string directory = "/tmp";
+	size_t		producers = 4u;
+	uint64_t	rate	  = 0u;
+	Duration	length	  = std::chrono::seconds{2};
+
+	for (int i = 1; i < argc; i++) {
+		const bool value = i + 1 < argc;
+		if (std::strcmp(argv[i], "--directory") == 0 && value) directory = argv[++i];
+		else if (std::strcmp(argv[i], "--producers") == 0 && value) producers = std::strtoul(argv[++i], nullptr, 10);
+		else if (std::strcmp(argv[i], "--rate") == 0 && value) rate = std::strtoull(argv[++i], nullptr, 10);
+		else if (std::strcmp(argv[i], "--seconds") == 0 && value)
+			length = std::chrono::seconds{std::atoll(argv[++i])};
+		else {
+			std::fprintf(
+				stderr, "Usage: %s [--directory D] [--producers N] [--rate SAMPLES_PER_S] [--seconds S]\n", argv[0]
+			);
+			return EXIT_FAILURE;
+		}
+	}
+
+	const std::string path = directory + "/TMP116_GroupCommitBenchmark." + std::to_string(getpid()) + ".seg";
+	const Configuration configurations[] = {
+		{16u, std::chrono::microseconds{100}},
+		{256u, std::chrono::milliseconds{1}},
+		{4096u, std::chrono::milliseconds{10}},
+		{65536u, std::chrono::milliseconds{100}},
+	};
+
+	std::printf("Group commit with %zu producers", producers);
+	if (rate > 0u) std::printf(" of %llu samples/s each", static_cast<unsigned long long>(rate));
+	std::printf(", latencies in microseconds\n");
+	std::printf("    batch  delay_us    samples/s   commits  mean_size  p50_lat   p99_lat   max_lat\n");
+	for (const auto &configuration : configurations) benchmark(path, configuration, producers, rate, length);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Src/TMP116.cpp" "CMakeFiles/TMP116.dir/Src/TMP116.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116.cpp.o.d"
+  "/root/repo/Src/TMP116_Backfill.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Backfill.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Backfill.cpp.o.d"
+  "/root/repo/Src/TMP116_BusModel.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_BusModel.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_BusModel.cpp.o.d"
+  "/root/repo/Src/TMP116_C.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_C.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_C.cpp.o.d"
+  "/root/repo/Src/TMP116_ChangePublisher.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_ChangePublisher.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_ChangePublisher.cpp.o.d"
+  "/root/repo/Src/TMP116_ColumnarExporter.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_ColumnarExporter.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_ColumnarExporter.cpp.o.d"
+  "/root/repo/Src/TMP116_Compactor.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Compactor.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Compactor.cpp.o.d"
+  "/root/repo/Src/TMP116_Estimator.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Estimator.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Estimator.cpp.o.d"
+  "/root/repo/Src/TMP116_FilterBank.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_FilterBank.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_FilterBank.cpp.o.d"
+  "/root/repo/Src/TMP116_Formatter.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Formatter.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Formatter.cpp.o.d"
+  "/root/repo/Src/TMP116_Fusion.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Fusion.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Fusion.cpp.o.d"
+  "/root/repo/Src/TMP116_GroupCommit.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_GroupCommit.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_GroupCommit.cpp.o.d"
+  "/root/repo/Src/TMP116_HealthMonitor.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_HealthMonitor.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_HealthMonitor.cpp.o.d"
+  "/root/repo/Src/TMP116_JitterRecorder.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_JitterRecorder.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_JitterRecorder.cpp.o.d"
+  "/root/repo/Src/TMP116_LatencyTracer.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_LatencyTracer.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_LatencyTracer.cpp.o.d"
+  "/root/repo/Src/TMP116_Pipeline.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Pipeline.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Pipeline.cpp.o.d"
+  "/root/repo/Src/TMP116_Predictor.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Predictor.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Predictor.cpp.o.d"
+  "/root/repo/Src/TMP116_QuantileSketch.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_QuantileSketch.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_QuantileSketch.cpp.o.d"
+  "/root/repo/Src/TMP116_Resampler.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Resampler.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Resampler.cpp.o.d"
+  "/root/repo/Src/TMP116_Rollup.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Rollup.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Rollup.cpp.o.d"
+  "/root/repo/Src/TMP116_Scheduler.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Scheduler.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Scheduler.cpp.o.d"
+  "/root/repo/Src/TMP116_Segment.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Segment.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Segment.cpp.o.d"
+  "/root/repo/Src/TMP116_StreamServer.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_StreamServer.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_StreamServer.cpp.o.d"
+  "/root/repo/Src/TMP116_ThermalMap.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_ThermalMap.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_ThermalMap.cpp.o.d"
+  "/root/repo/Src/TMP116_ThreadPool.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_ThreadPool.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_ThreadPool.cpp.o.d"
+  "/root/repo/Src/TMP116_Watchdog.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Watchdog.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Watchdog.cpp.o.d"
+  "/root/repo/Src/TMP116_Worker.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_Worker.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_Worker.cpp.o.d"
+  "/root/repo/Src/TMP116_ZoneIndex.cpp" "CMakeFiles/TMP116.dir/Src/TMP116_ZoneIndex.cpp.o" "gcc" "CMakeFiles/TMP116.dir/Src/TMP116_ZoneIndex.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,65 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TMP116.dir/Src/TMP116.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Backfill.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Backfill.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_BusModel.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_BusModel.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_C.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_C.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ChangePublisher.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ChangePublisher.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ColumnarExporter.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ColumnarExporter.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Compactor.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Compactor.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Estimator.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Estimator.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_FilterBank.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_FilterBank.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Formatter.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Formatter.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Fusion.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Fusion.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_GroupCommit.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_GroupCommit.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_HealthMonitor.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_HealthMonitor.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_JitterRecorder.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_JitterRecorder.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_LatencyTracer.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_LatencyTracer.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Pipeline.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Pipeline.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Predictor.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Predictor.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_QuantileSketch.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_QuantileSketch.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Resampler.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Resampler.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Rollup.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Rollup.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Scheduler.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Scheduler.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Segment.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Segment.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_StreamServer.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_StreamServer.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ThermalMap.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ThermalMap.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ThreadPool.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ThreadPool.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Watchdog.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Watchdog.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Worker.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_Worker.cpp.o.d"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ZoneIndex.cpp.o"
+  "CMakeFiles/TMP116.dir/Src/TMP116_ZoneIndex.cpp.o.d"
+  "libTMP116.a"
+  "libTMP116.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TMP116.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
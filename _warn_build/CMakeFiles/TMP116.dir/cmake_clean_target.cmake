@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libTMP116.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TMP116_Backfill.dir/Tools/TMP116_Backfill.cpp.o"
+  "CMakeFiles/TMP116_Backfill.dir/Tools/TMP116_Backfill.cpp.o.d"
+  "TMP116_Backfill"
+  "TMP116_Backfill.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TMP116_Backfill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
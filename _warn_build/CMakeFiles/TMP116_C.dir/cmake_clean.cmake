@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TMP116_C.dir/Src/TMP116.cpp.o"
+  "CMakeFiles/TMP116_C.dir/Src/TMP116.cpp.o.d"
+  "CMakeFiles/TMP116_C.dir/Src/TMP116_C.cpp.o"
+  "CMakeFiles/TMP116_C.dir/Src/TMP116_C.cpp.o.d"
+  "libTMP116_C.pdb"
+  "libTMP116_C.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TMP116_C.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
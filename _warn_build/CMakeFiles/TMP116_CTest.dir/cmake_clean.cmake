@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TMP116_CTest.dir/Test/TMP116_C.test.c.o"
+  "CMakeFiles/TMP116_CTest.dir/Test/TMP116_C.test.c.o.d"
+  "TMP116_CTest"
+  "TMP116_CTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/TMP116_CTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TMP116_FilterBankBenchmark.dir/Tools/TMP116_FilterBankBenchmark.cpp.o"
+  "CMakeFiles/TMP116_FilterBankBenchmark.dir/Tools/TMP116_FilterBankBenchmark.cpp.o.d"
+  "TMP116_FilterBankBenchmark"
+  "TMP116_FilterBankBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TMP116_FilterBankBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
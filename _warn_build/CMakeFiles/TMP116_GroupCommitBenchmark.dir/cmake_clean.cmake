@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TMP116_GroupCommitBenchmark.dir/Tools/TMP116_GroupCommitBenchmark.cpp.o"
+  "CMakeFiles/TMP116_GroupCommitBenchmark.dir/Tools/TMP116_GroupCommitBenchmark.cpp.o.d"
+  "TMP116_GroupCommitBenchmark"
+  "TMP116_GroupCommitBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TMP116_GroupCommitBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
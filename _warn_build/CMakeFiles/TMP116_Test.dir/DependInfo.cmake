@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Test/TMP116.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Backfill.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Backfill.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Backfill.test.cpp.o.d"
+  "/root/repo/Test/TMP116_BusModel.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_BusModel.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_BusModel.test.cpp.o.d"
+  "/root/repo/Test/TMP116_C.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_C.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_C.test.cpp.o.d"
+  "/root/repo/Test/TMP116_ChangePublisher.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_ChangePublisher.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_ChangePublisher.test.cpp.o.d"
+  "/root/repo/Test/TMP116_ColumnarExporter.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_ColumnarExporter.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_ColumnarExporter.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Compactor.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Compactor.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Compactor.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Config.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Config.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Config.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Estimator.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Estimator.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Estimator.test.cpp.o.d"
+  "/root/repo/Test/TMP116_FilterBank.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_FilterBank.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_FilterBank.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Formatter.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Formatter.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Formatter.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Fusion.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Fusion.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Fusion.test.cpp.o.d"
+  "/root/repo/Test/TMP116_GroupCommit.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_GroupCommit.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_GroupCommit.test.cpp.o.d"
+  "/root/repo/Test/TMP116_HealthMonitor.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_HealthMonitor.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_HealthMonitor.test.cpp.o.d"
+  "/root/repo/Test/TMP116_JitterRecorder.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_JitterRecorder.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_JitterRecorder.test.cpp.o.d"
+  "/root/repo/Test/TMP116_LatencyTracer.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_LatencyTracer.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_LatencyTracer.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Pipeline.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Pipeline.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Pipeline.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Predictor.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Predictor.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Predictor.test.cpp.o.d"
+  "/root/repo/Test/TMP116_QuantileSketch.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_QuantileSketch.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_QuantileSketch.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Queue.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Queue.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Queue.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Resampler.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Resampler.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Resampler.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Ring.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Ring.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Ring.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Rollup.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Rollup.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Rollup.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Scheduler.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Scheduler.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Scheduler.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Segment.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Segment.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Segment.test.cpp.o.d"
+  "/root/repo/Test/TMP116_StreamServer.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_StreamServer.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_StreamServer.test.cpp.o.d"
+  "/root/repo/Test/TMP116_ThermalMap.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_ThermalMap.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_ThermalMap.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Watchdog.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Watchdog.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Watchdog.test.cpp.o.d"
+  "/root/repo/Test/TMP116_Worker.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Worker.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_Worker.test.cpp.o.d"
+  "/root/repo/Test/TMP116_ZoneIndex.test.cpp" "CMakeFiles/TMP116_Test.dir/Test/TMP116_ZoneIndex.test.cpp.o" "gcc" "CMakeFiles/TMP116_Test.dir/Test/TMP116_ZoneIndex.test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/CMakeFiles/TMP116.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
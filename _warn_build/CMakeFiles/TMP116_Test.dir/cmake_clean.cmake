@@ -0,0 +1,70 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Backfill.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Backfill.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_BusModel.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_BusModel.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_C.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_C.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_ChangePublisher.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_ChangePublisher.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_ColumnarExporter.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_ColumnarExporter.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Compactor.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Compactor.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Config.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Config.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Estimator.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Estimator.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_FilterBank.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_FilterBank.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Formatter.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Formatter.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Fusion.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Fusion.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_GroupCommit.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_GroupCommit.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_HealthMonitor.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_HealthMonitor.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_JitterRecorder.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_JitterRecorder.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_LatencyTracer.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_LatencyTracer.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Pipeline.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Pipeline.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Predictor.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Predictor.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_QuantileSketch.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_QuantileSketch.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Queue.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Queue.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Resampler.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Resampler.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Ring.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Ring.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Rollup.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Rollup.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Scheduler.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Scheduler.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Segment.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Segment.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_StreamServer.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_StreamServer.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_ThermalMap.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_ThermalMap.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Watchdog.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Watchdog.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Worker.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_Worker.test.cpp.o.d"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_ZoneIndex.test.cpp.o"
+  "CMakeFiles/TMP116_Test.dir/Test/TMP116_ZoneIndex.test.cpp.o.d"
+  "TMP116_Test"
+  "TMP116_Test.pdb"
+  "TMP116_Test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TMP116_Test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_warn_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_warn_build/TMP116_Test[1]_include.cmake")
+add_test([=[TMP116_CTest]=] "/root/repo/_warn_build/TMP116_CTest")
+set_tests_properties([=[TMP116_CTest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;178;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("_deps/googletest-build")
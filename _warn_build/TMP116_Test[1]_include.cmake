@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/TMP116_Test[1]_tests.cmake")
+  include("/root/repo/_warn_build/TMP116_Test[1]_tests.cmake")
+else()
+  add_test(TMP116_Test_NOT_BUILT TMP116_Test_NOT_BUILT)
+endif()
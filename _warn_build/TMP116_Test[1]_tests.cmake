@@ -0,0 +1,383 @@
+add_test([=[TMP116_TestStatic.convertTemperatureRegisterReturnsCorrectValuesRegisterToFloat]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStatic.convertTemperatureRegisterReturnsCorrectValuesRegisterToFloat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStatic.convertTemperatureRegisterReturnsCorrectValuesRegisterToFloat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStatic.convertTemperatureRegisterReturnsCurrentValuesFloatToRegister]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStatic.convertTemperatureRegisterReturnsCurrentValuesFloatToRegister]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStatic.convertTemperatureRegisterReturnsCurrentValuesFloatToRegister]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getTemperatureNormallyReturnsValue]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getTemperatureNormallyReturnsValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getTemperatureNormallyReturnsValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getTemperatureReturnsAbsoluteZeroWhenI2CReadFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getTemperatureReturnsAbsoluteZeroWhenI2CReadFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getTemperatureReturnsAbsoluteZeroWhenI2CReadFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getDeviceIdNormallyReturnsValue]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getDeviceIdNormallyReturnsValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getDeviceIdNormallyReturnsValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getDeviceIdReturnsNulloptWhenI2CReadFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getDeviceIdReturnsNulloptWhenI2CReadFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getDeviceIdReturnsNulloptWhenI2CReadFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getConfigRegisterNormallyReturnsValue]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getConfigRegisterNormallyReturnsValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getConfigRegisterNormallyReturnsValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getConfigRegisterReturnsNulloptWhenI2CReadFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getConfigRegisterReturnsNulloptWhenI2CReadFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getConfigRegisterReturnsNulloptWhenI2CReadFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getConfigNormallyReturnsValue]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getConfigNormallyReturnsValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getConfigNormallyReturnsValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getConfigReturnsNulloptWhenI2CReadFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getConfigReturnsNulloptWhenI2CReadFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getConfigReturnsNulloptWhenI2CReadFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.dataReadyNormallyReturnsValue]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.dataReadyNormallyReturnsValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.dataReadyNormallyReturnsValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.dataReadyReturnsFalseWhenI2CReadFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.dataReadyReturnsFalseWhenI2CReadFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.dataReadyReturnsFalseWhenI2CReadFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setConfigNormallyReturnsRegisterValue]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setConfigNormallyReturnsRegisterValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setConfigNormallyReturnsRegisterValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setConfigReturnsNulloptWhenI2CWriteFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setConfigReturnsNulloptWhenI2CWriteFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setConfigReturnsNulloptWhenI2CWriteFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setConfigNormallyDirectlyWritesWhenGivenCompleteNewConfiguration]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setConfigNormallyDirectlyWritesWhenGivenCompleteNewConfiguration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setConfigNormallyDirectlyWritesWhenGivenCompleteNewConfiguration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setConfigReturnsNulloptIfGivenNoParameters]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setConfigReturnsNulloptIfGivenNoParameters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setConfigReturnsNulloptIfGivenNoParameters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setConfigSetsOnlyGivenParametersAndOtherwiseMaintainsState]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setConfigSetsOnlyGivenParametersAndOtherwiseMaintainsState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setConfigSetsOnlyGivenParametersAndOtherwiseMaintainsState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setConfigWillNotWriteIfConfigIsUnchangedAndWillReturnCurrentConfig]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setConfigWillNotWriteIfConfigIsUnchangedAndWillReturnCurrentConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setConfigWillNotWriteIfConfigIsUnchangedAndWillReturnCurrentConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setConfigReturnsNulloptWhenI2CFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setConfigReturnsNulloptWhenI2CFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setConfigReturnsNulloptWhenI2CFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setHighLimitNormallyReturnsRegisterValue]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setHighLimitNormallyReturnsRegisterValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setHighLimitNormallyReturnsRegisterValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setHighLimitReturnsNulloptWhenI2CWriteFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setHighLimitReturnsNulloptWhenI2CWriteFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setHighLimitReturnsNulloptWhenI2CWriteFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setLowLimitNormallyReturnsRegisterValue]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setLowLimitNormallyReturnsRegisterValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setLowLimitNormallyReturnsRegisterValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.setLowLimitReturnsNulloptWhenI2CWriteFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.setLowLimitReturnsNulloptWhenI2CWriteFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.setLowLimitReturnsNulloptWhenI2CWriteFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getTemperatureRegisterNormallyReturnsValue]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getTemperatureRegisterNormallyReturnsValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getTemperatureRegisterNormallyReturnsValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_Test.getTemperatureRegisterReturnsNulloptWhenI2CReadFails]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_Test.getTemperatureRegisterReturnsNulloptWhenI2CReadFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_Test.getTemperatureRegisterReturnsNulloptWhenI2CReadFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSample.getTemperatureConvertsRawRegister]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSample.getTemperatureConvertsRawRegister]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSample.getTemperatureConvertsRawRegister]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestConfig.constructorDecodesRegisterSampleTestCases]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestConfig.constructorDecodesRegisterSampleTestCases]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestConfig.constructorDecodesRegisterSampleTestCases]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestConfig.constructorMapsAlternativeContinuosConversionMode]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestConfig.constructorMapsAlternativeContinuosConversionMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestConfig.constructorMapsAlternativeContinuosConversionMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestConfig.constructorDefaultConstructsToDeviceFactoryDefaultConfig]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestConfig.constructorDefaultConstructsToDeviceFactoryDefaultConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestConfig.constructorDefaultConstructsToDeviceFactoryDefaultConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestConfig.configImplicitTypeCastsToRegister]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestConfig.configImplicitTypeCastsToRegister]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestConfig.configImplicitTypeCastsToRegister]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestConfig.getConversionPeriodReturnsCycleTimeOrActiveConversionTime]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestConfig.getConversionPeriodReturnsCycleTimeOrActiveConversionTime]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestConfig.getConversionPeriodReturnsCycleTimeOrActiveConversionTime]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestConfig.getAverageCountDecodesAverages]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestConfig.getAverageCountDecodesAverages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestConfig.getAverageCountDecodesAverages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusModel.getClockCyclesReturnsTransactionShapes]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusModel.getClockCyclesReturnsTransactionShapes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusModel.getClockCyclesReturnsTransactionShapes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusModel.getTransactionTimeScalesWithClockFrequency]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusModel.getTransactionTimeScalesWithClockFrequency]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusModel.getTransactionTimeScalesWithClockFrequency]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusModel.zeroClockFrequencyIsClamped]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusModel.zeroClockFrequencyIsClamped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusModel.zeroClockFrequencyIsClamped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusModel.pollPolicyPeriodIsNeverFasterThanConversionPeriod]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusModel.pollPolicyPeriodIsNeverFasterThanConversionPeriod]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusModel.pollPolicyPeriodIsNeverFasterThanConversionPeriod]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusModel.getOccupancyIncludesDataReadyPolling]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusModel.getOccupancyIncludesDataReadyPolling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusModel.getOccupancyIncludesDataReadyPolling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusModel.admitAcceptsPolicyWithinBudget]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusModel.admitAcceptsPolicyWithinBudget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusModel.admitAcceptsPolicyWithinBudget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusModel.admitDegradesPolicyExceedingBudget]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusModel.admitDegradesPolicyExceedingBudget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusModel.admitDegradesPolicyExceedingBudget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusModel.admitRejectsPolicyWhenBudgetExhausted]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusModel.admitRejectsPolicyWhenBudgetExhausted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusModel.admitRejectsPolicyWhenBudgetExhausted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusMonitor.countsAndForwardsTransactions]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusMonitor.countsAndForwardsTransactions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusMonitor.countsAndForwardsTransactions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBusMonitor.getOccupancyErrorComparesAgainstModel]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBusMonitor.getOccupancyErrorComparesAgainstModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBusMonitor.getOccupancyErrorComparesAgainstModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestScheduler.addSensorWritesAdmittedConfig]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestScheduler.addSensorWritesAdmittedConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestScheduler.addSensorWritesAdmittedConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestScheduler.addSensorFailsWhenConfigCannotBeWritten]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestScheduler.addSensorFailsWhenConfigCannotBeWritten]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestScheduler.addSensorFailsWhenConfigCannotBeWritten]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestScheduler.addSensorRejectsPolicyExceedingBusBudget]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestScheduler.addSensorRejectsPolicyExceedingBusBudget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestScheduler.addSensorRejectsPolicyExceedingBusBudget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestScheduler.pollReadsEarliestDeadlineFirst]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestScheduler.pollReadsEarliestDeadlineFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestScheduler.pollReadsEarliestDeadlineFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestScheduler.pollWaitsForNextRelease]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestScheduler.pollWaitsForNextRelease]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestScheduler.pollWaitsForNextRelease]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestScheduler.pollRecordsSlackAndDeadlineMisses]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestScheduler.pollRecordsSlackAndDeadlineMisses]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestScheduler.pollRecordsSlackAndDeadlineMisses]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestScheduler.pollCountsFailedReadsAndRetriesJob]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestScheduler.pollCountsFailedReadsAndRetriesJob]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestScheduler.pollCountsFailedReadsAndRetriesJob]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestScheduler.pollWaitsForDataReadyWhenPolicyRequires]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestScheduler.pollWaitsForDataReadyWhenPolicyRequires]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestScheduler.pollWaitsForDataReadyWhenPolicyRequires]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestRing.capacityIsRoundedUpToPowerOfTwo]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestRing.capacityIsRoundedUpToPowerOfTwo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestRing.capacityIsRoundedUpToPowerOfTwo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestRing.popReturnsElementsInOrder]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestRing.popReturnsElementsInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestRing.popReturnsElementsInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestRing.pushFailsWhenFull]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestRing.pushFailsWhenFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestRing.pushFailsWhenFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestRing.bulkPopDrainsAvailableElementsAcrossWrap]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestRing.bulkPopDrainsAvailableElementsAcrossWrap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestRing.bulkPopDrainsAvailableElementsAcrossWrap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestQueue.capacityIsRoundedUpToPowerOfTwo]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestQueue.capacityIsRoundedUpToPowerOfTwo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestQueue.capacityIsRoundedUpToPowerOfTwo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestQueue.popReturnsElementsInOrderAcrossWrap]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestQueue.popReturnsElementsInOrderAcrossWrap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestQueue.popReturnsElementsInOrderAcrossWrap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestQueue.pushFailsWhenFull]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestQueue.pushFailsWhenFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestQueue.pushFailsWhenFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestJitterRecorder.recordsLatenessIntoLogarithmicBuckets]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestJitterRecorder.recordsLatenessIntoLogarithmicBuckets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestJitterRecorder.recordsLatenessIntoLogarithmicBuckets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestJitterRecorder.getPercentileReturnsBucketUpperBound]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestJitterRecorder.getPercentileReturnsBucketUpperBound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestJitterRecorder.getPercentileReturnsBucketUpperBound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestJitterRecorder.resetClearsAllReads]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestJitterRecorder.resetClearsAllReads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestJitterRecorder.resetClearsAllReads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestRollup.ingestAggregatesAtEachResolution]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestRollup.ingestAggregatesAtEachResolution]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestRollup.ingestAggregatesAtEachResolution]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestRollup.sensorsAreAggregatedIndependently]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestRollup.sensorsAreAggregatedIndependently]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestRollup.sensorsAreAggregatedIndependently]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestRollup.bucketsAreRecycledAsTimeAdvances]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestRollup.bucketsAreRecycledAsTimeAdvances]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestRollup.bucketsAreRecycledAsTimeAdvances]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestRollup.getBucketsReturnsRetainedBucketsInRange]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestRollup.getBucketsReturnsRetainedBucketsInRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestRollup.getBucketsReturnsRetainedBucketsInRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestQuantileSketch.getQuantileIsExactAtUnitBucketWidth]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestQuantileSketch.getQuantileIsExactAtUnitBucketWidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestQuantileSketch.getQuantileIsExactAtUnitBucketWidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestQuantileSketch.negativeTemperaturesAreOrderedBelowPositive]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestQuantileSketch.negativeTemperaturesAreOrderedBelowPositive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestQuantileSketch.negativeTemperaturesAreOrderedBelowPositive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestQuantileSketch.compressesByCoarseningWhenBucketLimitExceeded]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestQuantileSketch.compressesByCoarseningWhenBucketLimitExceeded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestQuantileSketch.compressesByCoarseningWhenBucketLimitExceeded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestQuantileSketch.keepsNegativeValuesBelowZeroAtTheMaximumShift]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestQuantileSketch.keepsNegativeValuesBelowZeroAtTheMaximumShift]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestQuantileSketch.keepsNegativeValuesBelowZeroAtTheMaximumShift]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestQuantileSketch.mergeCombinesSketchesOfDifferentWidths]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestQuantileSketch.mergeCombinesSketchesOfDifferentWidths]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestQuantileSketch.mergeCombinesSketchesOfDifferentWidths]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSlidingQuantileSketch.getWindowMergesOnlyCurrentSubWindows]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSlidingQuantileSketch.getWindowMergesOnlyCurrentSubWindows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSlidingQuantileSketch.getWindowMergesOnlyCurrentSubWindows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSlidingQuantileSketch.windowsBeforeTheEpochStartAtTheirFloor]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSlidingQuantileSketch.windowsBeforeTheEpochStartAtTheirFloor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSlidingQuantileSketch.windowsBeforeTheEpochStartAtTheirFloor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestZoneIndex.getRangeAggregatesValidSensors]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestZoneIndex.getRangeAggregatesValidSensors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestZoneIndex.getRangeAggregatesValidSensors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestZoneIndex.zonesTrackUpdatesAndInvalidation]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestZoneIndex.zonesTrackUpdatesAndInvalidation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestZoneIndex.zonesTrackUpdatesAndInvalidation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestZoneIndex.getHottestReturnsSensorsInDescendingOrder]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestZoneIndex.getHottestReturnsSensorsInDescendingOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestZoneIndex.getHottestReturnsSensorsInDescendingOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestChangePublisher.publishesFirstSampleAndChangesBeyondDeadband]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestChangePublisher.publishesFirstSampleAndChangesBeyondDeadband]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestChangePublisher.publishesFirstSampleAndChangesBeyondDeadband]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestChangePublisher.publishesHeartbeatWhenIntervalExpires]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestChangePublisher.publishesHeartbeatWhenIntervalExpires]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestChangePublisher.publishesHeartbeatWhenIntervalExpires]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestChangePublisher.deadbandIsPerSensor]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestChangePublisher.deadbandIsPerSensor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestChangePublisher.deadbandIsPerSensor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFormatter.formatIsExactWithSevenDecimals]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFormatter.formatIsExactWithSevenDecimals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFormatter.formatIsExactWithSevenDecimals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFormatter.formatRoundsHalfAwayFromZero]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFormatter.formatRoundsHalfAwayFromZero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFormatter.formatRoundsHalfAwayFromZero]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFormatter.formatMatchesPrintfForAllRegisterValues]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFormatter.formatMatchesPrintfForAllRegisterValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFormatter.formatMatchesPrintfForAllRegisterValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFormatter.batchFormatStopsAtEndOfBuffer]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFormatter.batchFormatStopsAtEndOfBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFormatter.batchFormatStopsAtEndOfBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestColumnarExporter.appendsIntoColumns]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestColumnarExporter.appendsIntoColumns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestColumnarExporter.appendsIntoColumns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestColumnarExporter.appendStopsWhenFull]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestColumnarExporter.appendStopsWhenFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestColumnarExporter.appendStopsWhenFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestColumnarExporter.buffersAreAligned]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestColumnarExporter.buffersAreAligned]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestColumnarExporter.buffersAreAligned]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestColumnarExporter.exportsSchema]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestColumnarExporter.exportsSchema]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestColumnarExporter.exportsSchema]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestColumnarExporter.exportsBatchWithoutCopying]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestColumnarExporter.exportsBatchWithoutCopying]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestColumnarExporter.exportsBatchWithoutCopying]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestWatchdog.expiresAfterTimeout]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestWatchdog.expiresAfterTimeout]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestWatchdog.expiresAfterTimeout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestWatchdog.resetPostponesExpiry]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestWatchdog.resetPostponesExpiry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestWatchdog.resetPostponesExpiry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestWatchdog.rejectsUnknownOrUnarmedSensors]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestWatchdog.rejectsUnknownOrUnarmedSensors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestWatchdog.rejectsUnknownOrUnarmedSensors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestWatchdog.timeoutFollowsConversionPeriod]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestWatchdog.timeoutFollowsConversionPeriod]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestWatchdog.timeoutFollowsConversionPeriod]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestWatchdog.expiresTimersAcrossLevels]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestWatchdog.expiresTimersAcrossLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestWatchdog.expiresTimersAcrossLevels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestWatchdog.matchesReferenceUnderRandomResets]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestWatchdog.matchesReferenceUnderRandomResets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestWatchdog.matchesReferenceUnderRandomResets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestTrace.samplesStartUnstamped]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestTrace.samplesStartUnstamped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestTrace.samplesStartUnstamped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestTrace.stampsAreRelativeToTimestamp]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestTrace.stampsAreRelativeToTimestamp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestTrace.stampsAreRelativeToTimestamp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestLatencyTracer.recordsTimeBeforeEachHop]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestLatencyTracer.recordsTimeBeforeEachHop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestLatencyTracer.recordsTimeBeforeEachHop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestLatencyTracer.attributesSkippedHopsToTheNext]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestLatencyTracer.attributesSkippedHopsToTheNext]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestLatencyTracer.attributesSkippedHopsToTheNext]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestLatencyTracer.reportsOnlyHopsStamped]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestLatencyTracer.reportsOnlyHopsStamped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestLatencyTracer.reportsOnlyHopsStamped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestHealthMonitor.unknownUntilSamplesCompared]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestHealthMonitor.unknownUntilSamplesCompared]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestHealthMonitor.unknownUntilSamplesCompared]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestHealthMonitor.detectsStuckSensor]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestHealthMonitor.detectsStuckSensor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestHealthMonitor.detectsStuckSensor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestHealthMonitor.stuckRunLengthensWithAveraging]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestHealthMonitor.stuckRunLengthensWithAveraging]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestHealthMonitor.stuckRunLengthensWithAveraging]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestHealthMonitor.detectsImplausibleSteps]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestHealthMonitor.detectsImplausibleSteps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestHealthMonitor.detectsImplausibleSteps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestHealthMonitor.scoresDeviceIdVerificationHistory]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestHealthMonitor.scoresDeviceIdVerificationHistory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestHealthMonitor.scoresDeviceIdVerificationHistory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFilterBank.firMatchesScalarConvolutionPerChannel]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFilterBank.firMatchesScalarConvolutionPerChannel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFilterBank.firMatchesScalarConvolutionPerChannel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFilterBank.biquadCascadeMatchesScalarDifferenceEquation]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFilterBank.biquadCascadeMatchesScalarDifferenceEquation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFilterBank.biquadCascadeMatchesScalarDifferenceEquation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFilterBank.lowPassHasUnityGainAtDc]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFilterBank.lowPassHasUnityGainAtDc]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFilterBank.lowPassHasUnityGainAtDc]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFilterBank.primeStartsInSteadyState]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFilterBank.primeStartsInSteadyState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFilterBank.primeStartsInSteadyState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestResampler.interpolatesRaggedSensorsOntoGrid]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestResampler.interpolatesRaggedSensorsOntoGrid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestResampler.interpolatesRaggedSensorsOntoGrid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestResampler.holdsLastSampleBeforeRow]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestResampler.holdsLastSampleBeforeRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestResampler.holdsLastSampleBeforeRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestResampler.completesRowsOnlyAfterAllSensorsOrLookahead]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestResampler.completesRowsOnlyAfterAllSensorsOrLookahead]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestResampler.completesRowsOnlyAfterAllSensorsOrLookahead]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestResampler.leavesGapsBeyondMaxGapMissing]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestResampler.leavesGapsBeyondMaxGapMissing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestResampler.leavesGapsBeyondMaxGapMissing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestResampler.dropsOutOfOrderSamples]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestResampler.dropsOutOfOrderSamples]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestResampler.dropsOutOfOrderSamples]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestResampler.dropsSamplesTooFarAheadOfPendingRows]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestResampler.dropsSamplesTooFarAheadOfPendingRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestResampler.dropsSamplesTooFarAheadOfPendingRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestThermalMap.cellsOnSensorsTakeTheirReadings]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestThermalMap.cellsOnSensorsTakeTheirReadings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestThermalMap.cellsOnSensorsTakeTheirReadings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestThermalMap.matchesDirectInverseDistanceWeighting]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestThermalMap.matchesDirectInverseDistanceWeighting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestThermalMap.matchesDirectInverseDistanceWeighting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestThermalMap.skipsSensorsWithoutReadings]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestThermalMap.skipsSensorsWithoutReadings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestThermalMap.skipsSensorsWithoutReadings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFusion.medianOfThreeOutvotesFaultySensor]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFusion.medianOfThreeOutvotesFaultySensor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFusion.medianOfThreeOutvotesFaultySensor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFusion.medianOfFourIsTrimmedMean]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFusion.medianOfFourIsTrimmedMean]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFusion.medianOfFourIsTrimmedMean]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFusion.membersWithoutReadingsAreExcluded]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFusion.membersWithoutReadingsAreExcluded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFusion.membersWithoutReadingsAreExcluded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFusion.rejectsOutOfRange]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFusion.rejectsOutOfRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFusion.rejectsOutOfRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestFusion.matchesScalarMedianAcrossSets]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestFusion.matchesScalarMedianAcrossSets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestFusion.matchesScalarMedianAcrossSets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPredictor.linearRampAlertsBeforeHighLimit]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPredictor.linearRampAlertsBeforeHighLimit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPredictor.linearRampAlertsBeforeHighLimit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPredictor.levellingOffClearsAlert]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPredictor.levellingOffClearsAlert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPredictor.levellingOffClearsAlert]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPredictor.fallingRampAlertsBeforeLowLimit]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPredictor.fallingRampAlertsBeforeLowLimit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPredictor.fallingRampAlertsBeforeLowLimit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPredictor.quadraticFitAnticipatesAcceleration]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPredictor.quadraticFitAnticipatesAcceleration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPredictor.quadraticFitAnticipatesAcceleration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPredictor.rollingSumsMatchDirectFit]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPredictor.rollingSumsMatchDirectFit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPredictor.rollingSumsMatchDirectFit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPredictor.rejectsInvalidInput]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPredictor.rejectsInvalidInput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPredictor.rejectsInvalidInput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestEstimator.firstSampleIsTakenWithItsMeasurementVariance]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestEstimator.firstSampleIsTakenWithItsMeasurementVariance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestEstimator.firstSampleIsTakenWithItsMeasurementVariance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestEstimator.predictsOverSampleIntervalWithoutSamples]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestEstimator.predictsOverSampleIntervalWithoutSamples]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestEstimator.predictsOverSampleIntervalWithoutSamples]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestEstimator.tracksNoisyTemperatureWithinItsVariance]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestEstimator.tracksNoisyTemperatureWithinItsVariance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestEstimator.tracksNoisyTemperatureWithinItsVariance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestEstimator.resetAndRejectsOutOfRange]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestEstimator.resetAndRejectsOutOfRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestEstimator.resetAndRejectsOutOfRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestC.addSensorRejectsInvalidArguments]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestC.addSensorRejectsInvalidArguments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestC.addSensorRejectsInvalidArguments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestC.readTemperaturesReadsEachSensorOnce]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestC.readTemperaturesReadsEachSensorOnce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestC.readTemperaturesReadsEachSensorOnce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestC.sampleSkipsFailedSensors]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestC.sampleSkipsFailedSensors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestC.sampleSkipsFailedSensors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestC.appliesAndReadsConfigsInBulk]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestC.appliesAndReadsConfigsInBulk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestC.appliesAndReadsConfigsInBulk]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestC.setsLimitsInBulk]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestC.setsLimitsInBulk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestC.setsLimitsInBulk]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestC.nullHandlesAndArraysReturnZero]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestC.nullHandlesAndArraysReturnZero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestC.nullHandlesAndArraysReturnZero]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCRing.drainsRingsInBulk]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCRing.drainsRingsInBulk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCRing.drainsRingsInBulk]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestWorker.nowIsMonotonic]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestWorker.nowIsMonotonic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestWorker.nowIsMonotonic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestWorker.acquiresSamplesIntoRingAndRecordsJitter]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestWorker.acquiresSamplesIntoRingAndRecordsJitter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestWorker.acquiresSamplesIntoRingAndRecordsJitter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestWorker.startFailsWhenRealTimePolicyCannotBeApplied]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestWorker.startFailsWhenRealTimePolicyCannotBeApplied]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestWorker.startFailsWhenRealTimePolicyCannotBeApplied]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestThreadPool.executesAllSubmittedTasks]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestThreadPool.executesAllSubmittedTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestThreadPool.executesAllSubmittedTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestThreadPool.stealsTasksSubmittedByATask]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestThreadPool.stealsTasksSubmittedByATask]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestThreadPool.stealsTasksSubmittedByATask]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestThreadPool.waitsForGroupFromATaskOfASingleThreadPool]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestThreadPool.waitsForGroupFromATaskOfASingleThreadPool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestThreadPool.waitsForGroupFromATaskOfASingleThreadPool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.pushFailsWithoutStages]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.pushFailsWithoutStages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.pushFailsWithoutStages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.processesSamplesThroughStagesInOrder]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.processesSamplesThroughStagesInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.processesSamplesThroughStagesInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.stampsEnqueueAndStageExits]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.stampsEnqueueAndStageExits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.stampsEnqueueAndStageExits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.filteredSamplesAreNotPassedOn]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.filteredSamplesAreNotPassedOn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.filteredSamplesAreNotPassedOn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.dropOldestKeepsNewestSamplesWhenFull]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.dropOldestKeepsNewestSamplesWhenFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.dropOldestKeepsNewestSamplesWhenFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.blockStallsUpstreamStageWithoutLoss]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.blockStallsUpstreamStageWithoutLoss]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.blockStallsUpstreamStageWithoutLoss]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.blockCompletesOnASingleThread]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.blockCompletesOnASingleThread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.blockCompletesOnASingleThread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.blockingFirstStageDropsPushedSamplesInsteadOfBlocking]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.blockingFirstStageDropsPushedSamplesInsteadOfBlocking]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.blockingFirstStageDropsPushedSamplesInsteadOfBlocking]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.sampleDownAcceptsOneInRatioOnceHalfFull]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.sampleDownAcceptsOneInRatioOnceHalfFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.sampleDownAcceptsOneInRatioOnceHalfFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestPipeline.sampleDownEmitsOnlySamplesQueued]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestPipeline.sampleDownEmitsOnlySamplesQueued]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestPipeline.sampleDownEmitsOnlySamplesQueued]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStreamServer.streamsBatchesToAllSubscribers]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStreamServer.streamsBatchesToAllSubscribers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStreamServer.streamsBatchesToAllSubscribers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStreamServer.appliesSubscriptionFilters]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStreamServer.appliesSubscriptionFilters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStreamServer.appliesSubscriptionFilters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStreamServer.splitsFramesExceedingGatherLimit]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStreamServer.splitsFramesExceedingGatherLimit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStreamServer.splitsFramesExceedingGatherLimit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStreamServer.removesSubscribersWhichHangUp]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStreamServer.removesSubscribersWhichHangUp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStreamServer.removesSubscribersWhichHangUp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStreamServer.shedsSlowSubscribersWithoutBlocking]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStreamServer.shedsSlowSubscribersWithoutBlocking]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStreamServer.shedsSlowSubscribersWithoutBlocking]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStreamServer.splitsLargeBatchesIntoFramesFittingTheSendBuffer]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStreamServer.splitsLargeBatchesIntoFramesFittingTheSendBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStreamServer.splitsLargeBatchesIntoFramesFittingTheSendBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStreamServer.gathersAtLeastOneRunPerFrame]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStreamServer.gathersAtLeastOneRunPerFrame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStreamServer.gathersAtLeastOneRunPerFrame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStreamServer.splitsBatchesSpanningMoreThanARecordOffset]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStreamServer.splitsBatchesSpanningMoreThanARecordOffset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStreamServer.splitsBatchesSpanningMoreThanARecordOffset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestStreamServer.refusesPathOfListeningServerButReplacesStaleSocket]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestStreamServer.refusesPathOfListeningServerButReplacesStaleSocket]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestStreamServer.refusesPathOfListeningServerButReplacesStaleSocket]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.writesAndReadsBackAllSamples]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.writesAndReadsBackAllSamples]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.writesAndReadsBackAllSamples]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.timeRangeSkipsBlocksByIndex]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.timeRangeSkipsBlocksByIndex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.timeRangeSkipsBlocksByIndex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.temperaturePredicateIsPushedDown]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.temperaturePredicateIsPushedDown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.temperaturePredicateIsPushedDown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.visitorStopsScan]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.visitorStopsScan]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.visitorStopsScan]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.recoversUnsealedSegment]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.recoversUnsealedSegment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.recoversUnsealedSegment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.rejectsMissingOrForeignFiles]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.rejectsMissingOrForeignFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.rejectsMissingOrForeignFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.queriesSegmentsInParallelInOrder]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.queriesSegmentsInParallelInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.queriesSegmentsInParallelInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.queriesSegmentsFromATaskOfTheSamePool]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.queriesSegmentsFromATaskOfTheSamePool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.queriesSegmentsFromATaskOfTheSamePool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.reportsCorruptBlocksOfSealedSegments]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.reportsCorruptBlocksOfSealedSegments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.reportsCorruptBlocksOfSealedSegments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestSegment.failedWriterClosesWithoutATrailer]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestSegment.failedWriterClosesWithoutATrailer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestSegment.failedWriterClosesWithoutATrailer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBackfill.plansShardsBySensorRangeAndTimeWindow]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBackfill.plansShardsBySensorRangeAndTimeWindow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBackfill.plansShardsBySensorRangeAndTimeWindow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBackfill.aggregatesAndAlertsMatchSequentialEvaluation]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBackfill.aggregatesAndAlertsMatchSequentialEvaluation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBackfill.aggregatesAndAlertsMatchSequentialEvaluation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBackfill.resultIsIndependentOfThreadCount]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBackfill.resultIsIndependentOfThreadCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBackfill.resultIsIndependentOfThreadCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestBackfill.filterDropsSamples]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestBackfill.filterDropsSamples]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestBackfill.filterDropsSamples]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.mergesSmallSegmentsPreservingSamples]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.mergesSmallSegmentsPreservingSamples]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.mergesSmallSegmentsPreservingSamples]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.leavesUnsealedSegmentsUntouched]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.leavesUnsealedSegmentsUntouched]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.leavesUnsealedSegmentsUntouched]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.downsamplesOldSamplesToMeans]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.downsamplesOldSamplesToMeans]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.downsamplesOldSamplesToMeans]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.mergesDownsampledSegmentsWithNewMeansInOrder]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.mergesDownsampledSegmentsWithNewMeansInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.mergesDownsampledSegmentsWithNewMeansInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.foldsLateSamplesIntoDownsampledMeans]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.foldsLateSamplesIntoDownsampledMeans]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.foldsLateSamplesIntoDownsampledMeans]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.removesTemporaryOutputsLeftByEarlierPasses]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.removesTemporaryOutputsLeftByEarlierPasses]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.removesTemporaryOutputsLeftByEarlierPasses]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.deletesExpiredSamples]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.deletesExpiredSamples]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.deletesExpiredSamples]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.openReadersRemainValid]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.openReadersRemainValid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.openReadersRemainValid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.limitsIoRate]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.limitsIoRate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.limitsIoRate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestCompactor.stopsBackgroundThreadDuringThrottledRewrite]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestCompactor.stopsBackgroundThreadDuringThrottledRewrite]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestCompactor.stopsBackgroundThreadDuringThrottledRewrite]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestGroupCommit.commitsOnBatchSize]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestGroupCommit.commitsOnBatchSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestGroupCommit.commitsOnBatchSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestGroupCommit.commitsOnMaxDelay]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestGroupCommit.commitsOnMaxDelay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestGroupCommit.commitsOnMaxDelay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestGroupCommit.groupsSamplesOfManyProducers]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestGroupCommit.groupsSamplesOfManyProducers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestGroupCommit.groupsSamplesOfManyProducers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestGroupCommit.refusesWhenFullOrStopped]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestGroupCommit.refusesWhenFullOrStopped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestGroupCommit.refusesWhenFullOrStopped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TMP116_TestGroupCommit.refusesRestartKeepingDurableSamples]=]  /root/repo/_warn_build/TMP116_Test [==[--gtest_filter=TMP116_TestGroupCommit.refusesRestartKeepingDurableSamples]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TMP116_TestGroupCommit.refusesRestartKeepingDurableSamples]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  TMP116_Test_TESTS TMP116_TestStatic.convertTemperatureRegisterReturnsCorrectValuesRegisterToFloat TMP116_TestStatic.convertTemperatureRegisterReturnsCurrentValuesFloatToRegister TMP116_Test.getTemperatureNormallyReturnsValue TMP116_Test.getTemperatureReturnsAbsoluteZeroWhenI2CReadFails TMP116_Test.getDeviceIdNormallyReturnsValue TMP116_Test.getDeviceIdReturnsNulloptWhenI2CReadFails TMP116_Test.getConfigRegisterNormallyReturnsValue TMP116_Test.getConfigRegisterReturnsNulloptWhenI2CReadFails TMP116_Test.getConfigNormallyReturnsValue TMP116_Test.getConfigReturnsNulloptWhenI2CReadFails TMP116_Test.dataReadyNormallyReturnsValue TMP116_Test.dataReadyReturnsFalseWhenI2CReadFails TMP116_Test.setConfigNormallyReturnsRegisterValue TMP116_Test.setConfigReturnsNulloptWhenI2CWriteFails TMP116_Test.setConfigNormallyDirectlyWritesWhenGivenCompleteNewConfiguration TMP116_Test.setConfigReturnsNulloptIfGivenNoParameters TMP116_Test.setConfigSetsOnlyGivenParametersAndOtherwiseMaintainsState TMP116_Test.setConfigWillNotWriteIfConfigIsUnchangedAndWillReturnCurrentConfig TMP116_Test.setConfigReturnsNulloptWhenI2CFails TMP116_Test.setHighLimitNormallyReturnsRegisterValue TMP116_Test.setHighLimitReturnsNulloptWhenI2CWriteFails TMP116_Test.setLowLimitNormallyReturnsRegisterValue TMP116_Test.setLowLimitReturnsNulloptWhenI2CWriteFails TMP116_Test.getTemperatureRegisterNormallyReturnsValue TMP116_Test.getTemperatureRegisterReturnsNulloptWhenI2CReadFails TMP116_TestSample.getTemperatureConvertsRawRegister TMP116_TestConfig.constructorDecodesRegisterSampleTestCases TMP116_TestConfig.constructorMapsAlternativeContinuosConversionMode TMP116_TestConfig.constructorDefaultConstructsToDeviceFactoryDefaultConfig TMP116_TestConfig.configImplicitTypeCastsToRegister TMP116_TestConfig.getConversionPeriodReturnsCycleTimeOrActiveConversionTime TMP116_TestConfig.getAverageCountDecodesAverages TMP116_TestBusModel.getClockCyclesReturnsTransactionShapes TMP116_TestBusModel.getTransactionTimeScalesWithClockFrequency TMP116_TestBusModel.zeroClockFrequencyIsClamped TMP116_TestBusModel.pollPolicyPeriodIsNeverFasterThanConversionPeriod TMP116_TestBusModel.getOccupancyIncludesDataReadyPolling TMP116_TestBusModel.admitAcceptsPolicyWithinBudget TMP116_TestBusModel.admitDegradesPolicyExceedingBudget TMP116_TestBusModel.admitRejectsPolicyWhenBudgetExhausted TMP116_TestBusMonitor.countsAndForwardsTransactions TMP116_TestBusMonitor.getOccupancyErrorComparesAgainstModel TMP116_TestScheduler.addSensorWritesAdmittedConfig TMP116_TestScheduler.addSensorFailsWhenConfigCannotBeWritten TMP116_TestScheduler.addSensorRejectsPolicyExceedingBusBudget TMP116_TestScheduler.pollReadsEarliestDeadlineFirst TMP116_TestScheduler.pollWaitsForNextRelease TMP116_TestScheduler.pollRecordsSlackAndDeadlineMisses TMP116_TestScheduler.pollCountsFailedReadsAndRetriesJob TMP116_TestScheduler.pollWaitsForDataReadyWhenPolicyRequires TMP116_TestRing.capacityIsRoundedUpToPowerOfTwo TMP116_TestRing.popReturnsElementsInOrder TMP116_TestRing.pushFailsWhenFull TMP116_TestRing.bulkPopDrainsAvailableElementsAcrossWrap TMP116_TestQueue.capacityIsRoundedUpToPowerOfTwo TMP116_TestQueue.popReturnsElementsInOrderAcrossWrap TMP116_TestQueue.pushFailsWhenFull TMP116_TestJitterRecorder.recordsLatenessIntoLogarithmicBuckets TMP116_TestJitterRecorder.getPercentileReturnsBucketUpperBound TMP116_TestJitterRecorder.resetClearsAllReads TMP116_TestRollup.ingestAggregatesAtEachResolution TMP116_TestRollup.sensorsAreAggregatedIndependently TMP116_TestRollup.bucketsAreRecycledAsTimeAdvances TMP116_TestRollup.getBucketsReturnsRetainedBucketsInRange TMP116_TestQuantileSketch.getQuantileIsExactAtUnitBucketWidth TMP116_TestQuantileSketch.negativeTemperaturesAreOrderedBelowPositive TMP116_TestQuantileSketch.compressesByCoarseningWhenBucketLimitExceeded TMP116_TestQuantileSketch.keepsNegativeValuesBelowZeroAtTheMaximumShift TMP116_TestQuantileSketch.mergeCombinesSketchesOfDifferentWidths TMP116_TestSlidingQuantileSketch.getWindowMergesOnlyCurrentSubWindows TMP116_TestSlidingQuantileSketch.windowsBeforeTheEpochStartAtTheirFloor TMP116_TestZoneIndex.getRangeAggregatesValidSensors TMP116_TestZoneIndex.zonesTrackUpdatesAndInvalidation TMP116_TestZoneIndex.getHottestReturnsSensorsInDescendingOrder TMP116_TestChangePublisher.publishesFirstSampleAndChangesBeyondDeadband TMP116_TestChangePublisher.publishesHeartbeatWhenIntervalExpires TMP116_TestChangePublisher.deadbandIsPerSensor TMP116_TestFormatter.formatIsExactWithSevenDecimals TMP116_TestFormatter.formatRoundsHalfAwayFromZero TMP116_TestFormatter.formatMatchesPrintfForAllRegisterValues TMP116_TestFormatter.batchFormatStopsAtEndOfBuffer TMP116_TestColumnarExporter.appendsIntoColumns TMP116_TestColumnarExporter.appendStopsWhenFull TMP116_TestColumnarExporter.buffersAreAligned TMP116_TestColumnarExporter.exportsSchema TMP116_TestColumnarExporter.exportsBatchWithoutCopying TMP116_TestWatchdog.expiresAfterTimeout TMP116_TestWatchdog.resetPostponesExpiry TMP116_TestWatchdog.rejectsUnknownOrUnarmedSensors TMP116_TestWatchdog.timeoutFollowsConversionPeriod TMP116_TestWatchdog.expiresTimersAcrossLevels TMP116_TestWatchdog.matchesReferenceUnderRandomResets TMP116_TestTrace.samplesStartUnstamped TMP116_TestTrace.stampsAreRelativeToTimestamp TMP116_TestLatencyTracer.recordsTimeBeforeEachHop TMP116_TestLatencyTracer.attributesSkippedHopsToTheNext TMP116_TestLatencyTracer.reportsOnlyHopsStamped TMP116_TestHealthMonitor.unknownUntilSamplesCompared TMP116_TestHealthMonitor.detectsStuckSensor TMP116_TestHealthMonitor.stuckRunLengthensWithAveraging TMP116_TestHealthMonitor.detectsImplausibleSteps TMP116_TestHealthMonitor.scoresDeviceIdVerificationHistory TMP116_TestFilterBank.firMatchesScalarConvolutionPerChannel TMP116_TestFilterBank.biquadCascadeMatchesScalarDifferenceEquation TMP116_TestFilterBank.lowPassHasUnityGainAtDc TMP116_TestFilterBank.primeStartsInSteadyState TMP116_TestResampler.interpolatesRaggedSensorsOntoGrid TMP116_TestResampler.holdsLastSampleBeforeRow TMP116_TestResampler.completesRowsOnlyAfterAllSensorsOrLookahead TMP116_TestResampler.leavesGapsBeyondMaxGapMissing TMP116_TestResampler.dropsOutOfOrderSamples TMP116_TestResampler.dropsSamplesTooFarAheadOfPendingRows TMP116_TestThermalMap.cellsOnSensorsTakeTheirReadings TMP116_TestThermalMap.matchesDirectInverseDistanceWeighting TMP116_TestThermalMap.skipsSensorsWithoutReadings TMP116_TestFusion.medianOfThreeOutvotesFaultySensor TMP116_TestFusion.medianOfFourIsTrimmedMean TMP116_TestFusion.membersWithoutReadingsAreExcluded TMP116_TestFusion.rejectsOutOfRange TMP116_TestFusion.matchesScalarMedianAcrossSets TMP116_TestPredictor.linearRampAlertsBeforeHighLimit TMP116_TestPredictor.levellingOffClearsAlert TMP116_TestPredictor.fallingRampAlertsBeforeLowLimit TMP116_TestPredictor.quadraticFitAnticipatesAcceleration TMP116_TestPredictor.rollingSumsMatchDirectFit TMP116_TestPredictor.rejectsInvalidInput TMP116_TestEstimator.firstSampleIsTakenWithItsMeasurementVariance TMP116_TestEstimator.predictsOverSampleIntervalWithoutSamples TMP116_TestEstimator.tracksNoisyTemperatureWithinItsVariance TMP116_TestEstimator.resetAndRejectsOutOfRange TMP116_TestC.addSensorRejectsInvalidArguments TMP116_TestC.readTemperaturesReadsEachSensorOnce TMP116_TestC.sampleSkipsFailedSensors TMP116_TestC.appliesAndReadsConfigsInBulk TMP116_TestC.setsLimitsInBulk TMP116_TestC.nullHandlesAndArraysReturnZero TMP116_TestCRing.drainsRingsInBulk TMP116_TestWorker.nowIsMonotonic TMP116_TestWorker.acquiresSamplesIntoRingAndRecordsJitter TMP116_TestWorker.startFailsWhenRealTimePolicyCannotBeApplied TMP116_TestThreadPool.executesAllSubmittedTasks TMP116_TestThreadPool.stealsTasksSubmittedByATask TMP116_TestThreadPool.waitsForGroupFromATaskOfASingleThreadPool TMP116_TestPipeline.pushFailsWithoutStages TMP116_TestPipeline.processesSamplesThroughStagesInOrder TMP116_TestPipeline.stampsEnqueueAndStageExits TMP116_TestPipeline.filteredSamplesAreNotPassedOn TMP116_TestPipeline.dropOldestKeepsNewestSamplesWhenFull TMP116_TestPipeline.blockStallsUpstreamStageWithoutLoss TMP116_TestPipeline.blockCompletesOnASingleThread TMP116_TestPipeline.blockingFirstStageDropsPushedSamplesInsteadOfBlocking TMP116_TestPipeline.sampleDownAcceptsOneInRatioOnceHalfFull TMP116_TestPipeline.sampleDownEmitsOnlySamplesQueued TMP116_TestStreamServer.streamsBatchesToAllSubscribers TMP116_TestStreamServer.appliesSubscriptionFilters TMP116_TestStreamServer.splitsFramesExceedingGatherLimit TMP116_TestStreamServer.removesSubscribersWhichHangUp TMP116_TestStreamServer.shedsSlowSubscribersWithoutBlocking TMP116_TestStreamServer.splitsLargeBatchesIntoFramesFittingTheSendBuffer TMP116_TestStreamServer.gathersAtLeastOneRunPerFrame TMP116_TestStreamServer.splitsBatchesSpanningMoreThanARecordOffset TMP116_TestStreamServer.refusesPathOfListeningServerButReplacesStaleSocket TMP116_TestSegment.writesAndReadsBackAllSamples TMP116_TestSegment.timeRangeSkipsBlocksByIndex TMP116_TestSegment.temperaturePredicateIsPushedDown TMP116_TestSegment.visitorStopsScan TMP116_TestSegment.recoversUnsealedSegment TMP116_TestSegment.rejectsMissingOrForeignFiles TMP116_TestSegment.queriesSegmentsInParallelInOrder TMP116_TestSegment.queriesSegmentsFromATaskOfTheSamePool TMP116_TestSegment.reportsCorruptBlocksOfSealedSegments TMP116_TestSegment.failedWriterClosesWithoutATrailer TMP116_TestBackfill.plansShardsBySensorRangeAndTimeWindow TMP116_TestBackfill.aggregatesAndAlertsMatchSequentialEvaluation TMP116_TestBackfill.resultIsIndependentOfThreadCount TMP116_TestBackfill.filterDropsSamples TMP116_TestCompactor.mergesSmallSegmentsPreservingSamples TMP116_TestCompactor.leavesUnsealedSegmentsUntouched TMP116_TestCompactor.downsamplesOldSamplesToMeans TMP116_TestCompactor.mergesDownsampledSegmentsWithNewMeansInOrder TMP116_TestCompactor.foldsLateSamplesIntoDownsampledMeans TMP116_TestCompactor.removesTemporaryOutputsLeftByEarlierPasses TMP116_TestCompactor.deletesExpiredSamples TMP116_TestCompactor.openReadersRemainValid TMP116_TestCompactor.limitsIoRate TMP116_TestCompactor.stopsBackgroundThreadDuringThrottledRewrite TMP116_TestGroupCommit.commitsOnBatchSize TMP116_TestGroupCommit.commitsOnMaxDelay TMP116_TestGroupCommit.groupsSamplesOfManyProducers TMP116_TestGroupCommit.refusesWhenFullOrStopped TMP116_TestGroupCommit.refusesRestartKeepingDurableSamples)